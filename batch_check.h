@@ -0,0 +1,402 @@
+#ifndef BATCH_CHECK_H
+#define BATCH_CHECK_H
+
+#include "formula_io.h"
+#include "formula_kernel.h"
+#include "sat.h"
+#include "theorem_cache.h"
+#include "truth_table.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// --- Batch Checking ---
+// 批量检查一个公式文件 (prop_check 的核心)。三段流水线:
+//   读取线程  解析映射的输入, 每 batch_size 个公式打成一批
+//   检查线程  每个线程取一批, 逐个选择后端检查并生成输出文本
+//   调用线程  按批次顺序写出结果
+// 文本输入中形如 "@名字" 的一行不经解析, 直接交给注册表中同名的编译内核 (formula_kernel.h)。
+// 同时在途的批次数有上限, 所以内存占用与输入大小无关。
+
+namespace cpp_prop::runtime {
+
+enum class Backend { TruthTable, Sat, Cache, Kernel };
+
+inline const char *backend_name(Backend backend) {
+  switch (backend) {
+  case Backend::TruthTable:
+    return "truth-table";
+  case Backend::Sat:
+    return "sat";
+  case Backend::Kernel:
+    return "kernel";
+  default:
+    return "cache";
+  }
+}
+
+struct Verdict {
+  bool valid;
+  Backend backend;
+  std::vector<bool> counterexample; // 有效时为空
+};
+
+// 变量不多于此数时按位并行地枚举真值表 (最多 2^20 个赋值, 约 2000 个 Block),
+// 否则交给 SAT 求解器
+inline constexpr unsigned kTruthTableMaxVars = 20;
+
+inline Verdict check_formula(const Formula &formula) {
+  if (formula.num_vars() <= kTruthTableMaxVars) {
+    TautologyResult result = check_tautology(formula);
+    Verdict verdict{result.tautology, Backend::TruthTable, {}};
+    if (!result.tautology) {
+      verdict.counterexample.resize(formula.num_vars());
+      for (unsigned i = 0; i < formula.num_vars(); ++i) {
+        verdict.counterexample[i] = ((result.counterexample >> i) & 1u) != 0;
+      }
+    }
+    return verdict;
+  }
+  ValidityResult result = check_validity(formula);
+  return {result.valid, Backend::Sat, std::move(result.counterexample)};
+}
+
+// 编译内核总是按真值表检查, 因此同样受 kTruthTableMaxVars 限制; 内核只保留
+// 直线代码, 没有可交给 SAT 求解器的公式, 变量更多时抛出 std::invalid_argument
+inline Verdict check_formula(const FormulaKernel &kernel) {
+  if (kernel.num_vars > kTruthTableMaxVars) {
+    throw std::invalid_argument("kernel '" + kernel.name + "' has " +
+                                std::to_string(kernel.num_vars) +
+                                " variables, more than the truth-table limit of " +
+                                std::to_string(kTruthTableMaxVars));
+  }
+  TautologyResult result = check_tautology(kernel);
+  Verdict verdict{result.tautology, Backend::Kernel, {}};
+  if (!result.tautology) {
+    verdict.counterexample.resize(kernel.num_vars);
+    for (unsigned i = 0; i < kernel.num_vars; ++i) {
+      verdict.counterexample[i] = ((result.counterexample >> i) & 1u) != 0;
+    }
+  }
+  return verdict;
+}
+
+// 变量少于此数的公式直接用真值表检查 (至多 8 个 Block), 比规范化加查表还快,
+// 不经过缓存
+inline constexpr unsigned kCacheMinVars = 12;
+
+// 先查缓存, 未命中时检查并把结果写回缓存; cache 为空时等同于 check_formula(formula)
+inline Verdict check_formula(const Formula &formula, TheoremCache *cache,
+                             unsigned cache_min_vars = kCacheMinVars) {
+  if (cache == nullptr || formula.num_vars() < cache_min_vars) {
+    return check_formula(formula);
+  }
+  CanonicalForm form = canonicalize(formula);
+  CachedVerdict cached;
+  if (cache->lookup(form, formula.num_vars(), &cached)) {
+    return {cached.valid, Backend::Cache, std::move(cached.counterexample)};
+  }
+  Verdict verdict = check_formula(formula);
+  cache->insert(form, verdict.valid, verdict.counterexample);
+  return verdict;
+}
+
+enum class InputFormat { Text, Binary };
+
+struct BatchOptions {
+  unsigned threads = 0;               // 检查线程数, 0 表示硬件线程数
+  std::size_t batch_size = 1024;      // 每批公式数
+  std::size_t max_inflight = 0;       // 在途批次上限, 0 表示检查线程数的 4 倍
+  TheoremCache *cache = nullptr;      // 已知结果的缓存, 可以为空
+  unsigned cache_min_vars = kCacheMinVars; // 变量少于此数的公式不经过缓存
+  const KernelRegistry *kernels = nullptr; // "@名字" 查找的注册表, 为空表示全局注册表
+};
+
+struct BatchSummary {
+  std::size_t formulas = 0;
+  std::size_t valid = 0;
+  std::size_t invalid = 0;
+  std::size_t errors = 0;
+};
+
+namespace detail {
+
+struct BatchItem {
+  explicit BatchItem(std::size_t number) : number(number) {}
+
+  std::size_t number;                    // 文本: 行号; 二进制: 记录序号 (从 1 开始)
+  Formula formula = Formula::constant(true);
+  std::vector<std::string_view> names;   // 文本格式的变量名
+  std::vector<std::uint32_t> variables;  // 二进制格式: 变量在记录中的原编号
+  const FormulaKernel *kernel = nullptr; // 非空时检查该内核而不是 formula
+  std::string error;                     // 非空表示解析失败
+};
+
+// "@名字" 一行中的名字 (忽略首尾空白); 其它行返回空
+inline std::string_view kernel_reference(std::string_view line) {
+  auto blank = [](char c) { return c == ' ' || c == '\t' || c == '\r'; };
+  while (!line.empty() && blank(line.front())) {
+    line.remove_prefix(1);
+  }
+  while (!line.empty() && blank(line.back())) {
+    line.remove_suffix(1);
+  }
+  if (line.size() < 2 || line.front() != '@') {
+    return {};
+  }
+  return line.substr(1);
+}
+
+struct Batch {
+  std::size_t seq;
+  std::vector<BatchItem> items;
+};
+
+// 每个公式一行, 字段以制表符分隔:
+//   <编号>  valid    <后端>
+//   <编号>  invalid  <后端>  <反例, 如 p=1 q=0>
+//   <编号>  error    <原因>
+inline void render(const BatchItem &item, const BatchOptions &options,
+                   std::string &out, BatchSummary &summary) {
+  out += std::to_string(item.number);
+  if (!item.error.empty()) {
+    ++summary.errors;
+    out += "\terror\t";
+    out += item.error;
+    out += '\n';
+    return;
+  }
+  Verdict verdict;
+  try {
+    verdict = item.kernel != nullptr
+                  ? check_formula(*item.kernel)
+                  : check_formula(item.formula, options.cache, options.cache_min_vars);
+  } catch (const std::exception &e) {
+    ++summary.errors;
+    out += "\terror\t";
+    out += e.what();
+    out += '\n';
+    return;
+  }
+  if (verdict.valid) {
+    ++summary.valid;
+    out += "\tvalid\t";
+    out += backend_name(verdict.backend);
+    out += '\n';
+    return;
+  }
+  ++summary.invalid;
+  out += "\tinvalid\t";
+  out += backend_name(verdict.backend);
+  out += '\t';
+  for (std::size_t i = 0; i < verdict.counterexample.size(); ++i) {
+    if (i != 0) {
+      out += ' ';
+    }
+    if (i < item.names.size()) {
+      out += item.names[i];
+    } else {
+      out += 'x';
+      out += std::to_string(i < item.variables.size() ? item.variables[i] : i);
+    }
+    out += verdict.counterexample[i] ? "=1" : "=0";
+  }
+  out += '\n';
+}
+
+} // namespace detail
+
+// 对文本格式 input 中每个非空白、非注释行调用 f(行号, 行), 行号从 1 开始。
+// f 返回 false 时停止, 此时返回 false
+template <typename F> bool for_each_text_line(std::string_view input, F f) {
+  std::size_t line_number = 0;
+  std::size_t pos = 0;
+  while (pos < input.size()) {
+    std::size_t end = input.find('\n', pos);
+    if (end == std::string_view::npos) {
+      end = input.size();
+    }
+    std::string_view line = input.substr(pos, end - pos);
+    pos = end + 1;
+    ++line_number;
+    if (!TextFormulaParser::is_blank(line) && !f(line_number, line)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// 检查 input 中的全部公式, 结果按输入顺序写到 out
+inline BatchSummary run_batch_check(std::string_view input, InputFormat format,
+                                    std::ostream &out,
+                                    const BatchOptions &options = {}) {
+  unsigned workers = options.threads != 0 ? options.threads
+                                          : std::thread::hardware_concurrency();
+  workers = std::max(workers, 1u);
+  const std::size_t batch_size = std::max<std::size_t>(options.batch_size, 1);
+  const std::size_t max_inflight =
+      options.max_inflight != 0 ? options.max_inflight : std::size_t{4} * workers;
+
+  std::mutex mutex;
+  std::condition_variable work_ready;
+  std::condition_variable space_ready;
+  std::condition_variable result_ready;
+  std::deque<detail::Batch> work;
+  std::map<std::size_t, std::string> results;
+  std::size_t inflight = 0;
+  std::size_t total_batches = 0;
+  bool input_done = false;
+
+  std::mutex summary_mutex;
+  BatchSummary summary;
+
+  auto reader = [&] {
+    detail::Batch batch{0, {}};
+    auto flush = [&] {
+      if (batch.items.empty()) {
+        return;
+      }
+      std::unique_lock<std::mutex> lock(mutex);
+      space_ready.wait(lock, [&] { return inflight < max_inflight; });
+      ++inflight;
+      work.push_back(std::move(batch));
+      std::size_t seq = ++total_batches;
+      lock.unlock();
+      work_ready.notify_one();
+      batch = detail::Batch{seq, {}};
+      batch.items.reserve(batch_size);
+    };
+    batch.items.reserve(batch_size);
+
+    if (format == InputFormat::Text) {
+      TextFormulaParser parser;
+      const KernelRegistry &kernels =
+          options.kernels != nullptr ? *options.kernels : KernelRegistry::global();
+      for_each_text_line(input, [&](std::size_t line_number, std::string_view line) {
+        detail::BatchItem item(line_number);
+        std::string_view kernel_name = detail::kernel_reference(line);
+        if (!kernel_name.empty()) {
+          item.kernel = kernels.find(kernel_name);
+          if (item.kernel != nullptr) {
+            item.names = item.kernel->names;
+          } else {
+            item.error = "unknown kernel '" + std::string(kernel_name) + "'";
+          }
+        } else if (parser.parse(line, item.formula)) {
+          item.names = parser.names();
+        } else {
+          item.error = parser.error();
+        }
+        batch.items.push_back(std::move(item));
+        if (batch.items.size() == batch_size) {
+          flush();
+        }
+        return true;
+      });
+    } else {
+      std::size_t record = 0;
+      try {
+        BinaryFormulaReader records(input);
+        detail::BatchItem item(1);
+        while (records.next(item.formula)) {
+          item.number = ++record;
+          item.variables = records.variables();
+          batch.items.push_back(std::move(item));
+          item = detail::BatchItem(0);
+          if (batch.items.size() == batch_size) {
+            flush();
+          }
+        }
+      } catch (const std::exception &e) {
+        // 二进制记录损坏后无法定位下一条, 报告错误并停止读取
+        detail::BatchItem item(record + 1);
+        item.error = e.what();
+        batch.items.push_back(std::move(item));
+      }
+    }
+    flush();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    input_done = true;
+    work_ready.notify_all();
+    result_ready.notify_all();
+  };
+
+  auto checker = [&] {
+    BatchSummary local;
+    while (true) {
+      std::unique_lock<std::mutex> lock(mutex);
+      work_ready.wait(lock, [&] { return !work.empty() || input_done; });
+      if (work.empty()) {
+        break;
+      }
+      detail::Batch batch = std::move(work.front());
+      work.pop_front();
+      lock.unlock();
+
+      std::string text;
+      for (const detail::BatchItem &item : batch.items) {
+        ++local.formulas;
+        detail::render(item, options, text, local);
+      }
+
+      lock.lock();
+      results.emplace(batch.seq, std::move(text));
+      lock.unlock();
+      result_ready.notify_one();
+    }
+    std::lock_guard<std::mutex> lock(summary_mutex);
+    summary.formulas += local.formulas;
+    summary.valid += local.valid;
+    summary.invalid += local.invalid;
+    summary.errors += local.errors;
+  };
+
+  std::thread read_thread(reader);
+  std::vector<std::thread> check_threads;
+  check_threads.reserve(workers);
+  for (unsigned i = 0; i < workers; ++i) {
+    check_threads.emplace_back(checker);
+  }
+
+  // 按批次顺序写出
+  for (std::size_t next = 0;; ++next) {
+    std::unique_lock<std::mutex> lock(mutex);
+    result_ready.wait(lock, [&] {
+      return results.count(next) != 0 || (input_done && next == total_batches);
+    });
+    auto it = results.find(next);
+    if (it == results.end()) {
+      break;
+    }
+    std::string text = std::move(it->second);
+    results.erase(it);
+    --inflight;
+    lock.unlock();
+    space_ready.notify_one();
+    out.write(text.data(), static_cast<std::streamsize>(text.size()));
+  }
+
+  read_thread.join();
+  for (std::thread &thread : check_threads) {
+    thread.join();
+  }
+  out.flush();
+  return summary;
+}
+
+} // namespace cpp_prop::runtime
+
+#endif // BATCH_CHECK_H
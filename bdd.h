@@ -0,0 +1,465 @@
+#ifndef BDD_H
+#define BDD_H
+
+#include "runtime_formula.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// --- Reduced Ordered BDDs ---
+// 真值表在 30 个变量左右就到头了; ROBDD 是布尔函数的规范形式, 两个公式等价
+// 当且仅当它们的根节点编号相同。BddManager 提供:
+//   - 唯一表 (unique table): 按 (层, 低子节点, 高子节点) 哈希, 相同的节点只建一次
+//   - ITE 计算缓存 (computed table): 直接映射、有损, 记住 ite(f, g, h) 的结果
+//   - 垃圾回收: 从外部句柄 (Bdd) 引用的节点开始标记, 回收其余节点
+// 联结词与 template.h / runtime::Formula 同名, 运行时公式可以直接降级。
+
+namespace cpp_prop::runtime {
+
+class BddManager;
+
+// 指向 BddManager 中节点的句柄。句柄存在期间节点不会被垃圾回收;
+// 句柄不得比它的管理器活得久。
+class Bdd {
+public:
+  Bdd() noexcept = default;
+  Bdd(const Bdd &other) noexcept : manager_(other.manager_), id_(other.id_) {
+    acquire();
+  }
+  Bdd(Bdd &&other) noexcept : manager_(other.manager_), id_(other.id_) {
+    other.manager_ = nullptr;
+  }
+  Bdd &operator=(Bdd other) noexcept {
+    std::swap(manager_, other.manager_);
+    std::swap(id_, other.id_);
+    return *this;
+  }
+  ~Bdd() { release(); }
+
+  // 同一个管理器中, 节点编号相等当且仅当函数相等
+  std::uint32_t id() const { return id_; }
+  bool is_true() const { return id_ == 1; }
+  bool is_false() const { return id_ == 0; }
+
+  friend bool operator==(const Bdd &a, const Bdd &b) {
+    return a.manager_ == b.manager_ && a.id_ == b.id_;
+  }
+  friend bool operator!=(const Bdd &a, const Bdd &b) { return !(a == b); }
+
+private:
+  friend class BddManager;
+  Bdd(BddManager *manager, std::uint32_t id) noexcept
+      : manager_(manager), id_(id) {
+    acquire();
+  }
+  inline void acquire() noexcept;
+  inline void release() noexcept;
+
+  BddManager *manager_ = nullptr;
+  std::uint32_t id_ = 0;
+};
+
+class BddManager {
+public:
+  struct Stats {
+    std::size_t live_nodes = 0;       // 当前节点数 (含两个终结点)
+    std::size_t peak_nodes = 0;       // 节点数峰值
+    std::size_t unique_lookups = 0;   // 唯一表查找次数
+    std::size_t unique_hits = 0;      // 其中找到已有节点的次数
+    std::size_t cache_lookups = 0;    // ITE 缓存查找次数
+    std::size_t cache_hits = 0;       // 其中命中的次数
+    std::size_t gc_runs = 0;          // 垃圾回收次数
+    std::size_t nodes_collected = 0;  // 回收的节点总数
+  };
+
+  static constexpr std::size_t default_cache_size = std::size_t{1} << 18;
+  static constexpr std::size_t default_gc_threshold = std::size_t{1} << 20;
+
+  // 变量顺序默认为 0, 1, ..., num_vars - 1 (变量 0 在根部)
+  explicit BddManager(unsigned num_vars,
+                      std::size_t cache_size = default_cache_size)
+      : BddManager(identity_order(num_vars), cache_size) {}
+
+  // order[level] 是该层的变量
+  explicit BddManager(std::vector<unsigned> order,
+                      std::size_t cache_size = default_cache_size)
+      : order_(std::move(order)), level_of_var_(order_.size()),
+        cache_(round_up_to_power_of_two(cache_size)) {
+    if (order_.size() > Formula::max_vars) {
+      throw std::invalid_argument("BddManager: too many variables");
+    }
+    std::vector<bool> seen(order_.size(), false);
+    for (std::size_t level = 0; level < order_.size(); ++level) {
+      unsigned var = order_[level];
+      if (var >= order_.size() || seen[var]) {
+        throw std::invalid_argument("BddManager: order is not a permutation");
+      }
+      seen[var] = true;
+      level_of_var_[var] = static_cast<std::uint32_t>(level);
+    }
+    const std::uint32_t terminal = terminal_level();
+    nodes_.push_back(Node{terminal, 0, 0});
+    nodes_.push_back(Node{terminal, 1, 1});
+    refs_.assign(2, 0);
+    unique_.assign(1024, kEmpty);
+    stats_.live_nodes = stats_.peak_nodes = 2;
+  }
+
+  BddManager(const BddManager &) = delete;
+  BddManager &operator=(const BddManager &) = delete;
+
+  unsigned num_vars() const { return static_cast<unsigned>(order_.size()); }
+  const std::vector<unsigned> &order() const { return order_; }
+  const Stats &stats() const { return stats_; }
+
+  Bdd constant(bool value) { return Bdd(this, value ? 1 : 0); }
+  Bdd var(unsigned index) {
+    if (index >= num_vars()) {
+      throw std::invalid_argument("BddManager: variable index out of range");
+    }
+    maybe_collect();
+    return Bdd(this, make_node(level_of_var_[index], 0, 1));
+  }
+
+  Bdd Ite(const Bdd &f, const Bdd &g, const Bdd &h) {
+    check_owner(f);
+    check_owner(g);
+    check_owner(h);
+    maybe_collect();
+    return Bdd(this, ite(f.id_, g.id_, h.id_));
+  }
+  Bdd Not(const Bdd &a) { return Ite(a, constant(false), constant(true)); }
+  Bdd And(const Bdd &a, const Bdd &b) { return Ite(a, b, constant(false)); }
+  Bdd Or(const Bdd &a, const Bdd &b) { return Ite(a, constant(true), b); }
+  Bdd Implies(const Bdd &a, const Bdd &b) { return Ite(a, b, constant(true)); }
+  Bdd Equiv(const Bdd &a, const Bdd &b) { return Ite(a, b, Not(b)); }
+
+  // 运行时公式降级为 BDD
+  Bdd build(const Formula &formula) {
+    if (formula.num_vars() > num_vars()) {
+      throw std::invalid_argument(
+          "BddManager: formula uses more variables than the manager");
+    }
+    maybe_collect();
+    // 构造过程中不做垃圾回收, 栈上的裸编号因此保持有效
+    std::vector<std::uint32_t> stack;
+    stack.reserve(formula.stack_depth());
+    for (const Instruction &ins : formula.code()) {
+      switch (ins.op) {
+      case Opcode::Var:
+        stack.push_back(make_node(level_of_var_[ins.var], 0, 1));
+        break;
+      case Opcode::True:
+        stack.push_back(1);
+        break;
+      case Opcode::False:
+        stack.push_back(0);
+        break;
+      case Opcode::Not:
+        stack.back() = ite(stack.back(), 0, 1);
+        break;
+      default: {
+        std::uint32_t b = stack.back();
+        stack.pop_back();
+        std::uint32_t a = stack.back();
+        stack.back() = apply(ins.op, a, b);
+        break;
+      }
+      }
+    }
+    return Bdd(this, stack.back());
+  }
+
+  // 两个公式是否等价 (Equiv<F, G> 是否为重言式)
+  bool equivalent(const Formula &f, const Formula &g) {
+    Bdd a = build(f);
+    Bdd b = build(g);
+    return a == b;
+  }
+
+  // 公式是否为重言式; 否则给出一个反例 (路径上未出现的变量取 0)
+  TautologyResult check_tautology(const Formula &formula) {
+    Bdd f = build(formula);
+    if (f.is_true()) {
+      return {true, 0};
+    }
+    std::uint64_t assignment = 0;
+    std::uint32_t id = f.id_;
+    // 约简后的非终结节点总能到达 0: 优先走不是常真的分支
+    while (id > 1) {
+      const Node &node = nodes_[id];
+      if (node.low != 1) {
+        id = node.low;
+      } else {
+        assignment |= std::uint64_t{1} << order_[node.level];
+        id = node.high;
+      }
+    }
+    return {false, assignment};
+  }
+
+  // f 的节点数 (含终结点), 用来比较不同的变量顺序
+  std::size_t node_count(const Bdd &f) const {
+    check_owner(f);
+    std::vector<bool> seen(nodes_.size(), false);
+    std::vector<std::uint32_t> pending{f.id_};
+    std::size_t count = 0;
+    while (!pending.empty()) {
+      std::uint32_t id = pending.back();
+      pending.pop_back();
+      if (seen[id]) {
+        continue;
+      }
+      seen[id] = true;
+      ++count;
+      if (id > 1) {
+        pending.push_back(nodes_[id].low);
+        pending.push_back(nodes_[id].high);
+      }
+    }
+    return count;
+  }
+
+  // 回收所有不被 Bdd 句柄引用的节点, 并清空 ITE 缓存
+  void collect_garbage() {
+    std::vector<bool> marked(nodes_.size(), false);
+    marked[0] = marked[1] = true;
+    std::vector<std::uint32_t> pending;
+    for (std::uint32_t id = 2; id < nodes_.size(); ++id) {
+      if (refs_[id] > 0) {
+        pending.push_back(id);
+      }
+    }
+    while (!pending.empty()) {
+      std::uint32_t id = pending.back();
+      pending.pop_back();
+      if (marked[id]) {
+        continue;
+      }
+      marked[id] = true;
+      pending.push_back(nodes_[id].low);
+      pending.push_back(nodes_[id].high);
+    }
+    std::size_t collected = 0;
+    for (std::uint32_t id = 2; id < nodes_.size(); ++id) {
+      if (!marked[id] && nodes_[id].level != kFree) {
+        nodes_[id].level = kFree;
+        nodes_[id].low = free_list_;
+        free_list_ = id;
+        ++collected;
+      }
+    }
+    stats_.live_nodes -= collected;
+    stats_.nodes_collected += collected;
+    ++stats_.gc_runs;
+    rebuild_unique(unique_.size());
+    for (CacheEntry &entry : cache_) {
+      entry = CacheEntry{};
+    }
+  }
+
+  // 节点数超过阈值时, 在下一次公开操作开始前自动回收
+  void set_gc_threshold(std::size_t nodes) { gc_threshold_ = nodes; }
+
+private:
+  friend class Bdd;
+
+  struct Node {
+    std::uint32_t level;
+    std::uint32_t low;
+    std::uint32_t high;
+  };
+
+  struct CacheEntry {
+    std::uint32_t f = kEmpty;
+    std::uint32_t g = 0;
+    std::uint32_t h = 0;
+    std::uint32_t result = 0;
+  };
+
+  static constexpr std::uint32_t kEmpty = ~std::uint32_t{0};
+  static constexpr std::uint32_t kFree = ~std::uint32_t{0};
+
+  static std::vector<unsigned> identity_order(unsigned num_vars) {
+    std::vector<unsigned> order(num_vars);
+    std::iota(order.begin(), order.end(), 0u);
+    return order;
+  }
+
+  static std::size_t round_up_to_power_of_two(std::size_t n) {
+    std::size_t size = 1;
+    while (size < n) {
+      size <<= 1;
+    }
+    return size;
+  }
+
+  static std::size_t hash(std::uint32_t a, std::uint32_t b, std::uint32_t c) {
+    std::uint64_t h = a * 0x9E3779B97F4A7C15ull;
+    h ^= (h >> 29) + b * 0xBF58476D1CE4E5B9ull;
+    h ^= (h >> 31) + c * 0x94D049BB133111EBull;
+    return static_cast<std::size_t>(h ^ (h >> 32));
+  }
+
+  std::uint32_t terminal_level() const {
+    return static_cast<std::uint32_t>(order_.size());
+  }
+
+  void check_owner(const Bdd &f) const {
+    if (f.manager_ != this) {
+      throw std::invalid_argument("BddManager: Bdd belongs to another manager");
+    }
+  }
+
+  void maybe_collect() {
+    if (stats_.live_nodes > gc_threshold_) {
+      collect_garbage();
+      if (stats_.live_nodes * 2 > gc_threshold_) {
+        gc_threshold_ = stats_.live_nodes * 2;
+      }
+    }
+  }
+
+  std::uint32_t apply(Opcode op, std::uint32_t a, std::uint32_t b) {
+    switch (op) {
+    case Opcode::And:
+      return ite(a, b, 0);
+    case Opcode::Or:
+      return ite(a, 1, b);
+    case Opcode::Implies:
+      return ite(a, b, 1);
+    default:
+      return ite(a, b, ite(b, 0, 1));
+    }
+  }
+
+  // --- 唯一表 ---
+  // 开放寻址、线性探测, 槽中存节点编号
+  std::uint32_t make_node(std::uint32_t level, std::uint32_t low,
+                          std::uint32_t high) {
+    if (low == high) {
+      return low;
+    }
+    ++stats_.unique_lookups;
+    std::size_t mask = unique_.size() - 1;
+    std::size_t slot = hash(level, low, high) & mask;
+    while (unique_[slot] != kEmpty) {
+      const Node &node = nodes_[unique_[slot]];
+      if (node.level == level && node.low == low && node.high == high) {
+        ++stats_.unique_hits;
+        return unique_[slot];
+      }
+      slot = (slot + 1) & mask;
+    }
+    std::uint32_t id;
+    if (free_list_ != kEmpty) {
+      id = free_list_;
+      free_list_ = nodes_[id].low;
+      nodes_[id] = Node{level, low, high};
+    } else {
+      id = static_cast<std::uint32_t>(nodes_.size());
+      nodes_.push_back(Node{level, low, high});
+      refs_.push_back(0);
+    }
+    unique_[slot] = id;
+    if (++stats_.live_nodes > stats_.peak_nodes) {
+      stats_.peak_nodes = stats_.live_nodes;
+    }
+    if ((stats_.live_nodes - 2) * 4 > unique_.size() * 3) {
+      rebuild_unique(unique_.size() * 2);
+    }
+    return id;
+  }
+
+  void rebuild_unique(std::size_t size) {
+    unique_.assign(size, kEmpty);
+    std::size_t mask = size - 1;
+    for (std::uint32_t id = 2; id < nodes_.size(); ++id) {
+      const Node &node = nodes_[id];
+      if (node.level == kFree) {
+        continue;
+      }
+      std::size_t slot = hash(node.level, node.low, node.high) & mask;
+      while (unique_[slot] != kEmpty) {
+        slot = (slot + 1) & mask;
+      }
+      unique_[slot] = id;
+    }
+  }
+
+  // --- ITE ---
+  std::uint32_t ite(std::uint32_t f, std::uint32_t g, std::uint32_t h) {
+    if (f == 1) {
+      return g;
+    }
+    if (f == 0) {
+      return h;
+    }
+    if (g == h) {
+      return g;
+    }
+    if (g == 1 && h == 0) {
+      return f;
+    }
+    ++stats_.cache_lookups;
+    CacheEntry &entry = cache_[hash(f, g, h) & (cache_.size() - 1)];
+    if (entry.f == f && entry.g == g && entry.h == h) {
+      ++stats_.cache_hits;
+      return entry.result;
+    }
+    std::uint32_t level = nodes_[f].level;
+    if (nodes_[g].level < level) {
+      level = nodes_[g].level;
+    }
+    if (nodes_[h].level < level) {
+      level = nodes_[h].level;
+    }
+    std::uint32_t low = ite(cofactor(f, level, false), cofactor(g, level, false),
+                            cofactor(h, level, false));
+    std::uint32_t high = ite(cofactor(f, level, true), cofactor(g, level, true),
+                             cofactor(h, level, true));
+    std::uint32_t result = make_node(level, low, high);
+    // 递归可能覆盖同一个槽, 重新取引用
+    cache_[hash(f, g, h) & (cache_.size() - 1)] = CacheEntry{f, g, h, result};
+    return result;
+  }
+
+  std::uint32_t cofactor(std::uint32_t id, std::uint32_t level,
+                         bool value) const {
+    const Node &node = nodes_[id];
+    if (node.level != level) {
+      return id;
+    }
+    return value ? node.high : node.low;
+  }
+
+  std::vector<unsigned> order_;
+  std::vector<std::uint32_t> level_of_var_;
+  std::vector<Node> nodes_;
+  std::vector<std::uint32_t> refs_; // 每个节点的外部句柄数
+  std::vector<std::uint32_t> unique_;
+  std::vector<CacheEntry> cache_;
+  std::uint32_t free_list_ = kEmpty;
+  std::size_t gc_threshold_ = default_gc_threshold;
+  Stats stats_;
+};
+
+inline void Bdd::acquire() noexcept {
+  if (manager_ != nullptr) {
+    ++manager_->refs_[id_];
+  }
+}
+
+inline void Bdd::release() noexcept {
+  if (manager_ != nullptr) {
+    --manager_->refs_[id_];
+  }
+}
+
+} // namespace cpp_prop::runtime
+
+#endif // BDD_H
@@ -0,0 +1,336 @@
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// compile_bench: 编译期开销的基准与回归检查。
+//
+//   compile_bench --compiler CXX --include DIR --workdir DIR --baseline FILE [--update]
+//       为每个规模生成一个翻译单元, 用 CXX 编译 (-c -O0), 记录墙钟时间、峰值 RSS
+//       与模板类实例化个数; 与 FILE 中的基线比较, 有回归时退出码为 1。
+//       给出 --update 时把这次的结果写回 FILE。
+//
+// 实例化个数: clang 用 -ftime-trace 统计 InstantiateClass 事件, GCC 用
+// -fdump-lang-class 统计带模板实参的类。两者口径不同, 所以基线记录了编译器名,
+// 编译器不同时只比较时间和内存。
+//
+// 工作负载:
+//   template_vars_N    template.h: N 个变量的蕴含链重言式 (IsTautology)
+//   peano_multiply_K   peano.h: 一元 Multiply<K, K>
+//   peano_binary_K     peano.h: 二进制 BinMultiply, 操作数约为 K
+//   proof_depth_D      constructive_logic.h: D 层嵌套的 ¬¬ 证明类型, 由 syllogism 串联
+
+namespace {
+
+struct Workload {
+  std::string name;
+  std::string source;
+};
+
+struct Measurement {
+  double wall_ms = 0;
+  long rss_kb = 0;
+  long instantiations = -1; // -1 表示不可用
+};
+
+std::string var_list(unsigned n, const char *prefix) {
+  std::string out;
+  for (unsigned i = 0; i < n; ++i) {
+    out += (i ? ", " : "") + std::string(prefix) + std::to_string(i);
+  }
+  return out;
+}
+
+// (V0 → V1) ∧ (V1 → V2) ∧ ... → (V0 → V{n-1})
+Workload template_vars(unsigned n) {
+  std::string premises = "Implies<V0, V1>";
+  for (unsigned i = 1; i + 1 < n; ++i) {
+    premises = "And<" + premises + ", Implies<V" + std::to_string(i) + ", V" +
+               std::to_string(i + 1) + ">>";
+  }
+  std::ostringstream src;
+  src << "#include \"template.h\"\nusing namespace cpp_prop;\n"
+      << "template <" << var_list(n, "typename V") << ">\n"
+      << "using Chain = Implies<" << premises << ", Implies<V0, V" << n - 1 << ">>;\n"
+      << "static_assert(is_tautology_v<Chain, " << n << ">);\n";
+  return {"template_vars_" + std::to_string(n), src.str()};
+}
+
+Workload peano_multiply(unsigned k) {
+  std::ostringstream src;
+  src << "#include \"peano.h\"\n"
+      << "static_assert(to_value<Multiply<Nat<" << k << ">, Nat<" << k << ">>::type> == "
+      << k * k << "ull);\n";
+  return {"peano_multiply_" + std::to_string(k), src.str()};
+}
+
+Workload peano_binary(unsigned long long k) {
+  std::ostringstream src;
+  src << "#include \"peano.h\"\n"
+      << "static_assert(bin_value_v<BinMultiply<MakeBin<" << k << "ull>::type, MakeBin<" << k + 1
+      << "ull>::type>::type> == " << k * (k + 1) << "ull);\n";
+  return {"peano_binary_" + std::to_string(k), src.str()};
+}
+
+// T → ¬¬T → ¬¬¬¬T → ..., 每一步是 double_negation_intro, 用 syllogism 串成一个证明
+Workload proof_depth(unsigned depth) {
+  std::ostringstream src;
+  src << "#include \"constructive_logic.h\"\nstruct T {};\n"
+      << "template <typename A> using NN = Not<Not<A>>;\n"
+      << "using P0 = T;\n";
+  for (unsigned i = 1; i <= depth; ++i) {
+    src << "using P" << i << " = NN<P" << i - 1 << ">;\n";
+  }
+  src << "Implies<P0, P" << depth << "> chain() {\n"
+      << "  Implies<P0, P1> s1 = double_negation_intro<P0>();\n";
+  for (unsigned i = 1; i < depth; ++i) {
+    src << "  Implies<P0, P" << i + 1 << "> s" << i + 1 << " = syllogism<P0, P" << i << ", P"
+        << i + 1 << ">(s" << i << ", double_negation_intro<P" << i << ">());\n";
+  }
+  src << "  return s" << depth << ";\n}\n";
+  return {"proof_depth_" + std::to_string(depth), src.str()};
+}
+
+std::vector<Workload> workloads() {
+  std::vector<Workload> all;
+  for (unsigned n : {4u, 8u, 12u, 14u}) {
+    all.push_back(template_vars(n));
+  }
+  for (unsigned k : {8u, 16u, 24u}) {
+    all.push_back(peano_multiply(k));
+  }
+  for (unsigned long long k : {1000ull, 1000000ull, 1000000000ull}) {
+    all.push_back(peano_binary(k));
+  }
+  for (unsigned d : {4u, 8u, 16u}) {
+    all.push_back(proof_depth(d));
+  }
+  return all;
+}
+
+std::string read_file(const std::string &path) {
+  std::ifstream in(path, std::ios::binary);
+  std::ostringstream contents;
+  contents << in.rdbuf();
+  return contents.str();
+}
+
+std::size_t count_occurrences(const std::string &text, const std::string &needle) {
+  std::size_t count = 0;
+  for (std::size_t pos = text.find(needle); pos != std::string::npos;
+       pos = text.find(needle, pos + needle.size())) {
+    ++count;
+  }
+  return count;
+}
+
+// -fdump-lang-class 的输出中带模板实参的类
+std::size_t count_template_classes(const std::string &dump) {
+  std::size_t count = 0;
+  std::istringstream lines(dump);
+  std::string line;
+  while (std::getline(lines, line)) {
+    if (line.rfind("Class ", 0) == 0 && line.find('<') != std::string::npos) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+// 运行一个子进程, 返回退出状态; 峰值 RSS 从 wait4 的 rusage 中取
+int run(const std::vector<std::string> &argv, long &rss_kb) {
+  std::vector<char *> args;
+  for (const std::string &arg : argv) {
+    args.push_back(const_cast<char *>(arg.c_str()));
+  }
+  args.push_back(nullptr);
+  pid_t pid = fork();
+  if (pid < 0) {
+    throw std::runtime_error("fork failed");
+  }
+  if (pid == 0) {
+    execvp(args[0], args.data());
+    _exit(127);
+  }
+  int status = 0;
+  rusage usage{};
+  if (wait4(pid, &status, 0, &usage) < 0) {
+    throw std::runtime_error("wait4 failed");
+  }
+  rss_kb = usage.ru_maxrss;
+  return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+bool is_clang(const std::string &compiler, const std::string &workdir) {
+  std::string path = workdir + "/compiler_version.txt";
+  std::string command = "\"" + compiler + "\" --version > \"" + path + "\" 2>&1";
+  if (std::system(command.c_str()) != 0) {
+    throw std::runtime_error("cannot run " + compiler);
+  }
+  return read_file(path).find("clang") != std::string::npos;
+}
+
+Measurement measure(const Workload &workload, const std::string &compiler, bool clang,
+                    const std::string &include, const std::string &workdir) {
+  std::string source = workdir + "/" + workload.name + ".cpp";
+  std::ofstream(source) << workload.source;
+  std::string object = workdir + "/" + workload.name + ".o";
+  std::vector<std::string> argv = {compiler, "-std=c++17", "-O0", "-I" + include,
+                                   "-c", source, "-o", object};
+  std::string stats;
+  if (clang) {
+    argv.push_back("-ftime-trace");
+    argv.push_back("-ftime-trace-granularity=0");
+    stats = workdir + "/" + workload.name + ".json";
+  } else {
+    stats = workdir + "/" + workload.name + ".class";
+    argv.push_back("-fdump-lang-class=" + stats);
+  }
+
+  Measurement m;
+  auto start = std::chrono::steady_clock::now();
+  int status = run(argv, m.rss_kb);
+  m.wall_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+                  .count();
+  if (status != 0) {
+    throw std::runtime_error(workload.name + ": compilation failed (see " + source + ")");
+  }
+  std::string dump = read_file(stats);
+  if (!dump.empty()) {
+    m.instantiations = static_cast<long>(
+        clang ? count_occurrences(dump, "\"name\":\"InstantiateClass\"")
+              : count_template_classes(dump));
+  }
+  return m;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::string compiler;
+  std::string include;
+  std::string workdir;
+  std::string baseline_path;
+  bool update = false;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "--compiler" && i + 1 < argc) {
+      compiler = argv[++i];
+    } else if (arg == "--include" && i + 1 < argc) {
+      include = argv[++i];
+    } else if (arg == "--workdir" && i + 1 < argc) {
+      workdir = argv[++i];
+    } else if (arg == "--baseline" && i + 1 < argc) {
+      baseline_path = argv[++i];
+    } else if (arg == "--update") {
+      update = true;
+    } else {
+      compiler.clear();
+      break;
+    }
+  }
+  if (compiler.empty() || include.empty() || workdir.empty() || baseline_path.empty()) {
+    std::cerr << "usage: compile_bench --compiler CXX --include DIR --workdir DIR "
+                 "--baseline FILE [--update]\n";
+    return 2;
+  }
+
+  try {
+    if (std::system(("mkdir -p \"" + workdir + "\"").c_str()) != 0) {
+      throw std::runtime_error("cannot create " + workdir);
+    }
+    const bool clang = is_clang(compiler, workdir);
+    const std::string compiler_name = clang ? "clang" : "gcc";
+
+    // 基线: 每行 "名称 编译器 毫秒 RSS(KB) 实例化个数"
+    struct Baseline {
+      std::string compiler;
+      Measurement m;
+    };
+    std::map<std::string, Baseline> baseline;
+    {
+      std::istringstream lines(read_file(baseline_path));
+      std::string line;
+      while (std::getline(lines, line)) {
+        if (line.empty() || line[0] == '#') {
+          continue;
+        }
+        std::istringstream fields(line);
+        std::string name;
+        Baseline b;
+        if (fields >> name >> b.compiler >> b.m.wall_ms >> b.m.rss_kb >> b.m.instantiations) {
+          baseline[name] = b;
+        }
+      }
+    }
+
+    std::ostringstream updated;
+    updated << "# compile_bench baseline: name compiler wall_ms peak_rss_kb instantiations\n"
+            << "# regenerate with: cmake --build <build> --target compile_bench_update\n";
+    int regressions = 0;
+    std::cout << std::left << std::setw(24) << "workload" << std::right << std::setw(10)
+              << "wall ms" << std::setw(12) << "rss KB" << std::setw(12) << "instances"
+              << "  vs baseline\n";
+    for (const Workload &workload : workloads()) {
+      Measurement m = measure(workload, compiler, clang, include, workdir);
+      updated << workload.name << " " << compiler_name << " " << std::fixed
+              << std::setprecision(0) << m.wall_ms << " " << m.rss_kb << " " << m.instantiations
+              << "\n";
+
+      std::string verdict = "no baseline";
+      auto it = baseline.find(workload.name);
+      if (it != baseline.end()) {
+        const Measurement &b = it->second.m;
+        std::vector<std::string> problems;
+        // 时间受机器负载影响大, 容忍度放宽; 内存与实例化个数是确定的
+        if (m.wall_ms > 3 * b.wall_ms + 500) {
+          problems.push_back("time");
+        }
+        if (m.rss_kb > b.rss_kb * 3 / 2 + 32 * 1024) {
+          problems.push_back("memory");
+        }
+        if (it->second.compiler == compiler_name && b.instantiations >= 0 &&
+            m.instantiations > b.instantiations + b.instantiations / 10 + 10) {
+          problems.push_back("instantiations");
+        }
+        verdict = "ok";
+        if (!problems.empty()) {
+          verdict = "REGRESSION:";
+          for (const std::string &p : problems) {
+            verdict += " " + p;
+          }
+          ++regressions;
+        }
+      }
+      std::cout << std::left << std::setw(24) << workload.name << std::right << std::fixed
+                << std::setprecision(0) << std::setw(10) << m.wall_ms << std::setw(12)
+                << m.rss_kb << std::setw(12) << m.instantiations << "  " << verdict << "\n";
+    }
+
+    if (update) {
+      std::ofstream out(baseline_path);
+      out << updated.str();
+      if (!out) {
+        throw std::runtime_error("cannot write " + baseline_path);
+      }
+      std::cout << "baseline written to " << baseline_path << "\n";
+      return 0;
+    }
+    return regressions == 0 ? 0 : 1;
+  } catch (const std::exception &e) {
+    std::cerr << "compile_bench: " << e.what() << "\n";
+    return 2;
+  }
+}
@@ -0,0 +1,303 @@
+#include <benchmark/benchmark.h>
+
+#include "../classical_logic.h"
+#include "../constructive_logic.h"
+#include "../inplace_implies.h"
+#include "../proof_chain.h"
+#include "../static_logic.h"
+#include "../tests/allocation_counter.h"
+
+#include <type_traits>
+#include <utility>
+
+// logic_bench: 证明组合子的运行时微基准。
+//
+// 每个组合子按三种蕴含表示各测一遍, 便于对比:
+//   StdPath      constructive_logic.h 的默认版本 (std::function)
+//   InplacePath  constructive_logic.h + InplacePolicy<64> (inplace_implies.h)
+//   StaticPath   static_logic.h 中的 static_proof 版本 (具体 lambda)
+// 计数器 allocs_per_call 是每次迭代的平均堆分配次数。
+// 命题统一用 int 代替, 证明就是携带一个整数的值。
+
+namespace {
+
+struct StaticPath {};
+using StdPath = StdFunctionPolicy;
+using InplacePath = InplacePolicy<64>;
+
+template <typename Path>
+inline constexpr bool is_static_v = std::is_same_v<Path, StaticPath>;
+
+// 以 Path 的表示构造一个 A → B 的证明
+template <typename Path, typename A, typename F> auto make_proof(F f) {
+  if constexpr (is_static_v<Path>) {
+    return f;
+  } else {
+    return ImpliesWith<A, std::invoke_result_t<F &, A>, Path>(std::move(f));
+  }
+}
+
+template <typename Path> auto increment() {
+  return make_proof<Path, int>([](int x) { return x + 1; });
+}
+
+template <typename Path> auto refute_int() {
+  return make_proof<Path, int>([](int) { return False{}; });
+}
+
+template <typename Path> auto refute_or() {
+  return make_proof<Path, Or<int, int>>([](Or<int, int>) { return False{}; });
+}
+
+// 运行基准循环并报告每次迭代的堆分配次数
+template <typename Body> void measure(benchmark::State &state, Body body) {
+  std::size_t before = allocation_counter::count();
+  for (auto _ : state) {
+    body();
+  }
+  double allocations = static_cast<double>(allocation_counter::count() - before);
+  state.counters["allocs_per_call"] =
+      allocations / static_cast<double>(state.iterations());
+}
+
+// increment 经 syllogism 串联 Depth 次: int → int
+// InplacePolicy 的前提容量是固定的, 所以每一层按上一层结果的容量选择策略
+template <typename Path, unsigned Depth> auto syllogism_chain() {
+  if constexpr (Depth == 1) {
+    return increment<Path>();
+  } else {
+    auto ab = syllogism_chain<Path, Depth - 1>();
+    if constexpr (is_static_v<Path>) {
+      return static_proof::syllogism<int, int, int>(std::move(ab), increment<Path>());
+    } else if constexpr (std::is_same_v<Path, StdPath>) {
+      return syllogism<int, int, int>(std::move(ab), increment<Path>());
+    } else {
+      using Policy = InplacePolicy<decltype(ab)::capacity>;
+      return syllogism<int, int, int, Policy>(
+          std::move(ab), ImpliesWith<int, int, Policy>(increment<Path>()));
+    }
+  }
+}
+
+// --- Constructive combinators ---
+
+template <typename Path> void BM_ModusPonens(benchmark::State &state) {
+  auto f = increment<Path>();
+  int x = 0;
+  measure(state, [&] {
+    if constexpr (is_static_v<Path>) {
+      x = static_proof::modus_ponens(x, f);
+    } else {
+      x = modus_ponens<int, int, Path>(x, f);
+    }
+    benchmark::DoNotOptimize(x);
+  });
+}
+
+template <typename Path, unsigned Depth>
+void BM_SyllogismChainBuild(benchmark::State &state) {
+  measure(state, [&] {
+    auto chain = syllogism_chain<Path, Depth>();
+    benchmark::DoNotOptimize(chain);
+  });
+}
+
+template <typename Path, unsigned Depth>
+void BM_SyllogismChainInvoke(benchmark::State &state) {
+  auto chain = syllogism_chain<Path, Depth>();
+  int x = 0;
+  measure(state, [&] {
+    x = chain(x);
+    benchmark::DoNotOptimize(x);
+  });
+}
+
+// 同样 Depth 个 increment, 由 compose_chain 一次构造为平铺的链
+template <typename Path, std::size_t... Is>
+auto composed_chain(std::index_sequence<Is...>) {
+  if constexpr (is_static_v<Path>) {
+    return static_proof::compose_chain<int>(((void)Is, increment<Path>())...);
+  } else {
+    return compose_chain<int, Path>(((void)Is, increment<Path>())...);
+  }
+}
+
+template <typename Path, unsigned Depth>
+void BM_ComposeChainInvoke(benchmark::State &state) {
+  auto chain = composed_chain<Path>(std::make_index_sequence<Depth>{});
+  int x = 0;
+  measure(state, [&] {
+    x = chain(x);
+    benchmark::DoNotOptimize(x);
+  });
+}
+
+template <typename Path> void BM_AndIntro(benchmark::State &state) {
+  int x = 1;
+  measure(state, [&] {
+    if constexpr (is_static_v<Path>) {
+      auto both = static_proof::and_intro<int, int>()(x)(x + 1);
+      benchmark::DoNotOptimize(both);
+    } else {
+      auto both = and_intro<int, int, Path>()(x)(x + 1);
+      benchmark::DoNotOptimize(both);
+    }
+  });
+}
+
+template <typename Path> void BM_OrElim(benchmark::State &state) {
+  auto left = increment<Path>();
+  auto right = make_proof<Path, int>([](int x) { return x * 2; });
+  int x = 0;
+  measure(state, [&] {
+    Or<int, int> premise{std::in_place_index<1>, x & 7};
+    if constexpr (is_static_v<Path>) {
+      x = static_proof::or_elim<int, int, int>()(premise)(left)(right);
+    } else {
+      x = or_elim<int, int, int, Path>()(premise)(left)(right);
+    }
+    benchmark::DoNotOptimize(x);
+  });
+}
+
+template <typename Path> void BM_DeMorgan1(benchmark::State &state) {
+  auto not_or = refute_or<Path>();
+  int x = 0;
+  measure(state, [&] {
+    if constexpr (is_static_v<Path>) {
+      auto both = static_proof::de_morgan_1<int, int>()(not_or);
+      False f = both.a(x);
+      benchmark::DoNotOptimize(f);
+    } else {
+      auto both = de_morgan_1<int, int, Path>()(not_or);
+      False f = both.a(x);
+      benchmark::DoNotOptimize(f);
+    }
+  });
+}
+
+template <typename Path> void BM_DeMorgan2(benchmark::State &state) {
+  auto not_a = refute_int<Path>();
+  auto not_b = refute_int<Path>();
+  using Premise = And<decltype(not_a), decltype(not_b)>;
+  int x = 0;
+  measure(state, [&] {
+    Or<int, int> premise{std::in_place_index<1>, x};
+    if constexpr (is_static_v<Path>) {
+      False f = static_proof::de_morgan_2<int, int>()(Premise{not_a, not_b})(premise);
+      benchmark::DoNotOptimize(f);
+    } else {
+      False f = de_morgan_2<int, int, Path>()(Premise{not_a, not_b})(premise);
+      benchmark::DoNotOptimize(f);
+    }
+  });
+}
+
+// --- Classical transformers (classical_logic.h) ---
+
+template <typename Path> auto refute_not_int() {
+  return make_proof<Path, Not<int>>([](auto) { return False{}; });
+}
+
+template <typename Path> void BM_DneFromLem(benchmark::State &state) {
+  auto nna = refute_not_int<Path>();
+  int x = 0;
+  measure(state, [&] {
+    Or<int, Not<int>> lem{std::in_place_index<0>, x};
+    if constexpr (is_static_v<Path>) {
+      x = static_proof::prove_dne_from_lem<int>(lem)(nna) + 1;
+    } else {
+      x = prove_dne_from_lem<int>(lem)(nna) + 1;
+    }
+    benchmark::DoNotOptimize(x);
+  });
+}
+
+// DNE 实例会真正调用 ¬¬A, 从而走完整个转换出的证明
+template <typename Path> void BM_PeirceFromDne(benchmark::State &state) {
+  auto f = make_proof<Path, Implies<int, int>>([](auto) { return 2; });
+  if constexpr (is_static_v<Path>) {
+    auto dne = [](auto nna) {
+      nna([](int) { return False{}; });
+      return 1;
+    };
+    measure(state, [&] {
+      int a = static_proof::prove_peirce_from_dne<int, int>(dne)(f);
+      benchmark::DoNotOptimize(a);
+    });
+  } else {
+    Implies<Not<Not<int>>, int> dne = [](Not<Not<int>> nna) {
+      nna([](int) { return False{}; });
+      return 1;
+    };
+    measure(state, [&] {
+      int a = prove_peirce_from_dne<int, int>(dne)(f);
+      benchmark::DoNotOptimize(a);
+    });
+  }
+}
+
+template <typename Path> void BM_DneFromPeirce(benchmark::State &state) {
+  auto peirce = make_proof<Path, Implies<Not<int>, int>>([](auto) { return 3; });
+  auto nna = refute_not_int<Path>();
+  measure(state, [&] {
+    if constexpr (is_static_v<Path>) {
+      int a = static_proof::prove_dne_from_peirce<int>(peirce)(nna);
+      benchmark::DoNotOptimize(a);
+    } else {
+      int a = prove_dne_from_peirce<int, False>(peirce)(nna);
+      benchmark::DoNotOptimize(a);
+    }
+  });
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_ModusPonens, StdPath);
+BENCHMARK_TEMPLATE(BM_ModusPonens, InplacePath);
+BENCHMARK_TEMPLATE(BM_ModusPonens, StaticPath);
+
+BENCHMARK_TEMPLATE(BM_SyllogismChainBuild, StdPath, 4);
+BENCHMARK_TEMPLATE(BM_SyllogismChainBuild, StdPath, 16);
+BENCHMARK_TEMPLATE(BM_SyllogismChainBuild, InplacePath, 4);
+BENCHMARK_TEMPLATE(BM_SyllogismChainBuild, InplacePath, 8);
+BENCHMARK_TEMPLATE(BM_SyllogismChainBuild, StaticPath, 4);
+BENCHMARK_TEMPLATE(BM_SyllogismChainBuild, StaticPath, 16);
+
+// InplacePolicy 下每层闭包约为上一层的两倍, 深度 16 的证明对象过大, 不测
+BENCHMARK_TEMPLATE(BM_SyllogismChainInvoke, StdPath, 4);
+BENCHMARK_TEMPLATE(BM_SyllogismChainInvoke, StdPath, 16);
+BENCHMARK_TEMPLATE(BM_SyllogismChainInvoke, InplacePath, 4);
+BENCHMARK_TEMPLATE(BM_SyllogismChainInvoke, InplacePath, 8);
+BENCHMARK_TEMPLATE(BM_SyllogismChainInvoke, StaticPath, 4);
+BENCHMARK_TEMPLATE(BM_SyllogismChainInvoke, StaticPath, 16);
+
+BENCHMARK_TEMPLATE(BM_ComposeChainInvoke, StdPath, 4);
+BENCHMARK_TEMPLATE(BM_ComposeChainInvoke, StdPath, 16);
+BENCHMARK_TEMPLATE(BM_ComposeChainInvoke, StaticPath, 16);
+
+BENCHMARK_TEMPLATE(BM_AndIntro, StdPath);
+BENCHMARK_TEMPLATE(BM_AndIntro, InplacePath);
+BENCHMARK_TEMPLATE(BM_AndIntro, StaticPath);
+
+BENCHMARK_TEMPLATE(BM_OrElim, StdPath);
+BENCHMARK_TEMPLATE(BM_OrElim, InplacePath);
+BENCHMARK_TEMPLATE(BM_OrElim, StaticPath);
+
+BENCHMARK_TEMPLATE(BM_DeMorgan1, StdPath);
+BENCHMARK_TEMPLATE(BM_DeMorgan1, InplacePath);
+BENCHMARK_TEMPLATE(BM_DeMorgan1, StaticPath);
+
+BENCHMARK_TEMPLATE(BM_DeMorgan2, StdPath);
+BENCHMARK_TEMPLATE(BM_DeMorgan2, InplacePath);
+BENCHMARK_TEMPLATE(BM_DeMorgan2, StaticPath);
+
+// 经典公理转换没有 InplacePolicy 版本
+BENCHMARK_TEMPLATE(BM_DneFromLem, StdPath);
+BENCHMARK_TEMPLATE(BM_DneFromLem, StaticPath);
+BENCHMARK_TEMPLATE(BM_PeirceFromDne, StdPath);
+BENCHMARK_TEMPLATE(BM_PeirceFromDne, StaticPath);
+BENCHMARK_TEMPLATE(BM_DneFromPeirce, StdPath);
+BENCHMARK_TEMPLATE(BM_DneFromPeirce, StaticPath);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,123 @@
+#ifndef CLASSICAL_LOGIC_H
+#define CLASSICAL_LOGIC_H
+
+#include "constructive_logic.h"
+#include "static_logic.h"
+
+// --- Proofs of Equivalence for Classical Logic Axioms ---
+// These functions are "proof transformers". They take the proof of one
+// classical axiom as an argument and return a proof of another.
+
+// Proof: LEM → DNE
+// If we have a proof of (A ∨ ¬A), we can construct a proof of (¬¬A → A).
+template <typename A>
+Implies<Not<Not<A>>, A> prove_dne_from_lem(Or<A, Not<A>> lem_instance) {
+  return [lem_instance](Not<Not<A>> nna) CPP_PROP_NOEXCEPT -> A {
+    // We use or_elim on the provided proof of LEM.
+    // We need to show that both sides of the OR lead to our goal, A.
+
+    // Case 1: The OR gives us A.
+    Implies<A, A> case1 = [](A a) CPP_PROP_NOEXCEPT { return a; };
+
+    // Case 2: The OR gives us ¬A.
+    Implies<Not<A>, A> case2 = [nna](Not<A> na) CPP_PROP_NOEXCEPT -> A {
+      // We have ¬A from this case, and ¬¬A from the function's premise.
+      False f = modus_ponens(na, nna);
+      // From False, we can prove anything, including A.
+      return principle_of_explosion<A>()(f);
+    };
+
+    return or_elim<A, Not<A>, A>()(lem_instance)(case1)(case2);
+  };
+}
+
+// Proof: DNE → Peirce's Law
+// If we have a proof of (¬¬A → A), we can construct a proof of (((A→B)→A)→A).
+template <typename A, typename B>
+Implies<Implies<Implies<A, B>, A>, A>
+prove_peirce_from_dne(Implies<Not<Not<A>>, A> dne_instance) {
+  return [dne_instance](Implies<Implies<A, B>, A> f) CPP_PROP_NOEXCEPT -> A {
+    // To prove A using DNE, we first need to prove ¬¬A.
+    Not<Not<A>> nna = [f](Not<A> na) CPP_PROP_NOEXCEPT -> False {
+      // Assume ¬A (na).
+      // `f` requires a proof of (A → B). Let's construct one.
+      Implies<A, B> a_to_b = [na](A a) CPP_PROP_NOEXCEPT -> B {
+        False contradiction = modus_ponens(a, na);
+        return principle_of_explosion<B>()(contradiction);
+      };
+      A result_A = f(a_to_b);
+      return modus_ponens(result_A, na);
+    };
+    // Now, use the provided DNE proof to get from ¬¬A to A.
+    return dne_instance(nna);
+  };
+}
+
+// Proof: Peirce's Law → DNE
+// If we have a proof of (((A→B)→A)→A), we can construct a proof of (¬¬A → A).
+template <typename A, typename B>
+Implies<Not<Not<A>>, A>
+prove_dne_from_peirce(Implies<Implies<Implies<A, B>, A>, A> peirce_instance) {
+  return [peirce_instance](Not<Not<A>> nna) CPP_PROP_NOEXCEPT -> A {
+    // Specialize Peirce's Law by setting B = False.
+    // It becomes ((A → False) → A) → A, which is (¬A → A) → A.
+    Implies<Implies<Not<A>, A>, A> peirce_specialized = peirce_instance;
+
+    Implies<Not<A>, A> na_to_a = [nna](Not<A> na) CPP_PROP_NOEXCEPT -> A {
+      False f = modus_ponens(na, nna);
+      return principle_of_explosion<A>()(f);
+    };
+
+    return peirce_specialized(na_to_a);
+  };
+}
+
+// --- Static proof transformers ---
+// 同样的三个转换, 基于 static_logic.h 的组合子: 前提与结论都是具体的可调用类型,
+// 没有 std::function, 整条证明链可以内联。¬A、¬¬A 等前提可以是任意满足签名的
+// 可调用对象, 因此内部的闭包以泛型 lambda 接收它们。
+namespace static_proof {
+
+// LEM → DNE: 由 A ∨ ¬A 得到 ¬¬A → A
+template <typename A, typename NotA>
+constexpr auto prove_dne_from_lem(Or<A, NotA> lem) {
+  static_assert(is_implication_v<NotA, A, False>,
+                "prove_dne_from_lem: 右侧必须是 ¬A 的证明");
+  return [lem](auto nna) CPP_PROP_NOEXCEPT -> A {
+    auto same = [](A a) CPP_PROP_NOEXCEPT { return a; };
+    auto absurd = [nna](NotA na) CPP_PROP_NOEXCEPT -> A {
+      return principle_of_explosion<A>()(nna(na));
+    };
+    return or_elim<A, NotA, A>()(lem)(same)(absurd);
+  };
+}
+
+// DNE → Peirce: 由 ¬¬A → A 得到 ((A → B) → A) → A
+template <typename A, typename B, typename Dne>
+constexpr auto prove_peirce_from_dne(Dne dne) {
+  return [dne](auto f) CPP_PROP_NOEXCEPT -> A {
+    // 构造 ¬¬A: 假设 ¬A, 用它构造 A → B 交给 f, 得到 A, 与 ¬A 矛盾
+    auto nna = [f](auto na) CPP_PROP_NOEXCEPT -> False {
+      auto a_to_b = [na](A a) CPP_PROP_NOEXCEPT -> B {
+        return principle_of_explosion<B>()(na(a));
+      };
+      return na(f(a_to_b));
+    };
+    return dne(nna);
+  };
+}
+
+// Peirce → DNE: 取 B = False, 由 (¬A → A) → A 得到 ¬¬A → A
+template <typename A, typename Peirce>
+constexpr auto prove_dne_from_peirce(Peirce peirce) {
+  return [peirce](auto nna) CPP_PROP_NOEXCEPT -> A {
+    auto na_to_a = [nna](auto na) CPP_PROP_NOEXCEPT -> A {
+      return principle_of_explosion<A>()(nna(na));
+    };
+    return peirce(na_to_a);
+  };
+}
+
+} // namespace static_proof
+
+#endif // CLASSICAL_LOGIC_H
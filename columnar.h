@@ -0,0 +1,317 @@
+#ifndef COLUMNAR_H
+#define COLUMNAR_H
+
+#include "simd_lanes.h"
+#include "template.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// --- Columnar Evaluation ---
+// 在观测数据集上求同一个公式的值: 每个变量一列, 第 r 行的值在 words[r / 64]
+// 的第 r % 64 位。公式用表达式模板表示, 构造函数与 template.h 同名
+// (And, Or, Not, Implies, Equiv), 叶子是 column(words); 也可以用 lift<F>(columns)
+// 直接从 template.h 的公式类型得到。
+// 求值时整个公式在一个循环内完成: 每次从各列读入一个 SIMD 宽度的字
+// (AVX-512 8 个, AVX2 4 个, NEON 2 个, 否则 1 个), 按位计算后直接写出或计数,
+// 不为子公式生成中间列 (向量运算见 simd_lanes.h)。数据按块分给多个线程。
+
+namespace cpp_prop::runtime {
+
+namespace detail {
+
+inline unsigned popcount64(std::uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<unsigned>(__builtin_popcountll(x));
+#else
+  x = x - ((x >> 1) & 0x5555555555555555ull);
+  x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+  x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+  return static_cast<unsigned>((x * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+} // namespace detail
+
+// --- 表达式节点 ---
+// 每个节点提供 lane<Lanes>(w) (从第 w 个字起的一个向量, Lanes 见 simd_lanes.h)
+// 与 word(w) (单个字)。
+
+struct ColumnRef {
+  const std::uint64_t *words;
+
+  template <typename Lanes> typename Lanes::Lane lane(std::size_t w) const {
+    return Lanes::load(words + w);
+  }
+  std::uint64_t word(std::size_t w) const { return words[w]; }
+};
+
+struct ColumnConstant {
+  std::uint64_t bits; // 全 0 或全 1
+
+  template <typename Lanes> typename Lanes::Lane lane(std::size_t) const {
+    return Lanes::splat(bits);
+  }
+  std::uint64_t word(std::size_t) const { return bits; }
+};
+
+template <typename E> struct ColumnNot {
+  E e;
+
+  template <typename Lanes> typename Lanes::Lane lane(std::size_t w) const {
+    return Lanes::bit_not(e.template lane<Lanes>(w));
+  }
+  std::uint64_t word(std::size_t w) const { return ~e.word(w); }
+};
+
+template <typename Op, typename L, typename R> struct ColumnBinary {
+  L l;
+  R r;
+
+  template <typename Lanes> typename Lanes::Lane lane(std::size_t w) const {
+    return Op::template lane<Lanes>(l.template lane<Lanes>(w),
+                                     r.template lane<Lanes>(w));
+  }
+  std::uint64_t word(std::size_t w) const { return Op::word(l.word(w), r.word(w)); }
+};
+
+template <typename E> struct IsColumnExpr : std::false_type {};
+template <> struct IsColumnExpr<ColumnRef> : std::true_type {};
+template <> struct IsColumnExpr<ColumnConstant> : std::true_type {};
+template <typename E> struct IsColumnExpr<ColumnNot<E>> : std::true_type {};
+template <typename Op, typename L, typename R>
+struct IsColumnExpr<ColumnBinary<Op, L, R>> : std::true_type {};
+
+template <typename E>
+inline constexpr bool is_column_expr_v = IsColumnExpr<E>::value;
+
+inline ColumnRef column(const std::uint64_t *words) { return ColumnRef{words}; }
+inline ColumnRef column(const std::vector<std::uint64_t> &words) {
+  return ColumnRef{words.data()};
+}
+inline ColumnConstant column_constant(bool value) {
+  return ColumnConstant{value ? ~0ull : 0ull};
+}
+
+// 与 template.h 同名的构造函数; 参数是列表达式时才参与重载
+template <typename E, typename = std::enable_if_t<is_column_expr_v<E>>>
+ColumnNot<E> Not(E e) {
+  return {e};
+}
+template <typename L, typename R,
+          typename = std::enable_if_t<is_column_expr_v<L> && is_column_expr_v<R>>>
+ColumnBinary<simd::AndOp, L, R> And(L l, R r) {
+  return {l, r};
+}
+template <typename L, typename R,
+          typename = std::enable_if_t<is_column_expr_v<L> && is_column_expr_v<R>>>
+ColumnBinary<simd::OrOp, L, R> Or(L l, R r) {
+  return {l, r};
+}
+template <typename L, typename R,
+          typename = std::enable_if_t<is_column_expr_v<L> && is_column_expr_v<R>>>
+ColumnBinary<simd::ImpliesOp, L, R> Implies(L l, R r) {
+  return {l, r};
+}
+template <typename L, typename R,
+          typename = std::enable_if_t<is_column_expr_v<L> && is_column_expr_v<R>>>
+ColumnBinary<simd::EquivOp, L, R> Equiv(L l, R r) {
+  return {l, r};
+}
+
+// --- 从 template.h 提升 (Lifting) ---
+// lift<F>(columns): Var<i> 对应 columns[i], 与 lower<F>() 一样按基类匹配。
+
+namespace detail {
+
+using Columns = const std::uint64_t *const *;
+
+inline ColumnConstant lift_node(const TrueType *, Columns) {
+  return column_constant(true);
+}
+inline ColumnConstant lift_node(const FalseType *, Columns) {
+  return column_constant(false);
+}
+template <std::size_t I> ColumnRef lift_node(const Var<I> *, Columns columns) {
+  return column(columns[I]);
+}
+
+template <typename A> auto lift_node(const cpp_prop::Not<A> *, Columns columns);
+template <typename A, typename B>
+auto lift_node(const cpp_prop::And<A, B> *, Columns columns);
+template <typename A, typename B>
+auto lift_node(const cpp_prop::Or<A, B> *, Columns columns);
+template <typename A, typename B>
+auto lift_node(const cpp_prop::Implies<A, B> *, Columns columns);
+template <typename A, typename B>
+auto lift_node(const cpp_prop::Equiv<A, B> *, Columns columns);
+template <typename A, typename B, typename C>
+auto lift_node(const cpp_prop::Syllogism<A, B, C> *, Columns columns);
+
+template <typename F> auto lift_type(Columns columns) {
+  return lift_node(static_cast<const F *>(nullptr), columns);
+}
+
+template <typename A> auto lift_node(const cpp_prop::Not<A> *, Columns columns) {
+  return runtime::Not(lift_type<A>(columns));
+}
+template <typename A, typename B>
+auto lift_node(const cpp_prop::And<A, B> *, Columns columns) {
+  return runtime::And(lift_type<A>(columns), lift_type<B>(columns));
+}
+template <typename A, typename B>
+auto lift_node(const cpp_prop::Or<A, B> *, Columns columns) {
+  return runtime::Or(lift_type<A>(columns), lift_type<B>(columns));
+}
+template <typename A, typename B>
+auto lift_node(const cpp_prop::Implies<A, B> *, Columns columns) {
+  return runtime::Implies(lift_type<A>(columns), lift_type<B>(columns));
+}
+template <typename A, typename B>
+auto lift_node(const cpp_prop::Equiv<A, B> *, Columns columns) {
+  return runtime::Equiv(lift_type<A>(columns), lift_type<B>(columns));
+}
+template <typename A, typename B, typename C>
+auto lift_node(const cpp_prop::Syllogism<A, B, C> *, Columns columns) {
+  using Body = cpp_prop::Implies<
+      cpp_prop::And<cpp_prop::Implies<A, B>, cpp_prop::Implies<B, C>>,
+      cpp_prop::Implies<A, C>>;
+  return lift_type<Body>(columns);
+}
+
+} // namespace detail
+
+template <typename F> auto lift(const std::uint64_t *const *columns) {
+  return detail::lift_type<F>(columns);
+}
+
+// N 元公式模板, 以 Var<0>, ..., Var<N-1> 实例化后提升; 公式内部读取了 ::type 时
+// (见 template.h 的 detail::Symbolic) 提升等价的决策树
+template <template <typename...> class F, std::size_t NVars>
+auto lift(const std::uint64_t *const *columns) {
+  return lift<typename cpp_prop::detail::Symbolic<
+      F, std::make_index_sequence<NVars>>::type>(columns);
+}
+
+// --- 求值 ---
+
+struct ColumnarOptions {
+  unsigned threads = 1;             // 0 表示 std::thread::hardware_concurrency()
+  std::size_t chunk_words = 1 << 14; // 每次取的字数 (128 KiB 每列)
+};
+
+namespace detail {
+
+// 把 [0, words) 按块分给各线程, body(begin, end) 处理一块, 返回值累加
+template <typename Body>
+std::uint64_t for_each_chunk(std::size_t words, std::size_t lane_words,
+                             const ColumnarOptions &options, Body body) {
+  std::size_t chunk = options.chunk_words < lane_words ? lane_words
+                                                       : options.chunk_words;
+  chunk -= chunk % lane_words; // 除最后一块外都是整数个向量
+  std::size_t chunks = (words + chunk - 1) / chunk;
+  unsigned threads = options.threads != 0 ? options.threads
+                                          : std::thread::hardware_concurrency();
+  if (threads == 0) {
+    threads = 1;
+  }
+  if (threads > chunks) {
+    threads = chunks == 0 ? 1 : static_cast<unsigned>(chunks);
+  }
+
+  std::atomic<std::size_t> next{0};
+  std::atomic<std::uint64_t> total{0};
+  auto worker = [&] {
+    std::uint64_t sum = 0;
+    for (std::size_t c = next.fetch_add(1, std::memory_order_relaxed); c < chunks;
+         c = next.fetch_add(1, std::memory_order_relaxed)) {
+      std::size_t begin = c * chunk;
+      std::size_t end = begin + chunk < words ? begin + chunk : words;
+      sum += body(begin, end);
+    }
+    total.fetch_add(sum, std::memory_order_relaxed);
+  };
+  std::vector<std::thread> helpers;
+  helpers.reserve(threads - 1);
+  for (unsigned t = 1; t < threads; ++t) {
+    helpers.emplace_back(worker);
+  }
+  worker();
+  for (std::thread &helper : helpers) {
+    helper.join();
+  }
+  return total.load(std::memory_order_relaxed);
+}
+
+inline std::uint64_t tail_mask(std::size_t rows) {
+  return (1ull << (rows % 64)) - 1;
+}
+
+} // namespace detail
+
+// out 的 (rows + 63) / 64 个字写入每一行的值; 最后一个字中 rows 之后的位为 0。
+// Lanes 默认为本机最宽的指令集
+template <typename Lanes = simd::Native, typename E>
+void evaluate_columns(const E &e, std::size_t rows, std::uint64_t *out,
+                      const ColumnarOptions &options = {}) {
+  static_assert(is_column_expr_v<E>, "evaluate_columns: 参数不是列表达式");
+  std::size_t full = rows / 64;
+  detail::for_each_chunk(full, Lanes::words, options,
+                         [&](std::size_t begin, std::size_t end) {
+    std::size_t w = begin;
+    for (; w + Lanes::words <= end; w += Lanes::words) {
+      Lanes::store(out + w, e.template lane<Lanes>(w));
+    }
+    for (; w < end; ++w) {
+      out[w] = e.word(w);
+    }
+    return std::uint64_t{0};
+  });
+  if (rows % 64 != 0) {
+    out[full] = e.word(full) & detail::tail_mask(rows);
+  }
+}
+
+template <typename Lanes = simd::Native, typename E>
+std::vector<std::uint64_t> evaluate_columns(const E &e, std::size_t rows,
+                                            const ColumnarOptions &options = {}) {
+  std::vector<std::uint64_t> out((rows + 63) / 64);
+  evaluate_columns<Lanes>(e, rows, out.data(), options);
+  return out;
+}
+
+// 公式为真的行数, 不写出结果列
+template <typename Lanes = simd::Native, typename E>
+std::uint64_t count_satisfied(const E &e, std::size_t rows,
+                              const ColumnarOptions &options = {}) {
+  static_assert(is_column_expr_v<E>, "count_satisfied: 参数不是列表达式");
+  std::size_t full = rows / 64;
+  std::uint64_t count = detail::for_each_chunk(
+      full, Lanes::words, options, [&](std::size_t begin, std::size_t end) {
+        std::uint64_t sum = 0;
+        std::size_t w = begin;
+        for (; w + Lanes::words <= end; w += Lanes::words) {
+          std::uint64_t lane[Lanes::words];
+          Lanes::store(lane, e.template lane<Lanes>(w));
+          for (std::uint64_t x : lane) {
+            sum += detail::popcount64(x);
+          }
+        }
+        for (; w < end; ++w) {
+          sum += detail::popcount64(e.word(w));
+        }
+        return sum;
+      });
+  if (rows % 64 != 0) {
+    count += detail::popcount64(e.word(full) & detail::tail_mask(rows));
+  }
+  return count;
+}
+
+} // namespace cpp_prop::runtime
+
+#endif // COLUMNAR_H
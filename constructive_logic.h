@@ -1,18 +1,62 @@
 #ifndef CONSTRUCTIVE_LOGIC_H
 #define CONSTRUCTIVE_LOGIC_H
 
+#include <cstdint>
+#include <cstdlib>
 #include <functional>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
 #include <variant>
 
+#ifdef CPP_PROP_INSTRUMENT
+#include <atomic>
+#include <mutex>
+#endif
+
+// --- Exception-free mode ---
+// 定义 CPP_PROP_NO_EXCEPTIONS (以 -fno-exceptions 编译时自动定义) 时:
+//   False 没有任何值, principle_of_explosion 的闭包体不可达而不是抛出异常;
+//   组合子构造的闭包都声明为 noexcept, 证明链上不再有展开路径。
+// 这种模式下被调用的前提如果抛出异常, 程序直接终止。
+#if !defined(CPP_PROP_NO_EXCEPTIONS) && !defined(__cpp_exceptions)
+#define CPP_PROP_NO_EXCEPTIONS
+#endif
+
+#ifdef CPP_PROP_NO_EXCEPTIONS
+#define CPP_PROP_NOEXCEPT noexcept
+#else
+#define CPP_PROP_NOEXCEPT
+#endif
+
 // --- Core Definitions ---
 
 // Logical values as types
 // 定义逻辑值为类型
 struct True {};
+#ifdef CPP_PROP_NO_EXCEPTIONS
+// False 是空类型: 唯一的构造函数是私有的, 从不被调用
+struct False {
+  False() = delete;
+
+private:
+  struct Never {};
+  constexpr explicit False(Never) noexcept {}
+};
+
+// 只能由 False 的值到达的代码, 例如爆炸原理的闭包体
+[[noreturn]] inline void proof_unreachable() noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_unreachable();
+#elif defined(_MSC_VER)
+  __assume(false);
+#else
+  std::abort();
+#endif
+}
+#else
 struct False {};
+#endif
 
 // Implies (A → B) as a function
 // 蕴含 (Implies): A → B 表示 "若A为真，则B为真"
@@ -35,134 +79,460 @@ template <typename A, typename B> using Or = std::variant<A, B>;
 //    用函数类型表示: A → False
 template <typename A> using Not = Implies<A, False>;
 
+// --- Instrumentation ---
+// 定义 CPP_PROP_INSTRUMENT 编译时, 组合子在热路径上按 (组合子, 事件) 计数:
+//   Construction  组合子构造了一个闭包
+//   Invocation    经类型擦除调用了这个闭包 (modus_ponens 计它调用的前提)
+//   PremiseCopy   闭包被复制, 即复制了它捕获的前提
+//   LeftBranch / RightBranch  or_elim 走了哪一边
+//   Explosion     principle_of_explosion 被调用
+// 计数器是线程局部的, proof_stats::snapshot() 按需汇总所有线程。
+// 未定义时计数宏展开为空, 闭包也不经过包装, snapshot() 恒为零。
+namespace proof_stats {
+
+enum Combinator : unsigned {
+  ModusPonens,
+  AndIntro,
+  AndElimLeft,
+  AndElimRight,
+  OrIntroLeft,
+  OrIntroRight,
+  OrElim,
+  DoubleNegationIntro,
+  PrincipleOfExplosion,
+  Syllogism,
+  ProveSyllogism,
+  ProveSyllogismCurried,
+  Contraposition,
+  Permute,
+  DeMorgan1,
+  Exportation,
+  Importation,
+  DeMorgan2,
+  ReductioAdAbsurdum,
+  ComposeChain, // proof_chain.h
+  combinator_count
+};
+
+enum Event : unsigned {
+  Construction,
+  Invocation,
+  PremiseCopy,
+  LeftBranch,
+  RightBranch,
+  Explosion,
+  event_count
+};
+
+inline const char *name(Combinator c) {
+  static const char *const names[combinator_count] = {
+      "modus_ponens",
+      "and_intro",
+      "and_elim_left",
+      "and_elim_right",
+      "or_intro_left",
+      "or_intro_right",
+      "or_elim",
+      "double_negation_intro",
+      "principle_of_explosion",
+      "syllogism",
+      "prove_syllogism",
+      "prove_syllogism_curried",
+      "contraposition",
+      "permute",
+      "de_morgan_1",
+      "exportation",
+      "importation",
+      "de_morgan_2",
+      "reductio_ad_absurdum",
+      "compose_chain"};
+  return c < combinator_count ? names[c] : "?";
+}
+
+struct Snapshot {
+  std::uint64_t counts[combinator_count][event_count] = {};
+
+  std::uint64_t operator()(Combinator c, Event e) const { return counts[c][e]; }
+  std::uint64_t total(Event e) const {
+    std::uint64_t sum = 0;
+    for (unsigned c = 0; c < combinator_count; ++c) {
+      sum += counts[c][e];
+    }
+    return sum;
+  }
+};
+
+#ifdef CPP_PROP_INSTRUMENT
+
+inline constexpr bool enabled = true;
+
+namespace detail {
+
+// 只有所属线程写入; 用 load + store 而不是 fetch_add, 热路径上没有锁前缀,
+// 汇总线程的并发读取也不是数据竞争
+struct ThreadCounters {
+  std::atomic<std::uint64_t> counts[combinator_count][event_count] = {};
+  // 存活线程的侵入式链表, 注册时不进行堆分配
+  ThreadCounters *prev = nullptr;
+  ThreadCounters *next = nullptr;
+};
+
+struct Registry {
+  std::mutex mutex;
+  ThreadCounters *live = nullptr;
+  Snapshot retired; // 已退出线程的计数
+};
+
+inline Registry &registry() {
+  static Registry instance;
+  return instance;
+}
+
+struct ThreadSlot {
+  ThreadCounters counters;
+
+  ThreadSlot() {
+    Registry &r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    counters.next = r.live;
+    if (r.live != nullptr) {
+      r.live->prev = &counters;
+    }
+    r.live = &counters;
+  }
+  ~ThreadSlot() {
+    Registry &r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (unsigned c = 0; c < combinator_count; ++c) {
+      for (unsigned e = 0; e < event_count; ++e) {
+        r.retired.counts[c][e] += counters.counts[c][e].load(std::memory_order_relaxed);
+      }
+    }
+    (counters.prev != nullptr ? counters.prev->next : r.live) = counters.next;
+    if (counters.next != nullptr) {
+      counters.next->prev = counters.prev;
+    }
+  }
+};
+
+inline void count(Combinator c, Event e) {
+  thread_local ThreadSlot slot;
+  std::atomic<std::uint64_t> &cell = slot.counters.counts[c][e];
+  cell.store(cell.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+// 包装组合子构造的闭包, 统计构造、调用与复制; 大小与 F 相同
+template <Combinator C, typename F> struct Counted {
+  F f;
+
+  explicit Counted(F fn) : f(std::move(fn)) { count(C, Construction); }
+  Counted(const Counted &other) : f(other.f) { count(C, PremiseCopy); }
+  Counted(Counted &&) = default;
+
+  template <typename A>
+  auto operator()(A &&a) const noexcept(noexcept(f(std::forward<A>(a))))
+      -> decltype(f(std::forward<A>(a))) {
+    count(C, Invocation);
+    return f(std::forward<A>(a));
+  }
+};
+
+} // namespace detail
+
+// 汇总所有线程 (包括已退出的线程) 的计数
+inline Snapshot snapshot() {
+  detail::Registry &r = detail::registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  Snapshot result = r.retired;
+  for (const detail::ThreadCounters *counters = r.live; counters != nullptr;
+       counters = counters->next) {
+    for (unsigned c = 0; c < combinator_count; ++c) {
+      for (unsigned e = 0; e < event_count; ++e) {
+        result.counts[c][e] += counters->counts[c][e].load(std::memory_order_relaxed);
+      }
+    }
+  }
+  return result;
+}
+
+#else
+
+inline constexpr bool enabled = false;
+
+inline Snapshot snapshot() { return {}; }
+
+#endif // CPP_PROP_INSTRUMENT
+
+} // namespace proof_stats
+
+#ifdef CPP_PROP_INSTRUMENT
+#define CPP_PROP_COUNT(combinator, event)                                      \
+  ::proof_stats::detail::count(::proof_stats::combinator, ::proof_stats::event)
+#else
+#define CPP_PROP_COUNT(combinator, event) ((void)0)
+#endif
+
+// --- Implication Policies ---
+// 蕴含的表示策略 (Policy):
+//   Policy::implies<A, B>  作为前提被接收的 A → B 的类型
+//   Policy::bind<A>(f)     把组合子内部构造的闭包 f 包装为 A → B 的证明
+// 每个组合子都有一个以 Policy 为最后一个模板参数的版本, 例如
+// or_elim<A, B, C, InplacePolicy<64>>()。不带 Policy 的版本保持原有的
+// 定理签名, 等价于使用 StdFunctionPolicy。
+
+// 默认策略: std::function
+struct StdFunctionPolicy {
+  template <typename A, typename B> using implies = std::function<B(A)>;
+
+  template <typename A, typename F> static auto bind(F f) {
+    return implies<A, std::invoke_result_t<F &, A>>(std::move(f));
+  }
+};
+
+template <typename A, typename B, typename Policy>
+using ImpliesWith = typename Policy::template implies<A, B>;
+
+template <typename A, typename Policy>
+using NotWith = ImpliesWith<A, False, Policy>;
+
+// 包装组合子 C 构造的闭包 f
+template <typename Policy, typename A, proof_stats::Combinator C, typename F>
+auto bind_proof(F f) {
+#ifdef CPP_PROP_INSTRUMENT
+  return Policy::template bind<A>(
+      proof_stats::detail::Counted<C, F>(std::move(f)));
+#else
+  return Policy::template bind<A>(std::move(f));
+#endif
+}
+
 // --- Core Constructive Proofs ---
 
 // Modus Ponens: (A, A → B) → B
 // 5. 验证假言推理 (Modus Ponens): 若A为真且A→B为真，则B为真, 证明: A ∧ (A → B)
 // → B
+template <typename A, typename B, typename Policy>
+B modus_ponens(A a, ImpliesWith<A, B, Policy> f) {
+  CPP_PROP_COUNT(ModusPonens, Invocation);
+  return f(std::move(a));
+}
 template <typename A, typename B> B modus_ponens(A a, Implies<A, B> f) {
-  return f(a); // 调用函数f，将A类型的a转换为B类型的返回值
+  CPP_PROP_COUNT(ModusPonens, Invocation);
+  return f(std::move(a)); // 调用函数f，将A类型的a转换为B类型的返回值
 }
 
 // And Introduction: A → (B → (A ∧ B))
+template <typename A, typename B, typename Policy> auto and_intro() {
+  constexpr auto tag = proof_stats::AndIntro;
+  return bind_proof<Policy, A, tag>([](A a) CPP_PROP_NOEXCEPT {
+    return bind_proof<Policy, B, tag>(
+        [a = std::move(a)](B b) CPP_PROP_NOEXCEPT {
+          return And<A, B>{a, std::move(b)};
+        });
+  });
+}
 template <typename A, typename B>
 Implies<A, Implies<B, And<A, B>>> and_intro() {
-  return [](A a) { return [a](B b) { return And<A, B>{a, b}; }; };
+  return and_intro<A, B, StdFunctionPolicy>();
 }
 
 // And Elimination (Left): (A ∧ B) → A
 // 合取消去 (左)
+template <typename A, typename B, typename Policy> auto and_elim_left() {
+  return bind_proof<Policy, And<A, B>, proof_stats::AndElimLeft>(
+      [](And<A, B> and_ab) CPP_PROP_NOEXCEPT { return std::move(and_ab.a); });
+}
 template <typename A, typename B> Implies<And<A, B>, A> and_elim_left() {
-  return [](And<A, B> and_ab) { return and_ab.a; };
+  return and_elim_left<A, B, StdFunctionPolicy>();
 }
 
 // And Elimination (Right): (A ∧ B) → B
 // 合取消去 (右)
+template <typename A, typename B, typename Policy> auto and_elim_right() {
+  return bind_proof<Policy, And<A, B>, proof_stats::AndElimRight>(
+      [](And<A, B> and_ab) CPP_PROP_NOEXCEPT { return std::move(and_ab.b); });
+}
 template <typename A, typename B> Implies<And<A, B>, B> and_elim_right() {
-  return [](And<A, B> and_ab) { return and_ab.b; };
+  return and_elim_right<A, B, StdFunctionPolicy>();
 }
 
 // Or Introduction (Left): A → A ∨ B
 // 析取引入 (左)
+template <typename A, typename B, typename Policy> auto or_intro_left() {
+  return bind_proof<Policy, A, proof_stats::OrIntroLeft>(
+      [](A a) CPP_PROP_NOEXCEPT {
+        return Or<A, B>{std::in_place_index<0>, std::move(a)};
+      });
+}
 template <typename A, typename B> Implies<A, Or<A, B>> or_intro_left() {
-  return [](A a) { return Or<A, B>{std::in_place_index<0>, a}; };
+  return or_intro_left<A, B, StdFunctionPolicy>();
 }
 
 // Or Introduction (Right): B → A ∨ B
 // 析取引入 (右)
+template <typename A, typename B, typename Policy> auto or_intro_right() {
+  return bind_proof<Policy, B, proof_stats::OrIntroRight>(
+      [](B b) CPP_PROP_NOEXCEPT {
+        return Or<A, B>{std::in_place_index<1>, std::move(b)};
+      });
+}
 template <typename A, typename B> Implies<B, Or<A, B>> or_intro_right() {
-  return [](B b) { return Or<A, B>{std::in_place_index<1>, b}; };
+  return or_intro_right<A, B, StdFunctionPolicy>();
 }
 
 // Or Elimination: (A ∨ B, A → C, B → C) → C
 // 析取消去
-template <typename A, typename B, typename C>
-Implies<Or<A, B>, Implies<Implies<A, C>, Implies<Implies<B, C>, C>>> or_elim() {
-  return [](Or<A, B> or_ab) {
-    return [or_ab](Implies<A, C> ac) {
-      return [or_ab, ac](Implies<B, C> bc) {
+template <typename A, typename B, typename C, typename Policy>
+auto or_elim() {
+  using AC = ImpliesWith<A, C, Policy>;
+  using BC = ImpliesWith<B, C, Policy>;
+  constexpr auto tag = proof_stats::OrElim;
+  return bind_proof<Policy, Or<A, B>, tag>([](Or<A, B> or_ab) CPP_PROP_NOEXCEPT {
+    return bind_proof<Policy, AC, tag>([or_ab = std::move(or_ab)](AC ac) CPP_PROP_NOEXCEPT {
+      return bind_proof<Policy, BC, tag>([or_ab, ac = std::move(ac)](BC bc) CPP_PROP_NOEXCEPT {
         return std::visit(
-            [&](auto &&arg) -> C {
+            [&](auto &&arg) CPP_PROP_NOEXCEPT -> C {
               using T = std::decay_t<decltype(arg)>;
               if constexpr (std::is_same_v<T, A>) {
+                CPP_PROP_COUNT(OrElim, LeftBranch);
                 return ac(arg);
               } else {
+                CPP_PROP_COUNT(OrElim, RightBranch);
                 return bc(arg);
               }
             },
             or_ab);
-      };
-    };
-  };
+      });
+    });
+  });
+}
+template <typename A, typename B, typename C>
+Implies<Or<A, B>, Implies<Implies<A, C>, Implies<Implies<B, C>, C>>> or_elim() {
+  return or_elim<A, B, C, StdFunctionPolicy>();
 }
 
 // Double Negation Introduction: A → ¬¬A
 // 验证双重否定引入 (Double Negation Introduction): A → ¬¬A
+template <typename A, typename Policy> auto double_negation_intro() {
+  constexpr auto tag = proof_stats::DoubleNegationIntro;
+  return bind_proof<Policy, A, tag>([](A a) CPP_PROP_NOEXCEPT { // 假设 A 为真 (premise a)
+    // 假设 ¬A (A→False) 为真 (premise f)
+    return bind_proof<Policy, NotWith<A, Policy>, tag>(
+        [a = std::move(a)](NotWith<A, Policy> f) CPP_PROP_NOEXCEPT {
+          return f(a); // 则 f(a) 推导出 False，从而证明了 ¬(¬A)
+        });
+  });
+}
 template <typename A> Implies<A, Not<Not<A>>> double_negation_intro() {
-  return [](A a) {         // 假设 A 为真 (premise a)
-    return [a](Not<A> f) { // 假设 ¬A (A→False) 为真 (premise f)
-      return f(a);         // 则 f(a) 推导出 False，从而证明了 ¬(¬A)
-    };
-  };
+  return double_negation_intro<A, StdFunctionPolicy>();
 }
 
 // Principle of Explosion (Ex Falso Quodlibet): False → A
+template <typename A, typename Policy> auto principle_of_explosion() {
+  return bind_proof<Policy, False, proof_stats::PrincipleOfExplosion>(
+      [](False f) CPP_PROP_NOEXCEPT -> A {
+        CPP_PROP_COUNT(PrincipleOfExplosion, Explosion);
+#ifdef CPP_PROP_NO_EXCEPTIONS
+        proof_unreachable(); // False 没有值, 这里不可达
+#else
+        throw std::logic_error("Explosion!");
+#endif
+      });
+}
 template <typename A> Implies<False, A> principle_of_explosion() {
-  return [](False f) -> A { throw std::logic_error("Explosion!"); };
+  return principle_of_explosion<A, StdFunctionPolicy>();
 }
 
 // 6. 验证三段论: (A→B) ∧ (B→C) → (A→C)
+template <typename A, typename B, typename C, typename Policy>
+auto syllogism(ImpliesWith<A, B, Policy> ab, ImpliesWith<B, C, Policy> bc) {
+  return bind_proof<Policy, A, proof_stats::Syllogism>(
+      [ab = std::move(ab), bc = std::move(bc)](A a) CPP_PROP_NOEXCEPT {
+        return bc(ab(std::move(a))); // 组合两个函数调用：A→B→C
+      });
+}
 template <typename A, typename B, typename C>
 Implies<A, C> syllogism(Implies<A, B> ab, Implies<B, C> bc) {
-  return [ab, bc](A a) {
-    return bc(ab(a)); // 组合两个函数调用：A→B→C
-  };
+  return syllogism<A, B, C, StdFunctionPolicy>(std::move(ab), std::move(bc));
 }
 
 // 6.1 证明三段论恒为真: ((A→B) ∧ (B→C)) → (A→C)
 // 在构造性逻辑中，一个定理恒为真，意味着我们可以构造一个函数，
 // 该函数可以为任意类型 A, B, C 生成该定理的证明。
 // 这个函数本身就是该定理普遍有效性的证明。
+template <typename A, typename B, typename C, typename Policy>
+auto prove_syllogism() {
+  using AB = ImpliesWith<A, B, Policy>;
+  using BC = ImpliesWith<B, C, Policy>;
+  return bind_proof<Policy, And<AB, BC>, proof_stats::ProveSyllogism>(
+      [](And<AB, BC> premises) CPP_PROP_NOEXCEPT {
+        // 从前提中解构出 A→B 和 B→C
+        AB ab = std::move(premises.a);
+        BC bc = std::move(premises.b);
+        // 基于前提，构造并返回结论 A→C
+        return syllogism<A, B, C, Policy>(std::move(ab), std::move(bc));
+      });
+}
 template <typename A, typename B, typename C>
 Implies<And<Implies<A, B>, Implies<B, C>>, Implies<A, C>> prove_syllogism() {
-  return [](And<Implies<A, B>, Implies<B, C>> premises) {
-    // 从前提中解构出 A→B 和 B→C
-    Implies<A, B> ab = premises.a;
-    Implies<B, C> bc = premises.b;
-    // 基于前提，构造并返回结论 A→C
-    return syllogism(ab, bc);
-  };
+  return prove_syllogism<A, B, C, StdFunctionPolicy>();
 }
 
 // 6.2
 // 柯里化版本: (A→B) → ((B→C) → (A→C))
+template <typename A, typename B, typename C, typename Policy>
+auto prove_syllogism_curried() {
+  using AB = ImpliesWith<A, B, Policy>;
+  using BC = ImpliesWith<B, C, Policy>;
+  constexpr auto tag = proof_stats::ProveSyllogismCurried;
+  return bind_proof<Policy, AB, tag>([](AB ab) CPP_PROP_NOEXCEPT { // 接收第一个前提 P
+    // 返回一个新函数，接收第二个前提 Q
+    return bind_proof<Policy, BC, tag>([ab = std::move(ab)](BC bc) CPP_PROP_NOEXCEPT {
+      return syllogism<A, B, C, Policy>(ab, std::move(bc)); // 返回最终结论 R
+    });
+  });
+}
 template <typename A, typename B, typename C>
 Implies<Implies<A, B>, Implies<Implies<B, C>, Implies<A, C>>>
 prove_syllogism_curried() {
-  return [](Implies<A, B> ab) { // 接收第一个前提 P
-    return [ab](Implies<B, C> bc) { // 返回一个新函数，接收第二个前提 Q
-      return syllogism(ab, bc); // 返回最终结论 R
-    };
-  };
+  return prove_syllogism_curried<A, B, C, StdFunctionPolicy>();
 }
 
 // 8. 验证换质位定律 (Contraposition): (A → B) → (¬B → ¬A)
+template <typename A, typename B, typename Policy> auto contraposition() {
+  using AB = ImpliesWith<A, B, Policy>;
+  using NotB = NotWith<B, Policy>;
+  constexpr auto tag = proof_stats::Contraposition;
+  return bind_proof<Policy, AB, tag>([](AB ab) CPP_PROP_NOEXCEPT { // 假设 A → B
+    // 假设 ¬B
+    return bind_proof<Policy, NotB, tag>([ab = std::move(ab)](NotB not_b) CPP_PROP_NOEXCEPT {
+      // 假设 A
+      return bind_proof<Policy, A, tag>([ab, not_b = std::move(not_b)](A a) CPP_PROP_NOEXCEPT {
+        B b = ab(std::move(a)); // 由 A 和 A→B，得到 B
+        return not_b(std::move(b)); // 由 B 和 ¬B (B→False)，得到 False。从而证明了 ¬A
+      });
+    });
+  });
+}
 template <typename A, typename B>
 Implies<Implies<A, B>, Implies<Not<B>, Not<A>>> contraposition() {
-  return [](Implies<A, B> ab) { // 假设 A → B
-    return [ab](Not<B> not_b) { // 假设 ¬B
-      return [ab, not_b](A a) { // 假设 A
-        B b = ab(a);            // 由 A 和 A→B，得到 B
-        return not_b(b); // 由 B 和 ¬B (B→False)，得到 False。从而证明了 ¬A
-      };
-    };
-  };
+  return contraposition<A, B, StdFunctionPolicy>();
 }
 
 // 9. 验证交换律 (Permutation): (A → (B → C)) → (B → (A → C))
+template <typename A, typename B, typename C, typename Policy>
+auto permute(ImpliesWith<A, ImpliesWith<B, C, Policy>, Policy> f) {
+  constexpr auto tag = proof_stats::Permute;
+  return bind_proof<Policy, B, tag>([f = std::move(f)](B b) CPP_PROP_NOEXCEPT {
+    return bind_proof<Policy, A, tag>(
+        [f, b = std::move(b)](A a) CPP_PROP_NOEXCEPT {
+          return f(std::move(a))(b);
+        });
+  });
+}
 template <typename A, typename B, typename C>
 Implies<B, Implies<A, C>> permute(Implies<A, Implies<B, C>> f) {
-  return [f](B b) { return [f, b](A a) { return f(a)(b); }; };
+  return permute<A, B, C, StdFunctionPolicy>(std::move(f));
 }
 
 // --- 定理: AND --- //
@@ -170,76 +540,182 @@ Implies<B, Implies<A, C>> permute(Implies<A, Implies<B, C>> f) {
 // --- 定理: 德摩根定律 (De Morgan's Laws) --- //
 
 // 14. ¬(A ∨ B) → (¬A ∧ ¬B)
+template <typename A, typename B, typename Policy> auto de_morgan_1() {
+  using NotOr = NotWith<Or<A, B>, Policy>;
+  constexpr auto tag = proof_stats::DeMorgan1;
+  return bind_proof<Policy, NotOr, tag>([](NotOr not_or_ab) CPP_PROP_NOEXCEPT {
+    auto not_a = bind_proof<Policy, A, tag>([not_or_ab](A a) CPP_PROP_NOEXCEPT {
+      return not_or_ab(or_intro_left<A, B, Policy>()(std::move(a)));
+    });
+    auto not_b = bind_proof<Policy, B, tag>(
+        [not_or_ab = std::move(not_or_ab)](B b) CPP_PROP_NOEXCEPT {
+          auto or_intro_right =
+              bind_proof<Policy, B, tag>([](B b_in) CPP_PROP_NOEXCEPT {
+                return Or<A, B>{std::in_place_index<1>, std::move(b_in)};
+              });
+          return not_or_ab(or_intro_right(std::move(b)));
+        });
+    return And<decltype(not_a), decltype(not_b)>{std::move(not_a),
+                                                 std::move(not_b)};
+  });
+}
 template <typename A, typename B>
 Implies<Not<Or<A, B>>, And<Not<A>, Not<B>>> de_morgan_1() {
-  return [](Not<Or<A, B>> not_or_ab) {
-    Not<A> not_a = [not_or_ab](A a) {
-      return not_or_ab(or_intro_left<A, B>()(a));
-    };
-    Not<B> not_b = [not_or_ab](B b) {
-      Implies<B, Or<A, B>> or_intro_right = [](B b_in) {
-        return Or<A, B>{std::in_place_index<1>, b_in};
-      };
-      return not_or_ab(or_intro_right(b));
-    };
-    return And<Not<A>, Not<B>>{not_a, not_b};
-  };
+  return de_morgan_1<A, B, StdFunctionPolicy>();
 }
 
 // 15. 导出规则 (Exportation): ((A ∧ B) → C) → (A → (B → C))
 // 对应函数的 curry 化
+template <typename A, typename B, typename C, typename Policy>
+auto exportation(ImpliesWith<And<A, B>, C, Policy> f) {
+  constexpr auto tag = proof_stats::Exportation;
+  return bind_proof<Policy, A, tag>([f = std::move(f)](A a) CPP_PROP_NOEXCEPT {
+    return bind_proof<Policy, B, tag>([f, a = std::move(a)](B b) CPP_PROP_NOEXCEPT {
+      return f(And<A, B>{a, std::move(b)});
+    });
+  });
+}
 template <typename A, typename B, typename C>
 Implies<A, Implies<B, C>> exportation(Implies<And<A, B>, C> f) {
-  return [f](A a) { return [f, a](B b) { return f(And<A, B>{a, b}); }; };
+  return exportation<A, B, C, StdFunctionPolicy>(std::move(f));
 }
 
 // 16. 导入规则 (Importation): (A → (B → C)) → ((A ∧ B) → C)
 // 对应函数的反 curry 化
+template <typename A, typename B, typename C, typename Policy>
+auto importation(ImpliesWith<A, ImpliesWith<B, C, Policy>, Policy> f) {
+  return bind_proof<Policy, And<A, B>, proof_stats::Importation>(
+      [f = std::move(f)](And<A, B> premises) CPP_PROP_NOEXCEPT {
+        return f(std::move(premises.a))(std::move(premises.b));
+      });
+}
 template <typename A, typename B, typename C>
 Implies<And<A, B>, C> importation(Implies<A, Implies<B, C>> f) {
-  return [f](And<A, B> premises) { return f(premises.a)(premises.b); };
+  return importation<A, B, C, StdFunctionPolicy>(std::move(f));
 }
 
 // 15. (¬A ∧ ¬B) → ¬(A ∨ B)
+template <typename A, typename B, typename Policy> auto de_morgan_2() {
+  using NotA = NotWith<A, Policy>;
+  using NotB = NotWith<B, Policy>;
+  constexpr auto tag = proof_stats::DeMorgan2;
+  return bind_proof<Policy, And<NotA, NotB>, tag>(
+      [](And<NotA, NotB> not_a_and_not_b) CPP_PROP_NOEXCEPT {
+        // We have ¬A and ¬B from the premise
+        NotA not_a =
+            and_elim_left<NotA, NotB, Policy>()(not_a_and_not_b);
+        NotB not_b =
+            and_elim_right<NotA, NotB, Policy>()(not_a_and_not_b);
+
+        // We want to prove ¬(A ∨ B), which is (A ∨ B) → False.
+        // So, we assume (A ∨ B) and try to derive False.
+        return bind_proof<Policy, Or<A, B>, tag>(
+            [not_a = std::move(not_a), not_b = std::move(not_b)](
+                Or<A, B> or_ab) CPP_PROP_NOEXCEPT {
+              // We can use or_elim. It needs a proof of A→C and B→C.
+              // Here, C is False. So we need A→False (¬A) and B→False (¬B),
+              // which we have.
+              auto elim = or_elim<A, B, False, Policy>();
+              return elim(std::move(or_ab))(not_a)(not_b);
+            });
+      });
+}
 template <typename A, typename B>
 Implies<And<Not<A>, Not<B>>, Not<Or<A, B>>> de_morgan_2() {
-  return [](And<Not<A>, Not<B>> not_a_and_not_b) {
-    // We have ¬A and ¬B from the premise
-    Not<A> not_a = and_elim_left<Not<A>, Not<B>>()(not_a_and_not_b);
-    Not<B> not_b = and_elim_right<Not<A>, Not<B>>()(not_a_and_not_b);
-
-    // We want to prove ¬(A ∨ B), which is (A ∨ B) → False.
-    // So, we assume (A ∨ B) and try to derive False.
-    return [not_a, not_b](Or<A, B> or_ab) {
-      // We can use or_elim. It needs a proof of A→C and B→C.
-      // Here, C is False. So we need A→False (¬A) and B→False (¬B), which we
-      // have.
-      Implies<Or<A, B>,
-              Implies<Implies<A, False>, Implies<Implies<B, False>, False>>>
-          elim = or_elim<A, B, False>();
-      return elim(or_ab)(not_a)(not_b);
-    };
-  };
+  return de_morgan_2<A, B, StdFunctionPolicy>();
 }
 
 // 16. (A → B) → ((A → ¬B) → ¬A) (Reductio ad Absurdum)
-template <typename A, typename B>
-Implies<Implies<A, B>, Implies<Implies<A, Not<B>>, Not<A>>>
-reductio_ad_absurdum() {
-  return [](Implies<A, B> a_implies_b) {
-    return [a_implies_b](Implies<A, Not<B>> a_implies_not_b) {
+template <typename A, typename B, typename Policy>
+auto reductio_ad_absurdum() {
+  using AB = ImpliesWith<A, B, Policy>;
+  using ANotB = ImpliesWith<A, NotWith<B, Policy>, Policy>;
+  constexpr auto tag = proof_stats::ReductioAdAbsurdum;
+  return bind_proof<Policy, AB, tag>([](AB a_implies_b) CPP_PROP_NOEXCEPT {
+    return bind_proof<Policy, ANotB, tag>([a_implies_b = std::move(a_implies_b)](
+                                              ANotB a_implies_not_b)
+                                              CPP_PROP_NOEXCEPT {
       // We want to prove ¬A, which is A → False.
       // So, we assume A and try to derive False.
-      return [a_implies_b, a_implies_not_b](A a) {
+      return bind_proof<Policy, A, tag>([a_implies_b,
+                                         a_implies_not_b = std::move(a_implies_not_b)](
+                                            A a) CPP_PROP_NOEXCEPT {
         // From A and A→B, we get B.
-        B b = modus_ponens(a, a_implies_b);
+        B b = modus_ponens<A, B, Policy>(a, a_implies_b);
         // From A and A→¬B, we get ¬B (which is B → False).
-        Not<B> not_b = modus_ponens(a, a_implies_not_b);
+        NotWith<B, Policy> not_b =
+            modus_ponens<A, NotWith<B, Policy>, Policy>(a, a_implies_not_b);
         // From B and ¬B (B → False), we get False.
-        return modus_ponens(b, not_b);
-      };
-    };
-  };
+        return modus_ponens<B, False, Policy>(std::move(b), std::move(not_b));
+      });
+    });
+  });
+}
+template <typename A, typename B>
+Implies<Implies<A, B>, Implies<Implies<A, Not<B>>, Not<A>>>
+reductio_ad_absurdum() {
+  return reductio_ad_absurdum<A, B, StdFunctionPolicy>();
 }
 
+// --- Common Instances ---
+// 默认 (std::function) 策略下常用的组合子实例: 以 True/False 为命题的各种组合
+// (prover.cpp 等示例程序), 以及测试中以 int 为命题的实例。
+// 定义 CPP_PROP_EXTERN_INSTANCES 时 (链接 cpp_prop_proofs 的目标由 CMake 定义),
+// 这些实例只声明为 extern template, 由 proof_instances.cpp 统一实例化一次,
+// 其余翻译单元不再重复实例化组合子及其闭包。
+// 计数与无异常模式改变了组合子的定义, 因此这两种配置下不使用。
+#define CPP_PROP_UNARY_INSTANCES(X, A)                                         \
+  X(Implies<A, Not<Not<A>>> double_negation_intro<A>())                        \
+  X(Implies<False, A> principle_of_explosion<A>())
+
+#define CPP_PROP_BINARY_INSTANCES(X, A, B)                                     \
+  X(B modus_ponens<A, B>(A, Implies<A, B>))                                    \
+  X(Implies<A, Implies<B, And<A, B>>> and_intro<A, B>())                       \
+  X(Implies<And<A, B>, A> and_elim_left<A, B>())                               \
+  X(Implies<And<A, B>, B> and_elim_right<A, B>())                              \
+  X(Implies<A, Or<A, B>> or_intro_left<A, B>())                                \
+  X(Implies<B, Or<A, B>> or_intro_right<A, B>())                               \
+  X(Implies<Implies<A, B>, Implies<Not<B>, Not<A>>> contraposition<A, B>())    \
+  X(Implies<Not<Or<A, B>>, And<Not<A>, Not<B>>> de_morgan_1<A, B>())           \
+  X(Implies<And<Not<A>, Not<B>>, Not<Or<A, B>>> de_morgan_2<A, B>())           \
+  X(Implies<Implies<A, B>, Implies<Implies<A, Not<B>>, Not<A>>>                \
+        reductio_ad_absurdum<A, B>())
+
+#define CPP_PROP_TERNARY_INSTANCES(X, A, B, C)                                 \
+  X(Implies<Or<A, B>, Implies<Implies<A, C>, Implies<Implies<B, C>, C>>>       \
+        or_elim<A, B, C>())                                                    \
+  X(Implies<A, C> syllogism<A, B, C>(Implies<A, B>, Implies<B, C>))            \
+  X(Implies<And<Implies<A, B>, Implies<B, C>>, Implies<A, C>>                  \
+        prove_syllogism<A, B, C>())                                            \
+  X(Implies<Implies<A, B>, Implies<Implies<B, C>, Implies<A, C>>>              \
+        prove_syllogism_curried<A, B, C>())                                    \
+  X(Implies<B, Implies<A, C>> permute<A, B, C>(Implies<A, Implies<B, C>>))     \
+  X(Implies<A, Implies<B, C>> exportation<A, B, C>(Implies<And<A, B>, C>))     \
+  X(Implies<And<A, B>, C> importation<A, B, C>(Implies<A, Implies<B, C>>))
+
+#define CPP_PROP_COMMON_INSTANCES(X)                                           \
+  CPP_PROP_UNARY_INSTANCES(X, True)                                            \
+  CPP_PROP_UNARY_INSTANCES(X, False)                                           \
+  CPP_PROP_BINARY_INSTANCES(X, True, True)                                     \
+  CPP_PROP_BINARY_INSTANCES(X, True, False)                                    \
+  CPP_PROP_BINARY_INSTANCES(X, False, True)                                    \
+  CPP_PROP_BINARY_INSTANCES(X, False, False)                                   \
+  CPP_PROP_TERNARY_INSTANCES(X, True, True, True)                              \
+  CPP_PROP_TERNARY_INSTANCES(X, True, True, False)                             \
+  CPP_PROP_TERNARY_INSTANCES(X, True, False, True)                             \
+  CPP_PROP_TERNARY_INSTANCES(X, True, False, False)                            \
+  CPP_PROP_TERNARY_INSTANCES(X, False, True, True)                             \
+  CPP_PROP_TERNARY_INSTANCES(X, False, True, False)                            \
+  CPP_PROP_TERNARY_INSTANCES(X, False, False, True)                            \
+  CPP_PROP_TERNARY_INSTANCES(X, False, False, False)                           \
+  CPP_PROP_BINARY_INSTANCES(X, int, int)                                       \
+  CPP_PROP_TERNARY_INSTANCES(X, int, int, int)
+
+#if defined(CPP_PROP_EXTERN_INSTANCES) && !defined(CPP_PROP_INSTRUMENT) &&     \
+    !defined(CPP_PROP_NO_EXCEPTIONS)
+#define CPP_PROP_EXTERN_INSTANCE(...) extern template __VA_ARGS__;
+CPP_PROP_COMMON_INSTANCES(CPP_PROP_EXTERN_INSTANCE)
+#undef CPP_PROP_EXTERN_INSTANCE
+#endif
+
 #endif // CONSTRUCTIVE_LOGIC_H
@@ -0,0 +1,404 @@
+#ifndef FORMULA_IO_H
+#define FORMULA_IO_H
+
+#include "runtime_formula.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// --- Formula I/O ---
+// 公式文件的读写: 只读内存映射、文本格式解析器和紧凑的二进制格式。
+// 解析器直接在映射的字节上工作, 变量名是指向输入的 string_view, 不复制行。
+
+namespace cpp_prop::runtime {
+
+// 只读映射整个文件 (POSIX mmap); 失败时抛出 std::system_error
+class MappedFile {
+public:
+  explicit MappedFile(const std::string &path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::system_error(errno, std::generic_category(), path);
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+      int error = errno;
+      ::close(fd);
+      throw std::system_error(error, std::generic_category(), path);
+    }
+    size_ = static_cast<std::size_t>(st.st_size);
+    // 长度为 0 的文件不能映射
+    if (size_ != 0) {
+      void *data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data == MAP_FAILED) {
+        int error = errno;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(), path);
+      }
+      ::madvise(data, size_, MADV_SEQUENTIAL);
+      data_ = static_cast<const char *>(data);
+    }
+    ::close(fd);
+  }
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  MappedFile(MappedFile &&other) noexcept
+      : data_(other.data_), size_(other.size_) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+  }
+  MappedFile &operator=(MappedFile &&other) noexcept {
+    if (this != &other) {
+      unmap();
+      data_ = other.data_;
+      size_ = other.size_;
+      other.data_ = nullptr;
+      other.size_ = 0;
+    }
+    return *this;
+  }
+  ~MappedFile() { unmap(); }
+
+  std::string_view bytes() const { return {data_, size_}; }
+
+private:
+  void unmap() {
+    if (data_ != nullptr) {
+      ::munmap(const_cast<char *>(data_), size_);
+      data_ = nullptr;
+    }
+  }
+
+  const char *data_ = nullptr;
+  std::size_t size_ = 0;
+};
+
+// --- Text Format ---
+// 每行一个公式, 空行与 # 开头的行被跳过。优先级从高到低:
+//   ~F, !F            否定
+//   F & G             合取 (左结合)
+//   F | G             析取 (左结合)
+//   F -> G            蕴含 (右结合)
+//   F <-> G           等价 (右结合)
+// 常量写作 true / false, 括号改变结合。变量名由字母、数字和下划线组成,
+// 在每个公式内按首次出现的顺序编号为 0, 1, 2, ...
+class TextFormulaParser {
+public:
+  // 括号嵌套的上限, 防止恶意输入耗尽调用栈
+  static constexpr std::size_t max_nesting = 1000;
+
+  // 解析一行; 失败时返回 false, 原因见 error()
+  bool parse(std::string_view line, Formula &out) {
+    input_ = line;
+    pos_ = 0;
+    nesting_ = 0;
+    code_.clear();
+    names_.clear();
+    ids_.clear();
+    error_.clear();
+    if (!parse_equiv()) {
+      return false;
+    }
+    skip_space();
+    if (pos_ != input_.size()) {
+      return fail("unexpected input");
+    }
+    out = Formula::from_postfix(code_);
+    return true;
+  }
+
+  // 变量 i 的名字; 指向最近一次 parse 的输入
+  const std::vector<std::string_view> &names() const { return names_; }
+  const std::string &error() const { return error_; }
+
+  // 是否为应当跳过的空行或注释行
+  static bool is_blank(std::string_view line) {
+    for (char c : line) {
+      if (c == '#') {
+        return true;
+      }
+      if (c != ' ' && c != '\t' && c != '\r') {
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  static bool is_name_char(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+           (c >= '0' && c <= '9') || c == '_';
+  }
+
+  bool fail(const char *message) {
+    error_ = message;
+    error_ += " at column ";
+    error_ += std::to_string(pos_ + 1);
+    return false;
+  }
+
+  void skip_space() {
+    while (pos_ < input_.size() &&
+           (input_[pos_] == ' ' || input_[pos_] == '\t' || input_[pos_] == '\r')) {
+      ++pos_;
+    }
+  }
+
+  bool accept(std::string_view token) {
+    skip_space();
+    if (input_.substr(pos_, token.size()) == token) {
+      pos_ += token.size();
+      return true;
+    }
+    return false;
+  }
+
+  // 右结合的链 a op b op c 的后缀形式是 a b c op op, 所以先输出全部操作数
+  // 再输出运算符, 不需要递归
+  bool parse_equiv() {
+    std::size_t count = 0;
+    do {
+      if (!parse_implies()) {
+        return false;
+      }
+      ++count;
+    } while (accept("<->"));
+    code_.insert(code_.end(), count - 1, Instruction{Opcode::Equiv, 0});
+    return true;
+  }
+
+  bool parse_implies() {
+    std::size_t count = 0;
+    do {
+      if (!parse_or()) {
+        return false;
+      }
+      ++count;
+    } while (accept("->"));
+    code_.insert(code_.end(), count - 1, Instruction{Opcode::Implies, 0});
+    return true;
+  }
+
+  bool parse_or() {
+    if (!parse_and()) {
+      return false;
+    }
+    while (accept("|")) {
+      if (!parse_and()) {
+        return false;
+      }
+      code_.push_back(Instruction{Opcode::Or, 0});
+    }
+    return true;
+  }
+
+  bool parse_and() {
+    if (!parse_unary()) {
+      return false;
+    }
+    while (accept("&")) {
+      if (!parse_unary()) {
+        return false;
+      }
+      code_.push_back(Instruction{Opcode::And, 0});
+    }
+    return true;
+  }
+
+  bool parse_unary() {
+    std::size_t negations = 0;
+    while (accept("~") || accept("!")) {
+      ++negations;
+    }
+    skip_space();
+    if (pos_ == input_.size()) {
+      return fail("unexpected end of formula");
+    }
+    if (input_[pos_] == '(') {
+      if (++nesting_ > max_nesting) {
+        return fail("parentheses nested too deeply");
+      }
+      ++pos_;
+      if (!parse_equiv()) {
+        return false;
+      }
+      if (!accept(")")) {
+        return fail("expected ')'");
+      }
+      --nesting_;
+    } else if (is_name_char(input_[pos_])) {
+      std::size_t begin = pos_;
+      while (pos_ < input_.size() && is_name_char(input_[pos_])) {
+        ++pos_;
+      }
+      std::string_view name = input_.substr(begin, pos_ - begin);
+      if (name == "true" || name == "false") {
+        code_.push_back(
+            Instruction{name == "true" ? Opcode::True : Opcode::False, 0});
+      } else {
+        auto [it, inserted] =
+            ids_.emplace(name, static_cast<std::uint32_t>(names_.size()));
+        if (inserted) {
+          names_.push_back(name);
+        }
+        code_.push_back(Instruction{Opcode::Var, it->second});
+      }
+    } else {
+      return fail("expected a variable, constant, '(' or '~'");
+    }
+    code_.insert(code_.end(), negations, Instruction{Opcode::Not, 0});
+    return true;
+  }
+
+  std::string_view input_;
+  std::size_t pos_ = 0;
+  std::size_t nesting_ = 0;
+  std::vector<Instruction> code_;
+  std::vector<std::string_view> names_;
+  std::unordered_map<std::string_view, std::uint32_t> ids_;
+  std::string error_;
+};
+
+// --- Binary Format ---
+// 小端。8 字节文件头: "CPPF"、u16 版本号、u16 保留 (为 0)。之后每条记录是
+// u32 指令数 n 加 n 个 u32 指令字; 指令字的低 3 位是 Opcode, 高 29 位是变量编号。
+// 指令就是 Formula 的后缀序列, 读取时只需校验, 不需要解析。
+// 变量编号可以稀疏 (最大 2^29 - 1); 读取时按编号从小到大重新编号为 0, 1, ...,
+// 所以后续引擎的内存只与记录中出现的变量个数有关, 与编号大小无关。
+inline constexpr char kBinaryMagic[4] = {'C', 'P', 'P', 'F'};
+inline constexpr std::uint16_t kBinaryVersion = 1;
+inline constexpr std::size_t kBinaryHeaderSize = 8;
+inline constexpr std::uint32_t kBinaryMaxVar = (1u << 29) - 1;
+
+namespace detail {
+
+inline std::uint32_t to_little_endian(std::uint32_t x) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  return __builtin_bswap32(x);
+#else
+  return x;
+#endif
+}
+
+inline void append_u32(std::string &out, std::uint32_t x) {
+  x = to_little_endian(x);
+  char bytes[4];
+  std::memcpy(bytes, &x, 4);
+  out.append(bytes, 4);
+}
+
+inline std::uint32_t load_u32(const char *p) {
+  std::uint32_t x;
+  std::memcpy(&x, p, 4);
+  return to_little_endian(x);
+}
+
+} // namespace detail
+
+inline bool is_binary_formula_file(std::string_view bytes) {
+  return bytes.size() >= kBinaryHeaderSize &&
+         bytes.substr(0, 4) == std::string_view(kBinaryMagic, 4);
+}
+
+inline void append_binary_header(std::string &out) {
+  out.append(kBinaryMagic, 4);
+  detail::append_u32(out, kBinaryVersion);
+}
+
+inline void append_binary_formula(std::string &out, const Formula &formula) {
+  detail::append_u32(out, static_cast<std::uint32_t>(formula.code().size()));
+  for (const Instruction &ins : formula.code()) {
+    if (ins.var > kBinaryMaxVar) {
+      throw std::invalid_argument("append_binary_formula: variable index too large");
+    }
+    detail::append_u32(out, ins.var << 3 | static_cast<std::uint32_t>(ins.op));
+  }
+}
+
+// 顺序读取二进制公式文件; 格式错误时抛出 std::runtime_error
+class BinaryFormulaReader {
+public:
+  explicit BinaryFormulaReader(std::string_view bytes) : bytes_(bytes) {
+    if (!is_binary_formula_file(bytes)) {
+      throw std::runtime_error("not a binary formula file");
+    }
+    std::uint32_t version = detail::load_u32(bytes.data() + 4);
+    if ((version & 0xFFFFu) != kBinaryVersion) {
+      throw std::runtime_error("unsupported binary formula version");
+    }
+    pos_ = kBinaryHeaderSize;
+  }
+
+  // 读取下一条记录; 到达末尾时返回 false。out 中的变量 i 对应记录中编号为
+  // variables()[i] 的变量
+  bool next(Formula &out) {
+    if (pos_ == bytes_.size()) {
+      return false;
+    }
+    if (bytes_.size() - pos_ < 4) {
+      throw std::runtime_error("truncated binary formula record");
+    }
+    std::uint32_t count = detail::load_u32(bytes_.data() + pos_);
+    if ((bytes_.size() - pos_ - 4) / 4 < count) {
+      throw std::runtime_error("truncated binary formula record");
+    }
+    // 指令字直接解码为 Formula 拥有的指令序列, 不再经过中间缓冲区
+    const char *p = bytes_.data() + pos_ + 4;
+    std::vector<Instruction> code(count);
+    variables_.clear();
+    for (std::uint32_t i = 0; i < count; ++i) {
+      std::uint32_t word = detail::load_u32(p + 4 * i);
+      code[i] = Instruction{static_cast<Opcode>(word & 7u), word >> 3};
+      if (code[i].op == Opcode::Var) {
+        variables_.push_back(code[i].var);
+      }
+    }
+    pos_ += 4 + std::size_t{4} * count;
+    std::sort(variables_.begin(), variables_.end());
+    variables_.erase(std::unique(variables_.begin(), variables_.end()), variables_.end());
+    if (!variables_.empty() && variables_.back() + 1 != variables_.size()) {
+      for (Instruction &ins : code) {
+        if (ins.op == Opcode::Var) {
+          ins.var = static_cast<std::uint32_t>(
+              std::lower_bound(variables_.begin(), variables_.end(), ins.var) -
+              variables_.begin());
+        }
+      }
+    }
+    try {
+      out = Formula::from_postfix(std::move(code));
+    } catch (const std::invalid_argument &e) {
+      throw std::runtime_error(e.what());
+    }
+    return true;
+  }
+
+  // 上一条记录中出现的变量的原编号, 从小到大
+  const std::vector<std::uint32_t> &variables() const { return variables_; }
+
+  // 下一条记录在文件中的偏移
+  std::size_t offset() const { return pos_; }
+
+private:
+  std::string_view bytes_;
+  std::size_t pos_ = 0;
+  std::vector<std::uint32_t> variables_;
+};
+
+} // namespace cpp_prop::runtime
+
+#endif // FORMULA_IO_H
@@ -0,0 +1,642 @@
+#ifndef FORMULA_KERNEL_H
+#define FORMULA_KERNEL_H
+
+#include "truth_table.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// --- Compiled Formula Kernels ---
+// 构建时就已确定的公式不必在运行时解释后缀指令: type_kernel<F>() 与
+// text_kernel<Text>() 在编译期把 template.h 的公式类型或 constexpr 公式字符串
+// 编译成一段按 Block 计算的直线代码 (真值表引擎 truth_table.h 的位并行运算)。
+// 编译期间:
+//   常量折叠  true/false 参与的联结词、¬¬a、a ∧ a、a → a、a ∧ ¬a 等直接化简
+//   公共子式  结构相同的子公式 (例如 Syllogism 中重复出现的 Implies<A, B>) 只算一次
+//   死代码    化简后不再被引用的子公式被删去
+// 编译结果是一个 FormulaKernel, 可以按名字放进 KernelRegistry;
+// prop_check 的文本输入中 "@名字" 一行就由注册的内核检查。
+
+namespace cpp_prop::runtime {
+
+// 内核程序的一个节点; 操作数是更早节点的下标
+struct KernelNode {
+  Opcode op = Opcode::False;
+  std::uint32_t a = 0; // Var: 变量编号; Not 与二元联结词: 左操作数
+  std::uint32_t b = 0; // 二元联结词: 右操作数
+};
+
+// 容量为 N 的内核程序。add_* 在加入节点的同时做常量折叠和公共子式合并
+template <std::size_t N> struct KernelProgram {
+  KernelNode nodes[N] = {};
+  std::size_t size = 0;
+  std::uint32_t root = 0;
+  unsigned num_vars = 0;
+  // 文本公式中变量 i 的名字在原字符串中的位置
+  std::uint32_t name_begin[N] = {};
+  std::uint32_t name_length[N] = {};
+
+  constexpr bool is(std::uint32_t id, Opcode op) const { return nodes[id].op == op; }
+  // a 与 b 互为否定
+  constexpr bool complementary(std::uint32_t a, std::uint32_t b) const {
+    return (is(a, Opcode::Not) && nodes[a].a == b) ||
+           (is(b, Opcode::Not) && nodes[b].a == a);
+  }
+
+  constexpr std::uint32_t add_node(KernelNode node) {
+    for (std::size_t i = 0; i < size; ++i) {
+      if (nodes[i].op == node.op && nodes[i].a == node.a && nodes[i].b == node.b) {
+        return static_cast<std::uint32_t>(i);
+      }
+    }
+    if (size == N) {
+      throw std::logic_error("KernelProgram: capacity exceeded");
+    }
+    nodes[size] = node;
+    return static_cast<std::uint32_t>(size++);
+  }
+
+  constexpr std::uint32_t add_var(std::uint32_t var) {
+    num_vars = var + 1 > num_vars ? var + 1 : num_vars;
+    return add_node({Opcode::Var, var, 0});
+  }
+
+  constexpr std::uint32_t add_constant(bool value) {
+    return add_node({value ? Opcode::True : Opcode::False, 0, 0});
+  }
+
+  constexpr std::uint32_t add_not(std::uint32_t a) {
+    if (is(a, Opcode::Not)) {
+      return nodes[a].a;
+    }
+    if (is(a, Opcode::True) || is(a, Opcode::False)) {
+      return add_constant(is(a, Opcode::False));
+    }
+    return add_node({Opcode::Not, a, 0});
+  }
+
+  constexpr std::uint32_t add_binary(Opcode op, std::uint32_t a, std::uint32_t b) {
+    const bool ta = is(a, Opcode::True), fa = is(a, Opcode::False);
+    const bool tb = is(b, Opcode::True), fb = is(b, Opcode::False);
+    switch (op) {
+    case Opcode::And:
+      if (fa || fb || complementary(a, b)) {
+        return add_constant(false);
+      }
+      if (ta || a == b) {
+        return b;
+      }
+      if (tb) {
+        return a;
+      }
+      break;
+    case Opcode::Or:
+      if (ta || tb || complementary(a, b)) {
+        return add_constant(true);
+      }
+      if (fa || a == b) {
+        return b;
+      }
+      if (fb) {
+        return a;
+      }
+      break;
+    case Opcode::Implies:
+      if (fa || tb || a == b) {
+        return add_constant(true);
+      }
+      if (ta || complementary(a, b)) {
+        return b; // true → b = b, a → ¬a = ¬a
+      }
+      if (fb) {
+        return add_not(a);
+      }
+      break;
+    default: // Equiv
+      if (a == b) {
+        return add_constant(true);
+      }
+      if (complementary(a, b)) {
+        return add_constant(false);
+      }
+      if (ta) {
+        return b;
+      }
+      if (tb) {
+        return a;
+      }
+      if (fa) {
+        return add_not(b);
+      }
+      if (fb) {
+        return add_not(a);
+      }
+      break;
+    }
+    // 可交换的联结词按操作数排序, 使 a ∧ b 与 b ∧ a 合并
+    if (op != Opcode::Implies && a > b) {
+      std::uint32_t t = a; // std::swap 在 C++17 中不是 constexpr
+      a = b;
+      b = t;
+    }
+    return add_node({op, a, b});
+  }
+
+  // 只保留从 root 可达的节点, 保持先后顺序
+  constexpr KernelProgram compacted() const {
+    bool live[N] = {};
+    live[root] = true;
+    for (std::size_t i = size; i-- > 0;) {
+      if (!live[i]) {
+        continue;
+      }
+      const KernelNode &node = nodes[i];
+      if (node.op == Opcode::Not) {
+        live[node.a] = true;
+      } else if (node.op != Opcode::Var && node.op != Opcode::True &&
+                 node.op != Opcode::False) {
+        live[node.a] = true;
+        live[node.b] = true;
+      }
+    }
+    KernelProgram out;
+    out.num_vars = num_vars;
+    for (std::size_t i = 0; i < N; ++i) {
+      out.name_begin[i] = name_begin[i];
+      out.name_length[i] = name_length[i];
+    }
+    std::uint32_t index[N] = {};
+    for (std::size_t i = 0; i < size; ++i) {
+      if (!live[i]) {
+        continue;
+      }
+      KernelNode node = nodes[i];
+      if (node.op == Opcode::Not) {
+        node.a = index[node.a];
+      } else if (node.op != Opcode::Var && node.op != Opcode::True &&
+                 node.op != Opcode::False) {
+        node.a = index[node.a];
+        node.b = index[node.b];
+      }
+      index[i] = static_cast<std::uint32_t>(out.size);
+      out.nodes[out.size++] = node;
+    }
+    out.root = index[root];
+    return out;
+  }
+};
+
+namespace detail {
+
+// --- template.h 公式类型 → 内核程序 ---
+// 与 lower<F>() 一样按基类匹配
+
+inline constexpr std::size_t count_node(const TrueType *) { return 1; }
+inline constexpr std::size_t count_node(const FalseType *) { return 1; }
+template <std::size_t I> constexpr std::size_t count_node(const Var<I> *) { return 1; }
+template <typename A> constexpr std::size_t count_node(const cpp_prop::Not<A> *);
+template <typename A, typename B>
+constexpr std::size_t count_node(const cpp_prop::And<A, B> *);
+template <typename A, typename B>
+constexpr std::size_t count_node(const cpp_prop::Or<A, B> *);
+template <typename A, typename B>
+constexpr std::size_t count_node(const cpp_prop::Implies<A, B> *);
+template <typename A, typename B>
+constexpr std::size_t count_node(const cpp_prop::Equiv<A, B> *);
+template <typename A, typename B, typename C>
+constexpr std::size_t count_node(const cpp_prop::Syllogism<A, B, C> *);
+
+template <typename F> constexpr std::size_t count_type() {
+  return count_node(static_cast<const F *>(nullptr));
+}
+
+template <typename A> constexpr std::size_t count_node(const cpp_prop::Not<A> *) {
+  return count_type<A>() + 1;
+}
+template <typename A, typename B>
+constexpr std::size_t count_node(const cpp_prop::And<A, B> *) {
+  return count_type<A>() + count_type<B>() + 1;
+}
+template <typename A, typename B>
+constexpr std::size_t count_node(const cpp_prop::Or<A, B> *) {
+  return count_type<A>() + count_type<B>() + 1;
+}
+template <typename A, typename B>
+constexpr std::size_t count_node(const cpp_prop::Implies<A, B> *) {
+  return count_type<A>() + count_type<B>() + 1;
+}
+template <typename A, typename B>
+constexpr std::size_t count_node(const cpp_prop::Equiv<A, B> *) {
+  return count_type<A>() + count_type<B>() + 1;
+}
+
+template <typename A, typename B, typename C> struct SyllogismBody {
+  using type = cpp_prop::Implies<
+      cpp_prop::And<cpp_prop::Implies<A, B>, cpp_prop::Implies<B, C>>,
+      cpp_prop::Implies<A, C>>;
+};
+template <typename A, typename B, typename C>
+constexpr std::size_t count_node(const cpp_prop::Syllogism<A, B, C> *) {
+  return count_type<typename SyllogismBody<A, B, C>::type>();
+}
+
+template <std::size_t N>
+constexpr std::uint32_t emit_node(KernelProgram<N> &p, const TrueType *) {
+  return p.add_constant(true);
+}
+template <std::size_t N>
+constexpr std::uint32_t emit_node(KernelProgram<N> &p, const FalseType *) {
+  return p.add_constant(false);
+}
+template <std::size_t N, std::size_t I>
+constexpr std::uint32_t emit_node(KernelProgram<N> &p, const Var<I> *) {
+  return p.add_var(static_cast<std::uint32_t>(I));
+}
+template <std::size_t N, typename A>
+constexpr std::uint32_t emit_node(KernelProgram<N> &p, const cpp_prop::Not<A> *);
+template <std::size_t N, typename A, typename B>
+constexpr std::uint32_t emit_node(KernelProgram<N> &p, const cpp_prop::And<A, B> *);
+template <std::size_t N, typename A, typename B>
+constexpr std::uint32_t emit_node(KernelProgram<N> &p, const cpp_prop::Or<A, B> *);
+template <std::size_t N, typename A, typename B>
+constexpr std::uint32_t emit_node(KernelProgram<N> &p,
+                                  const cpp_prop::Implies<A, B> *);
+template <std::size_t N, typename A, typename B>
+constexpr std::uint32_t emit_node(KernelProgram<N> &p, const cpp_prop::Equiv<A, B> *);
+template <std::size_t N, typename A, typename B, typename C>
+constexpr std::uint32_t emit_node(KernelProgram<N> &p,
+                                  const cpp_prop::Syllogism<A, B, C> *);
+
+template <typename F, std::size_t N>
+constexpr std::uint32_t emit_type(KernelProgram<N> &p) {
+  return emit_node(p, static_cast<const F *>(nullptr));
+}
+
+template <std::size_t N, typename A>
+constexpr std::uint32_t emit_node(KernelProgram<N> &p, const cpp_prop::Not<A> *) {
+  return p.add_not(emit_type<A>(p));
+}
+template <std::size_t N, typename A, typename B>
+constexpr std::uint32_t emit_node(KernelProgram<N> &p, const cpp_prop::And<A, B> *) {
+  std::uint32_t a = emit_type<A>(p);
+  return p.add_binary(Opcode::And, a, emit_type<B>(p));
+}
+template <std::size_t N, typename A, typename B>
+constexpr std::uint32_t emit_node(KernelProgram<N> &p, const cpp_prop::Or<A, B> *) {
+  std::uint32_t a = emit_type<A>(p);
+  return p.add_binary(Opcode::Or, a, emit_type<B>(p));
+}
+template <std::size_t N, typename A, typename B>
+constexpr std::uint32_t emit_node(KernelProgram<N> &p,
+                                  const cpp_prop::Implies<A, B> *) {
+  std::uint32_t a = emit_type<A>(p);
+  return p.add_binary(Opcode::Implies, a, emit_type<B>(p));
+}
+template <std::size_t N, typename A, typename B>
+constexpr std::uint32_t emit_node(KernelProgram<N> &p, const cpp_prop::Equiv<A, B> *) {
+  std::uint32_t a = emit_type<A>(p);
+  return p.add_binary(Opcode::Equiv, a, emit_type<B>(p));
+}
+template <std::size_t N, typename A, typename B, typename C>
+constexpr std::uint32_t emit_node(KernelProgram<N> &p,
+                                  const cpp_prop::Syllogism<A, B, C> *) {
+  return emit_type<typename SyllogismBody<A, B, C>::type>(p);
+}
+
+template <typename F> constexpr auto compile_type() {
+  KernelProgram<count_type<F>()> p;
+  p.root = emit_type<F>(p);
+  return p.compacted();
+}
+
+// --- constexpr 公式字符串 → 内核程序 ---
+// 语法与 TextFormulaParser 相同 (~ ! & | -> <-> 括号 true false, 变量名任意),
+// 变量按首次出现的顺序编号。语法错误在编译期报告。
+
+constexpr std::size_t text_length(const char *text) {
+  std::size_t n = 0;
+  while (text[n] != '\0') {
+    ++n;
+  }
+  return n;
+}
+
+template <std::size_t N> class TextCompiler {
+public:
+  constexpr explicit TextCompiler(const char *text)
+      : text_(text), length_(text_length(text)) {}
+
+  constexpr KernelProgram<N> compile() {
+    p_.root = parse_equiv();
+    skip_space();
+    if (pos_ != length_) {
+      throw std::invalid_argument("text_kernel: unexpected input");
+    }
+    return p_.compacted();
+  }
+
+private:
+  static constexpr bool is_name_char(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+           (c >= '0' && c <= '9') || c == '_';
+  }
+
+  constexpr void skip_space() {
+    while (pos_ < length_ &&
+           (text_[pos_] == ' ' || text_[pos_] == '\t' || text_[pos_] == '\r')) {
+      ++pos_;
+    }
+  }
+
+  constexpr bool accept(const char *token) {
+    skip_space();
+    std::size_t n = text_length(token);
+    if (pos_ + n > length_) {
+      return false;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      if (text_[pos_ + i] != token[i]) {
+        return false;
+      }
+    }
+    pos_ += n;
+    return true;
+  }
+
+  constexpr bool same_name(std::uint32_t var, std::size_t begin, std::size_t n) const {
+    if (p_.name_length[var] != n) {
+      return false;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      if (text_[p_.name_begin[var] + i] != text_[begin + i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // 右结合: a <-> b <-> c = a <-> (b <-> c), -> 同理
+  constexpr std::uint32_t parse_equiv() {
+    std::uint32_t a = parse_implies();
+    if (accept("<->")) {
+      return p_.add_binary(Opcode::Equiv, a, parse_equiv());
+    }
+    return a;
+  }
+
+  constexpr std::uint32_t parse_implies() {
+    std::uint32_t a = parse_or();
+    if (accept("->")) {
+      return p_.add_binary(Opcode::Implies, a, parse_implies());
+    }
+    return a;
+  }
+
+  constexpr std::uint32_t parse_or() {
+    std::uint32_t a = parse_and();
+    while (accept("|")) {
+      a = p_.add_binary(Opcode::Or, a, parse_and());
+    }
+    return a;
+  }
+
+  constexpr std::uint32_t parse_and() {
+    std::uint32_t a = parse_unary();
+    while (accept("&")) {
+      a = p_.add_binary(Opcode::And, a, parse_unary());
+    }
+    return a;
+  }
+
+  constexpr std::uint32_t parse_unary() {
+    if (accept("~") || accept("!")) {
+      return p_.add_not(parse_unary());
+    }
+    skip_space();
+    if (pos_ == length_) {
+      throw std::invalid_argument("text_kernel: unexpected end of formula");
+    }
+    if (text_[pos_] == '(') {
+      ++pos_;
+      std::uint32_t a = parse_equiv();
+      if (!accept(")")) {
+        throw std::invalid_argument("text_kernel: expected ')'");
+      }
+      return a;
+    }
+    if (!is_name_char(text_[pos_])) {
+      throw std::invalid_argument("text_kernel: expected a variable, constant, '(' or '~'");
+    }
+    std::size_t begin = pos_;
+    while (pos_ < length_ && is_name_char(text_[pos_])) {
+      ++pos_;
+    }
+    std::size_t n = pos_ - begin;
+    if (accept_word(begin, n, "true")) {
+      return p_.add_constant(true);
+    }
+    if (accept_word(begin, n, "false")) {
+      return p_.add_constant(false);
+    }
+    std::uint32_t var = 0;
+    while (var < p_.num_vars && !same_name(var, begin, n)) {
+      ++var;
+    }
+    if (var == p_.num_vars) {
+      p_.name_begin[var] = static_cast<std::uint32_t>(begin);
+      p_.name_length[var] = static_cast<std::uint32_t>(n);
+    }
+    return p_.add_var(var);
+  }
+
+  constexpr bool accept_word(std::size_t begin, std::size_t n, const char *word) const {
+    if (text_length(word) != n) {
+      return false;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      if (text_[begin + i] != word[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  const char *text_;
+  std::size_t length_;
+  std::size_t pos_ = 0;
+  KernelProgram<N> p_;
+};
+
+// --- 直线代码 ---
+// Source::program 是 constexpr 的内核程序; 每个节点展开为一条 Block 运算,
+// 运行时没有分派也没有值栈。
+
+template <typename Source> struct KernelCode {
+  static constexpr auto &program = Source::program;
+
+  template <std::size_t I> static void step(Block *slots, std::uint64_t block) {
+    constexpr KernelNode node = program.nodes[I];
+    if constexpr (node.op == Opcode::Var) {
+      slots[I] = variable_block(node.a, block);
+    } else if constexpr (node.op == Opcode::True || node.op == Opcode::False) {
+      slots[I] = Block::filled(node.op == Opcode::True ? ~0ull : 0ull);
+    } else if constexpr (node.op == Opcode::Not) {
+      slots[I] = slots[node.a];
+      block_not(slots[I]);
+    } else {
+      slots[I] = slots[node.a];
+      if constexpr (node.op == Opcode::And) {
+        block_and(slots[I], slots[node.b]);
+      } else if constexpr (node.op == Opcode::Or) {
+        block_or(slots[I], slots[node.b]);
+      } else if constexpr (node.op == Opcode::Implies) {
+        block_implies(slots[I], slots[node.b]);
+      } else {
+        block_equiv(slots[I], slots[node.b]);
+      }
+    }
+  }
+
+  template <std::size_t... Is>
+  static Block run(std::uint64_t block, std::index_sequence<Is...>) {
+    Block slots[sizeof...(Is)];
+    (step<Is>(slots, block), ...);
+    return slots[program.root];
+  }
+
+  static Block evaluate(std::uint64_t block) {
+    return run(block, std::make_index_sequence<program.size>{});
+  }
+};
+
+template <typename F> struct TypeSource {
+  static constexpr auto program = compile_type<F>();
+};
+
+template <const char *Text> struct TextSource {
+  static constexpr auto program =
+      TextCompiler<text_length(Text) + 1>(Text).compile();
+};
+
+} // namespace detail
+
+// 编译好的内核: evaluate(block) 是第 block 个 Block 上的公式值
+struct FormulaKernel {
+  std::string name;
+  unsigned num_vars = 0;
+  std::size_t nodes = 0;                 // 化简与合并之后的节点数
+  std::vector<std::string_view> names;   // 文本公式的变量名; 类型公式为空
+  Block (*evaluate)(std::uint64_t block) = nullptr;
+};
+
+// template.h 的公式类型, 变量为 Var<i>
+template <typename F> FormulaKernel type_kernel(std::string name) {
+  using Source = detail::TypeSource<F>;
+  return {std::move(name), Source::program.num_vars, Source::program.size, {},
+          &detail::KernelCode<Source>::evaluate};
+}
+
+// N 元公式模板, 以 Var<0>, ..., Var<N-1> 实例化, 例如 type_kernel<Syllogism, 3>("syllogism")
+// 公式内部读取了 ::type 时 (见 template.h 的 detail::Symbolic) 编译等价的决策树
+template <template <typename...> class F, std::size_t NVars>
+FormulaKernel type_kernel(std::string name) {
+  return type_kernel<typename cpp_prop::detail::Symbolic<
+      F, std::make_index_sequence<NVars>>::type>(std::move(name));
+}
+
+// constexpr 公式字符串, 例如
+//   inline constexpr char kPeirce[] = "((p -> q) -> p) -> p";
+//   text_kernel<kPeirce>("peirce")
+template <const char *Text> FormulaKernel text_kernel(std::string name) {
+  using Source = detail::TextSource<Text>;
+  FormulaKernel kernel{std::move(name), Source::program.num_vars,
+                       Source::program.size, {},
+                       &detail::KernelCode<Source>::evaluate};
+  for (unsigned i = 0; i < kernel.num_vars; ++i) {
+    kernel.names.emplace_back(Text + Source::program.name_begin[i],
+                              Source::program.name_length[i]);
+  }
+  return kernel;
+}
+
+// 按编号从小到大检查全部 2^num_vars 个赋值
+inline TautologyResult check_tautology(const FormulaKernel &kernel) {
+  if (kernel.num_vars >= Formula::max_vars) {
+    throw std::invalid_argument("check_tautology: too many variables");
+  }
+  Block value{};
+  std::uint64_t assignment = 0;
+  auto evaluate = [&](std::uint64_t block) -> const Block & {
+    value = kernel.evaluate(block);
+    return value;
+  };
+  if (detail::first_falsifying(kernel.num_vars, 0, detail::num_blocks(kernel.num_vars),
+                               evaluate, assignment)) {
+    return {false, assignment};
+  }
+  return {true, 0};
+}
+
+// --- Registry ---
+// 按名字查找内核。注册通常在静态初始化期间由 CPP_PROP_REGISTER_KERNEL 完成;
+// 返回的指针在注册表的生命期内有效。
+class KernelRegistry {
+public:
+  static KernelRegistry &global() {
+    static KernelRegistry instance;
+    return instance;
+  }
+
+  // 名字已被占用时返回 false
+  bool add(FormulaKernel kernel) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const FormulaKernel &k : kernels_) {
+      if (k.name == kernel.name) {
+        return false;
+      }
+    }
+    kernels_.push_back(std::move(kernel));
+    return true;
+  }
+
+  const FormulaKernel *find(std::string_view name) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const FormulaKernel &k : kernels_) {
+      if (k.name == name) {
+        return &k;
+      }
+    }
+    return nullptr;
+  }
+
+  // 按注册顺序
+  std::vector<const FormulaKernel *> list() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<const FormulaKernel *> out;
+    for (const FormulaKernel &k : kernels_) {
+      out.push_back(&k);
+    }
+    return out;
+  }
+
+private:
+  mutable std::mutex mutex_;
+  std::deque<FormulaKernel> kernels_; // deque: 注册不会使已返回的指针失效
+};
+
+} // namespace cpp_prop::runtime
+
+// 在命名空间作用域注册一个名为 id 的内核, 例如
+//   CPP_PROP_REGISTER_KERNEL(syllogism, cpp_prop::runtime::type_kernel<cpp_prop::Syllogism, 3>)
+#define CPP_PROP_REGISTER_KERNEL(id, ...)                                      \
+  static const bool cpp_prop_kernel_registered_##id =                          \
+      ::cpp_prop::runtime::KernelRegistry::global().add(__VA_ARGS__(#id))
+
+#endif // FORMULA_KERNEL_H
@@ -0,0 +1,363 @@
+#ifndef FORMULA_STORE_H
+#define FORMULA_STORE_H
+
+#include "truth_table.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// --- Hash-Consed Formula DAG ---
+// FormulaStore 中结构相同的子公式只存一份, 节点用编号 NodeId 表示, 所以两个公式
+// 结构相等当且仅当编号相等 (O(1) 比较)。节点按结构数组 (struct-of-arrays) 存放:
+// 操作码、左子节点 (或变量编号)、右子节点各一个连续数组。子节点总是先于父节点
+// 创建, 编号升序就是一个拓扑序。
+// 求值按节点记忆: 同一赋值下, 被多个公式共享的子公式 (例如 Syllogism 中反复
+// 出现的 Implies<A, B>) 只计算一次; 按位并行检查时每个 Block 上也只计算一次。
+
+namespace cpp_prop::runtime {
+
+using NodeId = std::uint32_t;
+
+namespace detail {
+
+// 把 DAG 中的 root 展开为后缀形式, Nodes 提供 op/lhs/rhs。用显式栈直接输出指令,
+// 不为每个子公式保存中间结果, 代价与展开后的长度成正比
+template <typename Nodes>
+Formula expand_postfix(const Nodes &nodes, std::uint32_t root) {
+  std::vector<Instruction> code;
+  std::vector<std::pair<std::uint32_t, bool>> stack{{root, false}};
+  while (!stack.empty()) {
+    auto [id, expanded] = stack.back();
+    stack.pop_back();
+    Opcode op = nodes.op(id);
+    if (op == Opcode::Var) {
+      code.push_back(Instruction{op, nodes.lhs(id)});
+    } else if (op == Opcode::True || op == Opcode::False || expanded) {
+      code.push_back(Instruction{op, 0});
+    } else {
+      stack.emplace_back(id, true);
+      if (op != Opcode::Not) {
+        stack.emplace_back(nodes.rhs(id), false);
+      }
+      stack.emplace_back(nodes.lhs(id), false);
+    }
+  }
+  return Formula::from_postfix(std::move(code));
+}
+
+} // namespace detail
+
+class FormulaStore {
+public:
+  struct Stats {
+    std::size_t nodes = 0;    // 不同节点数
+    std::size_t lookups = 0;  // 构造请求数
+    std::size_t hits = 0;     // 其中命中已有节点的次数
+  };
+
+  FormulaStore() { table_.assign(1024, kEmpty); }
+
+  NodeId var(unsigned index) {
+    if (index > Formula::max_index) {
+      throw std::invalid_argument("FormulaStore: variable index out of range");
+    }
+    return make(Opcode::Var, index, 0);
+  }
+  NodeId constant(bool value) {
+    return make(value ? Opcode::True : Opcode::False, 0, 0);
+  }
+  NodeId Not(NodeId a) { return make(Opcode::Not, check(a), 0); }
+  NodeId And(NodeId a, NodeId b) { return make(Opcode::And, check(a), check(b)); }
+  NodeId Or(NodeId a, NodeId b) { return make(Opcode::Or, check(a), check(b)); }
+  NodeId Implies(NodeId a, NodeId b) {
+    return make(Opcode::Implies, check(a), check(b));
+  }
+  NodeId Equiv(NodeId a, NodeId b) {
+    return make(Opcode::Equiv, check(a), check(b));
+  }
+
+  // 后缀形式的运行时公式 → DAG; 重复的子公式合并
+  NodeId intern(const Formula &formula) {
+    std::vector<NodeId> stack;
+    stack.reserve(formula.stack_depth());
+    for (const Instruction &ins : formula.code()) {
+      switch (ins.op) {
+      case Opcode::Var:
+        stack.push_back(var(ins.var));
+        break;
+      case Opcode::True:
+      case Opcode::False:
+        stack.push_back(constant(ins.op == Opcode::True));
+        break;
+      case Opcode::Not:
+        stack.back() = Not(stack.back());
+        break;
+      default: {
+        NodeId b = stack.back();
+        stack.pop_back();
+        stack.back() = make(ins.op, stack.back(), b);
+        break;
+      }
+      }
+    }
+    return stack.back();
+  }
+
+  // DAG → 后缀形式 (共享的子公式会被展开)
+  Formula to_formula(NodeId root) const {
+    return detail::expand_postfix(*this, check(root));
+  }
+
+  Opcode op(NodeId id) const { return ops_[id]; }
+  // Var 节点的变量编号, 或一元/二元节点的左子节点
+  std::uint32_t lhs(NodeId id) const { return lhs_[id]; }
+  std::uint32_t rhs(NodeId id) const { return rhs_[id]; }
+  std::size_t size() const { return ops_.size(); }
+  const Stats &stats() const { return stats_; }
+
+  // 从 root 可达的节点, 按编号升序 (子节点在父节点之前)
+  std::vector<NodeId> reachable(NodeId root) const {
+    std::vector<bool> seen(check(root) + 1, false);
+    seen[root] = true;
+    // 编号降序扫描: 父节点总在子节点之后, 一遍即可标记完
+    for (NodeId id = root + 1; id-- > 0;) {
+      if (!seen[id]) {
+        continue;
+      }
+      if (ops_[id] == Opcode::Not) {
+        seen[lhs_[id]] = true;
+      } else if (is_binary(ops_[id])) {
+        seen[lhs_[id]] = true;
+        seen[rhs_[id]] = true;
+      }
+    }
+    std::vector<NodeId> nodes;
+    for (NodeId id = 0; id <= root; ++id) {
+      if (seen[id]) {
+        nodes.push_back(id);
+      }
+    }
+    return nodes;
+  }
+
+  // 展开成树后的节点数; 与 reachable(root).size() 之比就是共享带来的压缩
+  std::uint64_t tree_size(NodeId root) const {
+    std::vector<std::uint64_t> sizes(check(root) + 1, 0);
+    for (NodeId id : reachable(root)) {
+      std::uint64_t size = 1;
+      if (ops_[id] == Opcode::Not) {
+        size += sizes[lhs_[id]];
+      } else if (is_binary(ops_[id])) {
+        size += sizes[lhs_[id]] + sizes[rhs_[id]];
+      }
+      sizes[id] = size;
+    }
+    return sizes[root];
+  }
+
+  // 单个赋值上求值。每个节点记住最近一次求值的赋值与结果, 同一赋值下对共享
+  // 子公式 (包括其他根) 的重复求值直接复用。
+  bool eval(NodeId root, std::uint64_t assignment) {
+    check(root);
+    if (memo_valid_.size() < ops_.size()) {
+      memo_valid_.resize(ops_.size(), false);
+      memo_assignment_.resize(ops_.size());
+      memo_value_.resize(ops_.size());
+    }
+    std::vector<NodeId> &pending = eval_stack_;
+    pending.assign(1, root);
+    while (!pending.empty()) {
+      NodeId id = pending.back();
+      if (memoized(id, assignment)) {
+        pending.pop_back();
+        continue;
+      }
+      Opcode op = ops_[id];
+      bool value;
+      if (op == Opcode::Var) {
+        if (lhs_[id] >= Formula::max_vars) {
+          throw std::invalid_argument("FormulaStore: too many variables for eval");
+        }
+        value = ((assignment >> lhs_[id]) & 1u) != 0;
+      } else if (op == Opcode::True || op == Opcode::False) {
+        value = op == Opcode::True;
+      } else if (!memoized(lhs_[id], assignment)) {
+        pending.push_back(lhs_[id]);
+        continue;
+      } else if (op == Opcode::Not) {
+        value = !memo_value_[lhs_[id]];
+      } else if (!memoized(rhs_[id], assignment)) {
+        pending.push_back(rhs_[id]);
+        continue;
+      } else {
+        value = Formula::apply(op, memo_value_[lhs_[id]], memo_value_[rhs_[id]]);
+      }
+      memo_valid_[id] = true;
+      memo_assignment_[id] = assignment;
+      memo_value_[id] = value;
+      pending.pop_back();
+    }
+    return memo_value_[root];
+  }
+
+  // 按位并行检查 root 在 2^num_vars 个赋值下是否恒真; 每个可达节点在每个
+  // Block 上只求值一次, 不论它被引用多少次
+  TautologyResult check_tautology(NodeId root, unsigned num_vars) const {
+    if (num_vars >= Formula::max_vars) {
+      throw std::invalid_argument("FormulaStore: too many variables");
+    }
+    const std::vector<NodeId> nodes = reachable(root);
+    std::vector<std::uint32_t> slot(root + 1);
+    for (std::uint32_t i = 0; i < nodes.size(); ++i) {
+      slot[nodes[i]] = i;
+      if (ops_[nodes[i]] == Opcode::Var && lhs_[nodes[i]] >= num_vars) {
+        throw std::invalid_argument(
+            "FormulaStore: formula uses more variables than num_vars");
+      }
+    }
+    std::vector<Block> values(nodes.size());
+    const std::uint64_t num_blocks =
+        num_vars <= Block::log2_bits
+            ? 1
+            : std::uint64_t{1} << (num_vars - Block::log2_bits);
+    const std::uint64_t total = std::uint64_t{1} << num_vars;
+    for (std::uint64_t block = 0; block < num_blocks; ++block) {
+      for (std::uint32_t i = 0; i < nodes.size(); ++i) {
+        NodeId id = nodes[i];
+        Block &value = values[i];
+        switch (ops_[id]) {
+        case Opcode::Var:
+          value = variable_block(lhs_[id], block);
+          break;
+        case Opcode::True:
+        case Opcode::False:
+          value = Block::filled(ops_[id] == Opcode::True ? ~0ull : 0ull);
+          break;
+        case Opcode::Not:
+          value = values[slot[lhs_[id]]];
+          detail::block_not(value);
+          break;
+        default:
+          value = values[slot[lhs_[id]]];
+          apply_block(ops_[id], value, values[slot[rhs_[id]]]);
+          break;
+        }
+      }
+      const Block &result = values.back();
+      for (std::size_t w = 0; w < Block::words; ++w) {
+        std::uint64_t begin = block * Block::bits + w * 64;
+        if (begin >= total) {
+          break;
+        }
+        std::uint64_t mask =
+            total - begin >= 64 ? ~0ull : (std::uint64_t{1} << (total - begin)) - 1;
+        std::uint64_t falsified = ~result.w[w] & mask;
+        if (falsified != 0) {
+          return {false, begin + static_cast<std::uint64_t>(
+                                     __builtin_ctzll(falsified))};
+        }
+      }
+    }
+    return {true, 0};
+  }
+
+private:
+  static constexpr std::uint32_t kEmpty = ~std::uint32_t{0};
+
+  static bool is_binary(Opcode op) {
+    return op == Opcode::And || op == Opcode::Or || op == Opcode::Implies ||
+           op == Opcode::Equiv;
+  }
+
+  static void apply_block(Opcode op, Block &a, const Block &b) {
+    switch (op) {
+    case Opcode::And:
+      detail::block_and(a, b);
+      break;
+    case Opcode::Or:
+      detail::block_or(a, b);
+      break;
+    case Opcode::Implies:
+      detail::block_implies(a, b);
+      break;
+    default:
+      detail::block_equiv(a, b);
+      break;
+    }
+  }
+
+  static std::size_t hash(Opcode op, std::uint32_t a, std::uint32_t b) {
+    std::uint64_t h = (static_cast<std::uint64_t>(a) << 32 | b) *
+                      0x9E3779B97F4A7C15ull;
+    h ^= static_cast<std::uint64_t>(op) * 0xBF58476D1CE4E5B9ull;
+    return static_cast<std::size_t>(h ^ (h >> 29));
+  }
+
+  NodeId check(NodeId id) const {
+    if (id >= ops_.size()) {
+      throw std::invalid_argument("FormulaStore: unknown node");
+    }
+    return id;
+  }
+
+  bool memoized(NodeId id, std::uint64_t assignment) const {
+    return memo_valid_[id] && memo_assignment_[id] == assignment;
+  }
+
+  NodeId make(Opcode op, std::uint32_t a, std::uint32_t b) {
+    ++stats_.lookups;
+    std::size_t mask = table_.size() - 1;
+    std::size_t slot = hash(op, a, b) & mask;
+    while (table_[slot] != kEmpty) {
+      NodeId id = table_[slot];
+      if (ops_[id] == op && lhs_[id] == a && rhs_[id] == b) {
+        ++stats_.hits;
+        return id;
+      }
+      slot = (slot + 1) & mask;
+    }
+    NodeId id = static_cast<NodeId>(ops_.size());
+    ops_.push_back(op);
+    lhs_.push_back(a);
+    rhs_.push_back(b);
+    table_[slot] = id;
+    stats_.nodes = ops_.size();
+    if (ops_.size() * 4 > table_.size() * 3) {
+      grow();
+    }
+    return id;
+  }
+
+  void grow() {
+    table_.assign(table_.size() * 2, kEmpty);
+    std::size_t mask = table_.size() - 1;
+    for (NodeId id = 0; id < ops_.size(); ++id) {
+      std::size_t slot = hash(ops_[id], lhs_[id], rhs_[id]) & mask;
+      while (table_[slot] != kEmpty) {
+        slot = (slot + 1) & mask;
+      }
+      table_[slot] = id;
+    }
+  }
+
+  // 结构数组
+  std::vector<Opcode> ops_;
+  std::vector<std::uint32_t> lhs_;
+  std::vector<std::uint32_t> rhs_;
+  std::vector<NodeId> table_;
+
+  // 求值记忆
+  std::vector<bool> memo_valid_;
+  std::vector<std::uint64_t> memo_assignment_;
+  std::vector<bool> memo_value_;
+  std::vector<NodeId> eval_stack_;
+
+  Stats stats_;
+};
+
+} // namespace cpp_prop::runtime
+
+#endif // FORMULA_STORE_H
@@ -0,0 +1,166 @@
+#ifndef INPLACE_IMPLIES_H
+#define INPLACE_IMPLIES_H
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// --- Inplace Implies ---
+// 固定容量的类型擦除蕴含 A → B。闭包直接存放在对象内部的缓冲区中,
+// 永远不会进行堆分配; 闭包超过 Capacity 字节时编译失败。
+
+namespace inplace_detail {
+
+// 与容量无关的操作表, 因此不同容量的 InplaceImplies 之间可以互相转换
+template <typename A, typename B> struct Ops {
+  B (*invoke)(void *self, A &&a);
+  void (*copy)(void *dst, const void *src);
+  void (*move)(void *dst, void *src) noexcept;
+  void (*destroy)(void *self) noexcept;
+};
+
+template <typename A, typename B, typename F> const Ops<A, B> *ops_for() {
+  static constexpr Ops<A, B> ops = {
+      [](void *self, A &&a) -> B {
+        return (*static_cast<F *>(self))(std::forward<A>(a));
+      },
+      [](void *dst, const void *src) {
+        ::new (dst) F(*static_cast<const F *>(src));
+      },
+      [](void *dst, void *src) noexcept {
+        ::new (dst) F(std::move(*static_cast<F *>(src)));
+        static_cast<F *>(src)->~F();
+      },
+      [](void *self) noexcept { static_cast<F *>(self)->~F(); }};
+  return &ops;
+}
+
+} // namespace inplace_detail
+
+template <typename A, typename B, std::size_t Capacity = 64>
+class InplaceImplies;
+
+template <typename T> struct is_inplace_implies : std::false_type {};
+template <typename A, typename B, std::size_t Capacity>
+struct is_inplace_implies<InplaceImplies<A, B, Capacity>> : std::true_type {};
+
+template <typename A, typename B, std::size_t Capacity>
+class InplaceImplies {
+  template <typename, typename, std::size_t> friend class InplaceImplies;
+
+  template <typename F>
+  using EnableIfCallable = std::enable_if_t<
+      !is_inplace_implies<std::decay_t<F>>::value &&
+          std::is_invocable_r_v<B, std::decay_t<F> &, A>,
+      int>;
+
+public:
+  static constexpr std::size_t capacity = Capacity;
+
+  InplaceImplies() noexcept = default;
+
+  template <typename F, EnableIfCallable<F> = 0> InplaceImplies(F &&f) {
+    using Fn = std::decay_t<F>;
+    static_assert(sizeof(Fn) <= Capacity,
+                  "InplaceImplies: 闭包超过了内联缓冲区的容量");
+    static_assert(alignof(Fn) <= alignof(std::max_align_t),
+                  "InplaceImplies: 闭包的对齐要求过高");
+    static_assert(std::is_nothrow_move_constructible_v<Fn>,
+                  "InplaceImplies: 闭包必须可以 noexcept 移动");
+    ::new (storage_) Fn(std::forward<F>(f));
+    ops_ = inplace_detail::ops_for<A, B, Fn>();
+  }
+
+  // 容量较小的 InplaceImplies 可以放入容量更大的 InplaceImplies
+  template <std::size_t Other, std::enable_if_t<(Other < Capacity), int> = 0>
+  InplaceImplies(const InplaceImplies<A, B, Other> &other) {
+    copy_from(other);
+  }
+
+  InplaceImplies(const InplaceImplies &other) { copy_from(other); }
+
+  InplaceImplies(InplaceImplies &&other) noexcept { move_from(other); }
+
+  InplaceImplies &operator=(const InplaceImplies &other) {
+    if (this != &other) {
+      InplaceImplies tmp(other);
+      reset();
+      move_from(tmp);
+    }
+    return *this;
+  }
+
+  InplaceImplies &operator=(InplaceImplies &&other) noexcept {
+    if (this != &other) {
+      reset();
+      move_from(other);
+    }
+    return *this;
+  }
+
+  ~InplaceImplies() { reset(); }
+
+  // 与 std::function 一致: 调用空对象抛出 std::bad_function_call
+  B operator()(A a) const {
+    if (ops_ == nullptr) {
+      throw std::bad_function_call();
+    }
+    return ops_->invoke(storage_, std::forward<A>(a));
+  }
+
+  explicit operator bool() const noexcept { return ops_ != nullptr; }
+
+private:
+  template <std::size_t Other>
+  void copy_from(const InplaceImplies<A, B, Other> &other) {
+    if (other.ops_ != nullptr) {
+      other.ops_->copy(storage_, other.storage_);
+      ops_ = other.ops_;
+    }
+  }
+
+  void move_from(InplaceImplies &other) noexcept {
+    if (other.ops_ != nullptr) {
+      other.ops_->move(storage_, other.storage_);
+      ops_ = other.ops_;
+      other.ops_ = nullptr;
+    }
+  }
+
+  void reset() noexcept {
+    if (ops_ != nullptr) {
+      ops_->destroy(storage_);
+      ops_ = nullptr;
+    }
+  }
+
+  alignas(std::max_align_t) mutable unsigned char storage_[Capacity];
+  const inplace_detail::Ops<A, B> *ops_ = nullptr;
+};
+
+// --- Inplace Policy ---
+// constructive_logic.h 组合子的策略参数:
+//   前提的类型为 InplaceImplies<A, B, Capacity>;
+//   组合子构造的闭包会捕获其它前提 (例如 or_elim 的闭包捕获两个 Capacity 字节的
+//   前提), 放不进 Capacity 字节。因此 bind 的结果是 bound<A, F>, 容量为
+//   bound_capacity<F> = max(Capacity, sizeof(F)): 整条证明链都不进行堆分配,
+//   但结果的容量可能大于 Capacity, 作为下一层前提时要按结果的 capacity 选择策略。
+template <std::size_t Capacity> struct InplacePolicy {
+  template <typename A, typename B>
+  using implies = InplaceImplies<A, B, Capacity>;
+
+  template <typename F>
+  static constexpr std::size_t bound_capacity =
+      sizeof(F) > Capacity ? sizeof(F) : Capacity;
+
+  template <typename A, typename F>
+  using bound = InplaceImplies<A, std::invoke_result_t<F &, A>, bound_capacity<F>>;
+
+  template <typename A, typename F> static bound<A, F> bind(F f) {
+    return bound<A, F>(std::move(f));
+  }
+};
+
+#endif // INPLACE_IMPLIES_H
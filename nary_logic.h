@@ -0,0 +1,273 @@
+#ifndef NARY_LOGIC_H
+#define NARY_LOGIC_H
+
+#include "static_logic.h"
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+// --- Flat n-ary And / Or ---
+// AndN<Ts...> 是 T0 ∧ T1 ∧ ... 的证明, 所有分量平铺在同一个对象中,
+// 不再是 And<T0, And<T1, ...>> 那样的嵌套结构; get<I> 直接定位到第 I 个分量。
+// 分量的存储按类型选择:
+//   无状态 (空且可平凡默认构造, 例如 True/False): 不占存储, 读取时现场构造
+//   其它空类型 (例如无捕获的 lambda): 作为基类, 借助空基类优化不占空间
+//   其余类型: 普通成员
+// OrN<Ts...> 就是 std::variant<Ts...>, 本身已经是平铺的,
+// 并且 OrN<A, B> 与二元的 Or<A, B> 是同一个类型。
+// 组合子与 static_logic.h 一样返回具体的 lambda, 位于 static_proof 命名空间。
+
+template <typename... Ts> struct AndN;
+
+namespace nary_detail {
+
+template <typename T>
+inline constexpr bool is_stateless_v =
+    std::is_empty_v<T> && std::is_trivially_default_constructible_v<T>;
+
+template <typename T>
+inline constexpr int leaf_kind_v =
+    is_stateless_v<T> ? 0 : (std::is_empty_v<T> && !std::is_final_v<T>) ? 1 : 2;
+
+// Owner 是所属的 AndN, 避免 AndN 嵌套时出现同名的基类
+template <typename Owner, std::size_t I, typename T, int Kind = leaf_kind_v<T>>
+struct Leaf;
+
+// 无状态: 不存储
+template <typename Owner, std::size_t I, typename T> struct Leaf<Owner, I, T, 0> {
+  constexpr explicit Leaf(const T &) noexcept {}
+  constexpr T get() const noexcept { return T{}; }
+};
+
+// 空类型: 空基类优化
+template <typename Owner, std::size_t I, typename T>
+struct Leaf<Owner, I, T, 1> : private T {
+  constexpr explicit Leaf(T value) : T(std::move(value)) {}
+  constexpr T &get() & noexcept { return *this; }
+  constexpr const T &get() const & noexcept { return *this; }
+  constexpr T &&get() && noexcept { return std::move(*this); }
+};
+
+template <typename Owner, std::size_t I, typename T> struct Leaf<Owner, I, T, 2> {
+  T value;
+  constexpr explicit Leaf(T v) : value(std::move(v)) {}
+  constexpr T &get() & noexcept { return value; }
+  constexpr const T &get() const & noexcept { return value; }
+  constexpr T &&get() && noexcept { return std::move(value); }
+};
+
+template <typename Owner, typename Indices, typename... Ts> struct Leaves;
+
+template <typename Owner, std::size_t... Is, typename... Ts>
+struct Leaves<Owner, std::index_sequence<Is...>, Ts...> : Leaf<Owner, Is, Ts>... {
+  constexpr explicit Leaves(Ts... values)
+      : Leaf<Owner, Is, Ts>(std::move(values))... {}
+};
+
+} // namespace nary_detail
+
+// n 元合取: 第 I 个分量用 get<I> 或结构化绑定取出
+template <typename... Ts>
+struct AndN
+    : nary_detail::Leaves<AndN<Ts...>, std::index_sequence_for<Ts...>, Ts...> {
+  static constexpr std::size_t size = sizeof...(Ts);
+
+  constexpr explicit AndN(Ts... values)
+      : nary_detail::Leaves<AndN, std::index_sequence_for<Ts...>, Ts...>(
+            std::move(values)...) {}
+};
+
+template <std::size_t I, typename... Ts>
+using AndNElement = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+template <std::size_t I, typename... Ts>
+using AndNLeaf = nary_detail::Leaf<AndN<Ts...>, I, AndNElement<I, Ts...>>;
+
+// 第 I 个分量: 一次基类转换, 与 N 无关
+template <std::size_t I, typename... Ts>
+constexpr decltype(auto) get(AndN<Ts...> &x) noexcept {
+  return static_cast<AndNLeaf<I, Ts...> &>(x).get();
+}
+template <std::size_t I, typename... Ts>
+constexpr decltype(auto) get(const AndN<Ts...> &x) noexcept {
+  return static_cast<const AndNLeaf<I, Ts...> &>(x).get();
+}
+template <std::size_t I, typename... Ts>
+constexpr decltype(auto) get(AndN<Ts...> &&x) noexcept {
+  return static_cast<AndNLeaf<I, Ts...> &&>(x).get();
+}
+
+// 结构化绑定: auto [a, b, c] = and_n;
+namespace std {
+template <typename... Ts>
+struct tuple_size<AndN<Ts...>> : integral_constant<size_t, sizeof...(Ts)> {};
+template <size_t I, typename... Ts> struct tuple_element<I, AndN<Ts...>> {
+  using type = AndNElement<I, Ts...>;
+};
+} // namespace std
+
+// n 元析取
+template <typename... Ts> using OrN = std::variant<Ts...>;
+
+// 与二元联结词互相转换时使用的右结合嵌套形式:
+// NestedAnd<A, B, C> = And<A, And<B, C>>, NestedOr<A, B, C> = Or<A, Or<B, C>>
+template <typename T, typename... Ts> struct NestedAndOf {
+  using type = And<T, typename NestedAndOf<Ts...>::type>;
+};
+template <typename T> struct NestedAndOf<T> { using type = T; };
+template <typename... Ts> using NestedAnd = typename NestedAndOf<Ts...>::type;
+
+template <typename T, typename... Ts> struct NestedOrOf {
+  using type = Or<T, typename NestedOrOf<Ts...>::type>;
+};
+template <typename T> struct NestedOrOf<T> { using type = T; };
+template <typename... Ts> using NestedOr = typename NestedOrOf<Ts...>::type;
+
+namespace nary_detail {
+
+// NestedAnd 中 N 个分量里的第 I 个
+template <std::size_t I, std::size_t N, typename X>
+constexpr const auto &nested_get(const X &x) noexcept {
+  if constexpr (N == 1) {
+    return x;
+  } else if constexpr (I == 0) {
+    return x.a;
+  } else {
+    return nested_get<I - 1, N - 1>(x.b);
+  }
+}
+
+template <typename... Ts, std::size_t... Is>
+constexpr AndN<Ts...> flatten_and(const NestedAnd<Ts...> &x, std::index_sequence<Is...>) {
+  return AndN<Ts...>(nested_get<Is, sizeof...(Ts)>(x)...);
+}
+
+// AndN 的第 I 个分量起的后缀 → NestedAnd
+template <std::size_t I, typename Full, typename T, typename... Rest>
+constexpr NestedAnd<T, Rest...> nest_and(const Full &x) {
+  if constexpr (sizeof...(Rest) == 0) {
+    return get<I>(x);
+  } else {
+    return {get<I>(x), nest_and<I + 1, Full, Rest...>(x)};
+  }
+}
+
+// 单个值 → NestedOr<T, Ts...> 的第 I 支
+template <std::size_t I, typename T, typename... Ts, typename V>
+constexpr NestedOr<T, Ts...> nest_or(const V &value) {
+  if constexpr (sizeof...(Ts) == 0) {
+    return value;
+  } else if constexpr (I == 0) {
+    return NestedOr<T, Ts...>{std::in_place_index<0>, value};
+  } else {
+    return NestedOr<T, Ts...>{std::in_place_index<1>, nest_or<I - 1, Ts...>(value)};
+  }
+}
+
+// 第 D 层的 NestedOr → Target (OrN)
+template <std::size_t D, typename Target, typename T, typename... Ts>
+constexpr Target flatten_or(const NestedOr<T, Ts...> &x) {
+  if constexpr (sizeof...(Ts) == 0) {
+    return Target{std::in_place_index<D>, x};
+  } else if (x.index() == 0) {
+    return Target{std::in_place_index<D>, std::get<0>(x)};
+  } else {
+    return flatten_or<D + 1, Target, Ts...>(std::get<1>(x));
+  }
+}
+
+template <std::size_t I, typename... Ts> struct NestOrCase {
+  constexpr NestedOr<Ts...> operator()(const AndNElement<I, Ts...> &value) const {
+    return nest_or<I, Ts...>(value);
+  }
+};
+
+template <typename... Ts, std::size_t... Is>
+constexpr auto nest_or_cases(std::index_sequence<Is...>) {
+  return std::tuple<NestOrCase<Is, Ts...>...>{};
+}
+
+template <std::size_t I, typename C, typename V, typename Cases>
+constexpr C or_case(const V &v, const Cases &cases) {
+  return std::get<I>(cases)(std::get<I>(v));
+}
+
+// 按 index() 查表, 与析取支的个数无关
+template <typename C, typename V, typename Cases, std::size_t... Is>
+constexpr C or_dispatch(const V &v, const Cases &cases, std::index_sequence<Is...>) {
+  using Case = C (*)(const V &, const Cases &);
+  constexpr Case table[] = {&or_case<Is, C, V, Cases>...};
+  return table[v.index()](v, cases);
+}
+
+} // namespace nary_detail
+
+namespace static_proof {
+
+// n 元合取引入: T0, T1, ... → AndN<T0, T1, ...>, 一次接收全部前提
+template <typename... Ts> constexpr auto and_intro_n() {
+  return [](Ts... values) CPP_PROP_NOEXCEPT { return AndN<Ts...>(std::move(values)...); };
+}
+
+// n 元合取消去 (投影): AndN<Ts...> → T_I
+template <std::size_t I, typename... Ts> constexpr auto and_elim_n() {
+  return [](const AndN<Ts...> &x) CPP_PROP_NOEXCEPT -> AndNElement<I, Ts...> {
+    return get<I>(x);
+  };
+}
+
+// n 元析取引入 (注入): T_I → OrN<Ts...>
+template <std::size_t I, typename... Ts> constexpr auto or_intro_n() {
+  return [](AndNElement<I, Ts...> value) CPP_PROP_NOEXCEPT {
+    return OrN<Ts...>{std::in_place_index<I>, std::move(value)};
+  };
+}
+
+// n 元析取消去: OrN<Ts...> → ((T0 → C), (T1 → C), ...) → C
+// 按位置分派, 同一类型出现多次时也能区分
+template <typename C, typename... Ts> constexpr auto or_elim_n() {
+  return [](OrN<Ts...> premise) CPP_PROP_NOEXCEPT {
+    return [premise = std::move(premise)](auto... cases) CPP_PROP_NOEXCEPT -> C {
+      static_assert(sizeof...(cases) == sizeof...(Ts), "每个析取支需要一个前提");
+      return nary_detail::or_dispatch<C>(premise, std::make_tuple(std::move(cases)...),
+                                         std::index_sequence_for<Ts...>{});
+    };
+  };
+}
+
+// NestedAnd<Ts...> → AndN<Ts...>
+template <typename... Ts> constexpr auto flatten_and() {
+  return [](const NestedAnd<Ts...> &x) CPP_PROP_NOEXCEPT {
+    return nary_detail::flatten_and<Ts...>(x, std::index_sequence_for<Ts...>{});
+  };
+}
+
+// AndN<Ts...> → NestedAnd<Ts...>
+template <typename... Ts> constexpr auto nest_and() {
+  return [](const AndN<Ts...> &x) CPP_PROP_NOEXCEPT {
+    return nary_detail::nest_and<0, AndN<Ts...>, Ts...>(x);
+  };
+}
+
+// NestedOr<Ts...> → OrN<Ts...>
+template <typename... Ts> constexpr auto flatten_or() {
+  return [](const NestedOr<Ts...> &x) CPP_PROP_NOEXCEPT {
+    return nary_detail::flatten_or<0, OrN<Ts...>, Ts...>(x);
+  };
+}
+
+// OrN<Ts...> → NestedOr<Ts...>
+template <typename... Ts> constexpr auto nest_or() {
+  return [](const OrN<Ts...> &x) CPP_PROP_NOEXCEPT {
+    return nary_detail::or_dispatch<NestedOr<Ts...>>(
+        x, nary_detail::nest_or_cases<Ts...>(std::index_sequence_for<Ts...>{}),
+        std::index_sequence_for<Ts...>{});
+  };
+}
+
+} // namespace static_proof
+
+#endif // NARY_LOGIC_H
@@ -0,0 +1,178 @@
+#ifndef PARALLEL_TRUTH_TABLE_H
+#define PARALLEL_TRUTH_TABLE_H
+
+#include "truth_table.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// --- Parallel Truth Tables ---
+// 在多个线程上扫描赋值空间。2^N 个赋值按 Block (512 个) 划分, 开始时平均分给
+// 各个工作线程; 每个线程从自己区间的前端按块取活, 自己的区间空了就从其他线程
+// 的区间后端偷走一半 (work stealing)。区间是一个 64 位原子量 (起点 << 32 | 终点),
+// 取活和偷活都是一次 CAS, 没有锁。任何线程找到反例后, 所有线程在下一块之前停止。
+
+namespace cpp_prop::runtime {
+
+struct ParallelOptions {
+  unsigned threads = 0;              // 0 表示 std::thread::hardware_concurrency()
+  std::uint64_t chunk_blocks = 64;   // 每次从自己区间取的 Block 数
+};
+
+struct ParallelStats {
+  std::size_t threads = 0;
+  std::size_t blocks_evaluated = 0;
+  std::size_t steals = 0;
+};
+
+namespace detail {
+
+class alignas(64) WorkRange {
+public:
+  void reset(std::uint64_t begin, std::uint64_t end) {
+    bounds_.store(pack(begin, end), std::memory_order_relaxed);
+  }
+
+  // 从前端取至多 count 个 Block
+  bool take_front(std::uint64_t count, std::uint64_t &begin,
+                  std::uint64_t &end) {
+    std::uint64_t bounds = bounds_.load(std::memory_order_relaxed);
+    while (true) {
+      std::uint64_t b = bounds >> 32;
+      std::uint64_t e = bounds & 0xFFFFFFFFu;
+      if (b >= e) {
+        return false;
+      }
+      std::uint64_t nb = e - b > count ? b + count : e;
+      if (bounds_.compare_exchange_weak(bounds, pack(nb, e),
+                                        std::memory_order_relaxed)) {
+        begin = b;
+        end = nb;
+        return true;
+      }
+    }
+  }
+
+  // 从后端偷走一半 (至少一个 Block)
+  bool steal_back(std::uint64_t &begin, std::uint64_t &end) {
+    std::uint64_t bounds = bounds_.load(std::memory_order_relaxed);
+    while (true) {
+      std::uint64_t b = bounds >> 32;
+      std::uint64_t e = bounds & 0xFFFFFFFFu;
+      if (b >= e) {
+        return false;
+      }
+      std::uint64_t mid = b + (e - b) / 2;
+      if (bounds_.compare_exchange_weak(bounds, pack(b, mid),
+                                        std::memory_order_relaxed)) {
+        begin = mid;
+        end = e;
+        return true;
+      }
+    }
+  }
+
+private:
+  static std::uint64_t pack(std::uint64_t begin, std::uint64_t end) {
+    return (begin << 32) | end;
+  }
+
+  std::atomic<std::uint64_t> bounds_{0};
+};
+
+} // namespace detail
+
+// 并行检查全部 2^num_vars 个赋值。不是重言式时返回找到的一个反例;
+// 由于提前取消, 它不一定是编号最小的那个。
+inline TautologyResult
+check_tautology_parallel(const Formula &formula, unsigned num_vars,
+                         const ParallelOptions &options = {},
+                         ParallelStats *stats = nullptr) {
+  // 区间端点各占 32 位
+  if (num_vars > Block::log2_bits + 32) {
+    throw std::invalid_argument("check_tautology_parallel: too many variables");
+  }
+  TruthTableEvaluator probe(formula, num_vars);
+  const std::uint64_t num_blocks = probe.num_blocks();
+  unsigned threads = options.threads != 0
+                         ? options.threads
+                         : std::thread::hardware_concurrency();
+  if (threads == 0) {
+    threads = 1;
+  }
+  if (threads > num_blocks) {
+    threads = static_cast<unsigned>(num_blocks);
+  }
+  const std::uint64_t chunk = options.chunk_blocks != 0 ? options.chunk_blocks : 1;
+
+  std::unique_ptr<detail::WorkRange[]> ranges(new detail::WorkRange[threads]);
+  for (unsigned t = 0; t < threads; ++t) {
+    ranges[t].reset(num_blocks * t / threads, num_blocks * (t + 1) / threads);
+  }
+
+  std::atomic<bool> found{false};
+  std::atomic<std::uint64_t> counterexample{~std::uint64_t{0}};
+  std::atomic<std::size_t> blocks_evaluated{0};
+  std::atomic<std::size_t> steals{0};
+
+  auto worker = [&](unsigned self) {
+    TruthTableEvaluator evaluator(formula, num_vars);
+    std::size_t evaluated = 0;
+    std::uint64_t begin = 0;
+    std::uint64_t end = 0;
+    while (!found.load(std::memory_order_relaxed)) {
+      if (!ranges[self].take_front(chunk, begin, end)) {
+        bool stolen = false;
+        for (unsigned i = 1; i < threads && !stolen; ++i) {
+          stolen = ranges[(self + i) % threads].steal_back(begin, end);
+        }
+        if (!stolen) {
+          break;
+        }
+        steals.fetch_add(1, std::memory_order_relaxed);
+        ranges[self].reset(begin, end);
+        continue;
+      }
+      std::uint64_t assignment = 0;
+      evaluated += end - begin;
+      if (evaluator.first_falsifying(begin, end, assignment)) {
+        std::uint64_t best = counterexample.load(std::memory_order_relaxed);
+        while (assignment < best &&
+               !counterexample.compare_exchange_weak(
+                   best, assignment, std::memory_order_relaxed)) {
+        }
+        found.store(true, std::memory_order_relaxed);
+      }
+    }
+    blocks_evaluated.fetch_add(evaluated, std::memory_order_relaxed);
+  };
+
+  std::vector<std::thread> pool;
+  pool.reserve(threads - 1);
+  for (unsigned t = 1; t < threads; ++t) {
+    pool.emplace_back(worker, t);
+  }
+  worker(0);
+  for (std::thread &thread : pool) {
+    thread.join();
+  }
+
+  if (stats != nullptr) {
+    stats->threads = threads;
+    stats->blocks_evaluated = blocks_evaluated.load();
+    stats->steals = steals.load();
+  }
+  if (found.load()) {
+    return {false, counterexample.load()};
+  }
+  return {true, 0};
+}
+
+} // namespace cpp_prop::runtime
+
+#endif // PARALLEL_TRUTH_TABLE_H
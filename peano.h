@@ -0,0 +1,284 @@
+#ifndef PEANO_H
+#define PEANO_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+// --- Type-level Natural Numbers (Peano Axioms) ---
+
+// Zero
+struct Zero {};
+
+// Successor (N + 1)
+template <typename N> struct Succ {};
+
+// --- Type-level Arithmetic Operations ---
+
+// Addition: Add<N, M>::type represents N + M
+template <typename N, typename M> struct Add;
+
+// Base case: 0 + M = M
+template <typename M> struct Add<Zero, M> { using type = M; };
+
+// Recursive case: Succ<N> + M = Succ<N + M>
+template <typename N, typename M> struct Add<Succ<N>, M> {
+    using type = Succ<typename Add<N, M>::type>;
+};
+
+// Multiplication: Multiply<N, M>::type represents N * M
+template <typename N, typename M> struct Multiply;
+
+// Base case: 0 * M = 0
+template <typename M> struct Multiply<Zero, M> { using type = Zero; };
+
+// Recursive case: Succ<N> * M = (N * M) + M
+template <typename N, typename M> struct Multiply<Succ<N>, M> {
+    using type = typename Add<typename Multiply<N, M>::type, M>::type;
+};
+
+// --- Binary Natural Numbers ---
+// 一元的 Succ 链做加法需要 O(n) 层实例化, 乘法需要 O(n·m) 个实例化, 几百以上就会
+// 超出 -ftemplate-depth。二进制表示是从最低位开始的位列表:
+//   BinNil = 0, Bin<B1, BinNil> = 1, Bin<B0, Bin<B1, BinNil>> = 2, ...
+// 规范形式的最高位总是 B1 (没有多余的前导零), 所以相等就是 std::is_same。
+// 加法、比较的实例化深度与位数成正比, 乘法的实例化个数与位数的平方成正比。
+
+struct B0 {};
+struct B1 {};
+struct BinNil {};
+template <typename Bit, typename Rest> struct Bin {};
+
+namespace peano_detail {
+
+// 在低位前面加一位, 保持规范形式: 0 的两倍仍是 BinNil
+template <typename Bit, typename Rest> struct Cons { using type = Bin<Bit, Rest>; };
+template <> struct Cons<B0, BinNil> { using type = BinNil; };
+
+template <bool Bit> using BitOf = std::conditional_t<Bit, B1, B0>;
+template <typename Bit> inline constexpr unsigned bit_value = std::is_same_v<Bit, B1> ? 1 : 0;
+
+// 带进位的加法
+template <typename N, typename M, unsigned Carry> struct AddCarry;
+template <> struct AddCarry<BinNil, BinNil, 0> { using type = BinNil; };
+template <> struct AddCarry<BinNil, BinNil, 1> { using type = Bin<B1, BinNil>; };
+template <typename A, typename R> struct AddCarry<Bin<A, R>, BinNil, 0> { using type = Bin<A, R>; };
+template <typename B, typename S> struct AddCarry<BinNil, Bin<B, S>, 0> { using type = Bin<B, S>; };
+template <typename A, typename R> struct AddCarry<Bin<A, R>, BinNil, 1> {
+    using type = typename AddCarry<Bin<A, R>, Bin<B1, BinNil>, 0>::type;
+};
+template <typename B, typename S> struct AddCarry<BinNil, Bin<B, S>, 1> {
+    using type = typename AddCarry<Bin<B1, BinNil>, Bin<B, S>, 0>::type;
+};
+template <typename A, typename R, typename B, typename S, unsigned Carry>
+struct AddCarry<Bin<A, R>, Bin<B, S>, Carry> {
+    static constexpr unsigned sum = bit_value<A> + bit_value<B> + Carry;
+    using type = typename Cons<BitOf<sum & 1>, typename AddCarry<R, S, (sum >> 1)>::type>::type;
+};
+
+// 按位数比较: 低位的结果只在高位全部相等时才起作用
+template <typename N, typename M> struct Compare;
+template <> struct Compare<BinNil, BinNil> : std::integral_constant<int, 0> {};
+template <typename A, typename R> struct Compare<Bin<A, R>, BinNil> : std::integral_constant<int, 1> {};
+template <typename B, typename S> struct Compare<BinNil, Bin<B, S>> : std::integral_constant<int, -1> {};
+template <typename A, typename R, typename B, typename S>
+struct Compare<Bin<A, R>, Bin<B, S>>
+    : std::integral_constant<int, Compare<R, S>::value != 0
+                                      ? Compare<R, S>::value
+                                      : int(bit_value<A>) - int(bit_value<B>)> {};
+
+// Succ^N<Base>: N = 2r + b 时为 Succ^b<Succ^r<Succ^r<Base>>>, 深度与 N 的位数成正比
+template <typename N, typename Base> struct SuccN;
+template <typename Base> struct SuccN<BinNil, Base> { using type = Base; };
+template <typename R, typename Base> struct SuccN<Bin<B0, R>, Base> {
+    using type = typename SuccN<R, typename SuccN<R, Base>::type>::type;
+};
+template <typename R, typename Base> struct SuccN<Bin<B1, R>, Base> {
+    using type = Succ<typename SuccN<R, typename SuccN<R, Base>::type>::type>;
+};
+
+} // namespace peano_detail
+
+// BinAdd<N, M>::type = N + M
+template <typename N, typename M> struct BinAdd {
+    using type = typename peano_detail::AddCarry<N, M, 0>::type;
+};
+
+// BinMultiply<N, M>::type = N * M (移位相加: (2r + b) * M = 2 (r * M) + b * M)
+template <typename N, typename M> struct BinMultiply;
+template <typename M> struct BinMultiply<BinNil, M> { using type = BinNil; };
+template <typename R, typename M> struct BinMultiply<Bin<B0, R>, M> {
+    using type = typename peano_detail::Cons<B0, typename BinMultiply<R, M>::type>::type;
+};
+template <typename R, typename M> struct BinMultiply<Bin<B1, R>, M> {
+    using type = typename BinAdd<
+        M, typename peano_detail::Cons<B0, typename BinMultiply<R, M>::type>::type>::type;
+};
+
+// BinCompare<N, M>::value 为 -1、0 或 1
+template <typename N, typename M> struct BinCompare : peano_detail::Compare<N, M> {};
+template <typename N, typename M>
+inline constexpr bool bin_less_v = BinCompare<N, M>::value < 0;
+template <typename N, typename M>
+inline constexpr bool bin_equal_v = std::is_same_v<N, M>;
+
+// MakeBin<k>: 整数字面量 → 二进制自然数
+template <std::uint64_t K> struct MakeBin {
+    using type = typename peano_detail::Cons<peano_detail::BitOf<(K & 1) != 0>,
+                                             typename MakeBin<(K >> 1)>::type>::type;
+};
+template <> struct MakeBin<0> { using type = BinNil; };
+
+// bin_value_v<N>: 二进制自然数 → 整数
+template <typename N> inline constexpr std::uint64_t bin_value_v = 0;
+template <typename Bit, typename Rest>
+inline constexpr std::uint64_t bin_value_v<Bin<Bit, Rest>> =
+    peano_detail::bit_value<Bit> + 2 * bin_value_v<Rest>;
+
+// ToUnary<N>::type: 二进制 → Succ 链。结果本身有 N 层嵌套, 只适合较小的数。
+template <typename N> struct ToUnary {
+    using type = typename peano_detail::SuccN<N, Zero>::type;
+};
+
+// --- Value Reflection ---
+// to_value<N>: Succ 链或二进制自然数 → 整数。一元的数每层剥去 8 个 Succ。
+// FromValue<k>::type: 整数 → Succ 链, 经由 MakeBin, 实例化深度与 k 的位数成正比。
+
+namespace peano_detail {
+
+template <typename N> struct Value;
+template <> struct Value<Zero> : std::integral_constant<std::uint64_t, 0> {};
+template <typename N>
+struct Value<Succ<N>> : std::integral_constant<std::uint64_t, 1 + Value<N>::value> {};
+template <typename N>
+struct Value<Succ<Succ<Succ<Succ<Succ<Succ<Succ<Succ<N>>>>>>>>>
+    : std::integral_constant<std::uint64_t, 8 + Value<N>::value> {};
+template <> struct Value<BinNil> : std::integral_constant<std::uint64_t, 0> {};
+template <typename Bit, typename Rest>
+struct Value<Bin<Bit, Rest>> : std::integral_constant<std::uint64_t, bin_value_v<Bin<Bit, Rest>>> {};
+
+} // namespace peano_detail
+
+template <typename N> inline constexpr std::uint64_t to_value = peano_detail::Value<N>::value;
+
+template <std::uint64_t K> struct FromValue {
+    using type = typename ToUnary<typename MakeBin<K>::type>::type;
+};
+
+// FromUnary<N>::type: Succ 链 → 二进制
+template <typename N> struct FromUnary {
+    using type = typename MakeBin<to_value<N>>::type;
+};
+
+// --- Bounded Theorem Checking ---
+// CheckForAll<K1, K2, Theorem>: 对所有 N < K1, M < K2 检查 Theorem<N, M>::value。
+// 全部 (N, M) 对在一个 index_sequence 的折叠表达式中展开, 不需要逐个手写调用。
+// 编译器对同样的模板参数只实例化一次, 所以共享的子结果自动被记忆:
+// Nat<I> 共用 FromValue 的中间结果, Multiply<Succ<N>, M> 复用已经检查过的 Multiply<N, M>。
+
+// 第 I 个自然数 (Succ 链)
+template <std::size_t I> using Nat = typename FromValue<I>::type;
+
+namespace peano_detail {
+
+template <std::size_t K1, std::size_t K2, template <typename, typename> class Theorem,
+          typename Indices>
+struct CheckPairs;
+
+template <std::size_t K1, std::size_t K2, template <typename, typename> class Theorem,
+          std::size_t... I>
+struct CheckPairs<K1, K2, Theorem, std::index_sequence<I...>> {
+    static constexpr bool results[sizeof...(I) + 1] = {Theorem<Nat<I / K2>, Nat<I % K2>>::value...,
+                                                       true};
+};
+
+template <std::size_t Count>
+constexpr std::size_t first_false(const bool (&results)[Count]) {
+    for (std::size_t i = 0; i + 1 < Count; ++i) {
+        if (!results[i]) {
+            return i;
+        }
+    }
+    return Count - 1;
+}
+
+} // namespace peano_detail
+
+template <std::size_t K1, std::size_t K2, template <typename, typename> class Theorem>
+struct CheckForAll {
+private:
+    using Pairs = peano_detail::CheckPairs<K1, K2, Theorem, std::make_index_sequence<K1 * K2>>;
+    static constexpr std::size_t failure = peano_detail::first_false(Pairs::results);
+
+public:
+    static constexpr bool value = failure == K1 * K2;
+    // 不成立时第一个反例 (N, M); 成立时为 (K1, 0)
+    static constexpr std::size_t counterexample_n = failure / (K2 == 0 ? 1 : K2);
+    static constexpr std::size_t counterexample_m = K2 == 0 ? 0 : failure % K2;
+};
+
+// 常用的定理, 可以直接交给 CheckForAll
+template <typename N, typename M>
+struct AddCommutes
+    : std::is_same<typename Add<N, M>::type, typename Add<M, N>::type> {};
+
+template <typename N, typename M>
+struct MultiplyCommutes
+    : std::is_same<typename Multiply<N, M>::type, typename Multiply<M, N>::type> {};
+
+// (N + M) * M = N * M + M * M
+template <typename N, typename M>
+struct MultiplyDistributes
+    : std::is_same<typename Multiply<typename Add<N, M>::type, M>::type,
+                   typename Add<typename Multiply<N, M>::type,
+                                typename Multiply<M, M>::type>::type> {};
+
+// 一元与二进制的结果一致
+template <typename N, typename M>
+struct BinaryAgreesWithUnary
+    : std::is_same<typename FromUnary<typename Multiply<N, M>::type>::type,
+                   typename BinMultiply<typename FromUnary<N>::type,
+                                        typename FromUnary<M>::type>::type> {};
+
+// --- Arithmetic Tables ---
+// ArithmeticTable<K>: 所有 N, M < K 的 Add / Multiply 结果的数值, 整张表只实例化一次,
+// 之后按下标 O(1) 查询, 与原生算术对照时不需要再实例化递归链。
+template <std::size_t K> struct ArithmeticTable {
+private:
+    template <std::size_t... I>
+    static constexpr std::array<std::uint64_t, K * K> sums(std::index_sequence<I...>) {
+        return {{to_value<typename Add<Nat<I / K>, Nat<I % K>>::type>...}};
+    }
+    template <std::size_t... I>
+    static constexpr std::array<std::uint64_t, K * K> products(std::index_sequence<I...>) {
+        return {{to_value<typename Multiply<Nat<I / K>, Nat<I % K>>::type>...}};
+    }
+
+    static constexpr std::array<std::uint64_t, K * K> sums_ =
+        sums(std::make_index_sequence<K * K>{});
+    static constexpr std::array<std::uint64_t, K * K> products_ =
+        products(std::make_index_sequence<K * K>{});
+
+    static constexpr bool check_native() {
+        for (std::size_t n = 0; n < K; ++n) {
+            for (std::size_t m = 0; m < K; ++m) {
+                if (sums_[n * K + m] != n + m || products_[n * K + m] != n * m) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+public:
+    static constexpr std::uint64_t sum(std::size_t n, std::size_t m) { return sums_[n * K + m]; }
+    static constexpr std::uint64_t product(std::size_t n, std::size_t m) {
+        return products_[n * K + m];
+    }
+    // 每一项都与原生的 + 和 * 一致
+    static constexpr bool matches_native = check_native();
+};
+
+#endif // PEANO_H
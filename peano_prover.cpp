@@ -1,39 +1,8 @@
 #include "constructive_logic.h"
+#include "peano.h"
 #include <iostream>
 #include <type_traits>
 
-// --- Type-level Natural Numbers (Peano Axioms) ---
-
-// Zero
-struct Zero {};
-
-// Successor (N + 1)
-template <typename N> struct Succ {};
-
-// --- Type-level Arithmetic Operations ---
-
-// Addition: Add<N, M>::type represents N + M
-template <typename N, typename M> struct Add;
-
-// Base case: 0 + M = M
-template <typename M> struct Add<Zero, M> { using type = M; };
-
-// Recursive case: Succ<N> + M = Succ<N + M>
-template <typename N, typename M> struct Add<Succ<N>, M> {
-    using type = Succ<typename Add<N, M>::type>;
-};
-
-// Multiplication: Multiply<N, M>::type represents N * M
-template <typename N, typename M> struct Multiply;
-
-// Base case: 0 * M = 0
-template <typename M> struct Multiply<Zero, M> { using type = Zero; };
-
-// Recursive case: Succ<N> * M = (N * M) + M
-template <typename N, typename M> struct Multiply<Succ<N>, M> {
-    using type = typename Add<typename Multiply<N, M>::type, M>::type;
-};
-
 // --- Type-level Natural Number Theorems (Verified by static_assert) ---
 
 // Theorem: N + 0 = N
@@ -72,6 +41,41 @@ void theorem_two_times_two_is_four() {
                   "Theorem: 2 * 2 = 4 failed");
 }
 
+// --- Binary Naturals ---
+// 同样的定理在二进制表示上可以用到上百万的数
+
+void theorem_binary_matches_unary() {
+    static_assert(std::is_same_v<ToUnary<BinAdd<MakeBin<1>::type, MakeBin<2>::type>::type>::type,
+                                 Three>,
+                  "Theorem: 1 + 2 = 3 (binary) failed");
+    static_assert(std::is_same_v<FromUnary<Multiply<Two, Two>::type>::type, MakeBin<4>::type>,
+                  "Theorem: 2 * 2 = 4 (binary) failed");
+}
+
+void theorem_large_binary_arithmetic() {
+    using N = MakeBin<1234567>::type;
+    using M = MakeBin<7654321>::type;
+    static_assert(std::is_same_v<BinAdd<N, M>::type, BinAdd<M, N>::type>,
+                  "Theorem: N + M = M + N failed");
+    static_assert(std::is_same_v<BinMultiply<N, M>::type, MakeBin<1234567ull * 7654321ull>::type>,
+                  "Theorem: 1234567 * 7654321 failed");
+    static_assert(bin_less_v<N, M> && !bin_less_v<M, N>, "Theorem: 1234567 < 7654321 failed");
+}
+
+// --- Theorems over a Bounded Range ---
+// 对所有 N, M < 16 一次检查, 代替逐个手写的 theorem_* 调用
+
+void theorems_for_all_small_naturals() {
+    static_assert(CheckForAll<16, 16, AddCommutes>::value, "Theorem: N + M = M + N failed");
+    static_assert(CheckForAll<16, 16, MultiplyCommutes>::value, "Theorem: N * M = M * N failed");
+    static_assert(CheckForAll<16, 16, MultiplyDistributes>::value,
+                  "Theorem: (N + M) * M = N * M + M * M failed");
+    static_assert(CheckForAll<16, 16, BinaryAgreesWithUnary>::value,
+                  "Theorem: binary and unary multiplication agree failed");
+    static_assert(ArithmeticTable<16>::matches_native,
+                  "Theorem: Add and Multiply agree with native arithmetic failed");
+}
+
 int main() {
     // Run the theorem checks. If this compiles, the theorems are proven.
     theorem_add_zero_is_n<Zero>();
@@ -80,9 +84,15 @@ int main() {
 
     theorem_one_plus_two_is_three();
     theorem_two_times_two_is_four();
+    theorem_binary_matches_unary();
+    theorem_large_binary_arithmetic();
+    theorems_for_all_small_naturals();
 
     std::cout << "peano_prover.cpp successfully compiled!" << std::endl;
     std::cout << "Demonstrates type-level natural number arithmetic and basic theorem proving." << std::endl;
+    std::cout << "15 * 15 = " << ArithmeticTable<16>::product(15, 15) << ", 1234567 * 7654321 = "
+              << to_value<BinMultiply<MakeBin<1234567>::type, MakeBin<7654321>::type>::type>
+              << std::endl;
 
     return 0;
 }
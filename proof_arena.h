@@ -0,0 +1,229 @@
+#ifndef PROOF_ARENA_H
+#define PROOF_ARENA_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// --- Proof Arena ---
+// 为一批证明检查提供的区域分配器。组合子 (通过 ArenaPolicy) 构造的闭包状态
+// 全部从当前的 ProofArena 中按顺序分配, reset() 时一次性释放, 而不是逐个运行
+// 成千上万个 std::function 的析构函数。只有非平凡析构的闭包才会被登记,
+// 并在 reset() 时按构造的逆序析构。
+
+class ProofArena {
+public:
+  struct Stats {
+    std::size_t bytes_in_use = 0;     // 当前已分配的字节数
+    std::size_t high_water_mark = 0;  // 自构造 (或 reset_stats) 以来的峰值
+    std::size_t allocations = 0;      // 当前批次内的分配次数
+    std::size_t bytes_reserved = 0;   // 向系统申请的字节总数
+    std::size_t blocks = 0;           // 内存块数量
+  };
+
+  // 在作用域内把 arena 设为当前线程的 ProofArena::current()
+  class Scope {
+  public:
+    explicit Scope(ProofArena &arena) : previous_(current_slot()) {
+      current_slot() = &arena;
+    }
+    ~Scope() { current_slot() = previous_; }
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+  private:
+    ProofArena *previous_;
+  };
+
+  static constexpr std::size_t default_block_size = 64 * 1024;
+
+  explicit ProofArena(std::size_t block_size = default_block_size)
+      : block_size_(block_size) {}
+
+  ProofArena(const ProofArena &) = delete;
+  ProofArena &operator=(const ProofArena &) = delete;
+
+  ~ProofArena() {
+    run_destructors();
+    for (Block &block : blocks_) {
+      std::free(block.data);
+    }
+  }
+
+  // 当前线程的 arena; 没有活动的 Scope 时抛出 std::logic_error
+  static ProofArena &current() {
+    ProofArena *arena = current_slot();
+    if (arena == nullptr) {
+      throw std::logic_error("ProofArena: no active ProofArena::Scope");
+    }
+    return *arena;
+  }
+
+  void *allocate(std::size_t size, std::size_t align) {
+    while (true) {
+      if (active_ < blocks_.size()) {
+        Block &block = blocks_[active_];
+        std::size_t offset = (block.used + align - 1) & ~(align - 1);
+        if (offset + size <= block.size) {
+          block.used = offset + size;
+          note_allocation(size);
+          return block.data + offset;
+        }
+        if (active_ + 1 < blocks_.size()) {
+          // 复用 reset() 前已经申请过的内存块
+          ++active_;
+          blocks_[active_].used = 0;
+          continue;
+        }
+      }
+      add_block(size + align);
+    }
+  }
+
+  // 在 arena 中构造 T; 非平凡析构的对象会在 reset() 时被析构
+  template <typename T, typename... Args> T *create(Args &&...args) {
+    void *memory = allocate(sizeof(T), alignof(T));
+    T *object = ::new (memory) T(std::forward<Args>(args)...);
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      void *node_memory = allocate(sizeof(DestructorNode),
+                                   alignof(DestructorNode));
+      destructors_ = ::new (node_memory) DestructorNode{
+          [](void *p) { static_cast<T *>(p)->~T(); }, object, destructors_};
+    }
+    return object;
+  }
+
+  // 一次性释放本批次的所有闭包; 内存块保留给下一批次复用
+  void reset() {
+    run_destructors();
+    for (Block &block : blocks_) {
+      block.used = 0;
+    }
+    active_ = 0;
+    stats_.bytes_in_use = 0;
+    stats_.allocations = 0;
+  }
+
+  void reset_stats() { stats_.high_water_mark = stats_.bytes_in_use; }
+
+  const Stats &stats() const { return stats_; }
+  std::size_t high_water_mark() const { return stats_.high_water_mark; }
+
+private:
+  struct Block {
+    unsigned char *data;
+    std::size_t size;
+    std::size_t used;
+  };
+
+  struct DestructorNode {
+    void (*destroy)(void *);
+    void *object;
+    DestructorNode *next;
+  };
+
+  static ProofArena *&current_slot() {
+    static thread_local ProofArena *arena = nullptr;
+    return arena;
+  }
+
+  void add_block(std::size_t min_size) {
+    std::size_t size = min_size > block_size_ ? min_size : block_size_;
+    auto *data = static_cast<unsigned char *>(std::malloc(size));
+    if (data == nullptr) {
+      throw std::bad_alloc();
+    }
+    // 新块插入在当前块之后, 使 reset() 后的块顺序与分配顺序一致
+    std::size_t position = blocks_.empty() ? 0 : active_ + 1;
+    blocks_.insert(blocks_.begin() + static_cast<std::ptrdiff_t>(position),
+                   Block{data, size, 0});
+    active_ = position;
+    stats_.bytes_reserved += size;
+    stats_.blocks = blocks_.size();
+  }
+
+  void note_allocation(std::size_t size) {
+    stats_.bytes_in_use += size;
+    ++stats_.allocations;
+    if (stats_.bytes_in_use > stats_.high_water_mark) {
+      stats_.high_water_mark = stats_.bytes_in_use;
+    }
+  }
+
+  void run_destructors() {
+    while (destructors_ != nullptr) {
+      DestructorNode *node = destructors_;
+      destructors_ = node->next;
+      node->destroy(node->object);
+    }
+  }
+
+  std::size_t block_size_;
+  std::vector<Block> blocks_;
+  std::size_t active_ = 0;
+  DestructorNode *destructors_ = nullptr;
+  Stats stats_;
+};
+
+// --- Arena Implies ---
+// 指向 arena 中闭包的类型擦除蕴含 A → B。复制只复制两个指针,
+// 闭包的生命周期由 ProofArena 管理: reset() 之后不得再调用。
+template <typename A, typename B> class ArenaImplies {
+  template <typename F>
+  using EnableIfCallable = std::enable_if_t<
+      !std::is_same_v<std::decay_t<F>, ArenaImplies> &&
+          std::is_invocable_r_v<B, const std::decay_t<F> &, A>,
+      int>;
+
+public:
+  ArenaImplies() noexcept = default;
+
+  // 在 ProofArena::current() 中分配闭包
+  template <typename F, EnableIfCallable<F> = 0>
+  ArenaImplies(F &&f) : ArenaImplies(ProofArena::current(), std::forward<F>(f)) {}
+
+  template <typename F, EnableIfCallable<F> = 0>
+  ArenaImplies(ProofArena &arena, F &&f) {
+    using Fn = std::decay_t<F>;
+    closure_ = arena.create<Fn>(std::forward<F>(f));
+    invoke_ = [](const void *closure, A &&a) -> B {
+      return (*static_cast<const Fn *>(closure))(std::forward<A>(a));
+    };
+  }
+
+  // 与 std::function 一致: 调用空对象抛出 std::bad_function_call
+  B operator()(A a) const {
+    if (invoke_ == nullptr) {
+      throw std::bad_function_call();
+    }
+    return invoke_(closure_, std::forward<A>(a));
+  }
+
+  explicit operator bool() const noexcept { return invoke_ != nullptr; }
+
+private:
+  const void *closure_ = nullptr;
+  B (*invoke_)(const void *, A &&) = nullptr;
+};
+
+// --- Arena Policy ---
+// constructive_logic.h 组合子的策略参数: 所有闭包都分配在
+// ProofArena::current() 中, 例如
+//   ProofArena arena;
+//   ProofArena::Scope scope(arena);
+//   auto proof = de_morgan_2<A, B, ArenaPolicy>();
+struct ArenaPolicy {
+  template <typename A, typename B> using implies = ArenaImplies<A, B>;
+
+  template <typename A, typename F> static auto bind(F f) {
+    return ArenaImplies<A, std::invoke_result_t<const F &, A>>(std::move(f));
+  }
+};
+
+#endif // PROOF_ARENA_H
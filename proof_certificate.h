@@ -0,0 +1,701 @@
+#ifndef PROOF_CERTIFICATE_H
+#define PROOF_CERTIFICATE_H
+
+#include "formula_store.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// --- Proof Certificates ---
+// constructive_logic.h 的证明是闭包, 进程结束就没了。证明证书把同一个证明记录为
+// 规则应用的 DAG: 每一步是一条规则 (对应一个组合子, 如 modus_ponens、and_intro、
+// or_elim、principle_of_explosion) 加上它的结论和前提步骤。证书可以写入文件,
+// 之后在内存映射的字节上直接重新检查, 不需要解析, 也不需要重建闭包。
+//
+// ¬A 与 A → False 等同: 结论为 ¬A 的 ImpliesIntro、前提为 ¬A 的 ImpliesElim 都合法。
+//
+// 二进制格式 (小端, 全部为 u32, 所以映射后每个字段都是对齐的):
+//   文件头  "CPPC"  版本  公式节点数 n  步骤数 m  根步骤
+//   n 个公式节点  (opcode, lhs, rhs)      子节点编号小于自身, 且没有重复节点
+//   m 个步骤      (rule, 结论, p0, p1, p2) 前提编号小于自身, 不用的前提为 0
+// 公式节点没有重复, 所以编号相等就是结构相等。根用到的每个假设最多被一个
+// ImpliesIntro 消去 (同一个 ImpliesIntro 步骤可以被多处共享)。
+
+namespace cpp_prop::runtime {
+
+enum class ProofRule : std::uint32_t {
+  Hypothesis,     // 假设 A; 由 ImpliesIntro 消去
+  TrueIntro,      // ⊢ True
+  ImpliesIntro,   // p0: 假设 A, p1: B                ⊢ A → B
+  ImpliesElim,    // p0: A, p1: A → B                 ⊢ B        (modus_ponens)
+  AndIntro,       // p0: A, p1: B                     ⊢ A ∧ B
+  AndElimLeft,    // p0: A ∧ B                        ⊢ A
+  AndElimRight,   // p0: A ∧ B                        ⊢ B
+  OrIntroLeft,    // p0: A                            ⊢ A ∨ B
+  OrIntroRight,   // p0: B                            ⊢ A ∨ B
+  OrElim,         // p0: A ∨ B, p1: A → C, p2: B → C  ⊢ C
+  Explosion,      // p0: False                        ⊢ A        (principle_of_explosion)
+  EquivIntro,     // p0: A → B, p1: B → A             ⊢ A ↔ B
+  EquivElimLeft,  // p0: A ↔ B                        ⊢ A → B
+  EquivElimRight, // p0: A ↔ B                        ⊢ B → A
+};
+
+inline constexpr std::uint32_t kProofRuleCount = 14;
+inline constexpr char kCertificateMagic[4] = {'C', 'P', 'P', 'C'};
+inline constexpr std::uint32_t kCertificateVersion = 1;
+inline constexpr std::size_t kCertificateHeaderWords = 5;
+
+namespace detail {
+
+// 公式节点只读访问; 编号相等即结构相等
+template <typename Nodes> class ProofRules {
+public:
+  explicit ProofRules(const Nodes &nodes) : nodes_(nodes) {}
+
+  // f 是否为 a → c (c 为 False 时也可以是 ¬a)
+  bool is_implication(std::uint32_t f, std::uint32_t a, std::uint32_t c) const {
+    Opcode op = nodes_.op(f);
+    if (op == Opcode::Implies) {
+      return nodes_.lhs(f) == a && nodes_.rhs(f) == c;
+    }
+    return op == Opcode::Not && nodes_.lhs(f) == a &&
+           nodes_.op(c) == Opcode::False;
+  }
+
+  // 规则 rule 能否由前提结论 p 推出结论 c; 失败时返回原因
+  const char *check(ProofRule rule, std::uint32_t c, const std::uint32_t *p,
+                    bool p0_is_hypothesis) const {
+    switch (rule) {
+    case ProofRule::Hypothesis:
+      return nullptr;
+    case ProofRule::TrueIntro:
+      return nodes_.op(c) == Opcode::True ? nullptr : "TrueIntro must prove True";
+    case ProofRule::ImpliesIntro:
+      if (!p0_is_hypothesis) {
+        return "ImpliesIntro must discharge a hypothesis";
+      }
+      return is_implication(c, p[0], p[1]) ? nullptr : "ImpliesIntro conclusion mismatch";
+    case ProofRule::ImpliesElim:
+      return is_implication(p[1], p[0], c) ? nullptr : "ImpliesElim premise mismatch";
+    case ProofRule::AndIntro:
+      return binary(c, Opcode::And, p[0], p[1]) ? nullptr : "AndIntro conclusion mismatch";
+    case ProofRule::AndElimLeft:
+      return nodes_.op(p[0]) == Opcode::And && nodes_.lhs(p[0]) == c
+                 ? nullptr
+                 : "AndElimLeft premise mismatch";
+    case ProofRule::AndElimRight:
+      return nodes_.op(p[0]) == Opcode::And && nodes_.rhs(p[0]) == c
+                 ? nullptr
+                 : "AndElimRight premise mismatch";
+    case ProofRule::OrIntroLeft:
+      return nodes_.op(c) == Opcode::Or && nodes_.lhs(c) == p[0]
+                 ? nullptr
+                 : "OrIntroLeft conclusion mismatch";
+    case ProofRule::OrIntroRight:
+      return nodes_.op(c) == Opcode::Or && nodes_.rhs(c) == p[0]
+                 ? nullptr
+                 : "OrIntroRight conclusion mismatch";
+    case ProofRule::OrElim:
+      return nodes_.op(p[0]) == Opcode::Or &&
+                     is_implication(p[1], nodes_.lhs(p[0]), c) &&
+                     is_implication(p[2], nodes_.rhs(p[0]), c)
+                 ? nullptr
+                 : "OrElim premise mismatch";
+    case ProofRule::Explosion:
+      return nodes_.op(p[0]) == Opcode::False ? nullptr
+                                              : "Explosion needs a proof of False";
+    case ProofRule::EquivIntro:
+      return nodes_.op(c) == Opcode::Equiv &&
+                     is_implication(p[0], nodes_.lhs(c), nodes_.rhs(c)) &&
+                     is_implication(p[1], nodes_.rhs(c), nodes_.lhs(c))
+                 ? nullptr
+                 : "EquivIntro premise mismatch";
+    case ProofRule::EquivElimLeft:
+      return nodes_.op(p[0]) == Opcode::Equiv &&
+                     is_implication(c, nodes_.lhs(p[0]), nodes_.rhs(p[0]))
+                 ? nullptr
+                 : "EquivElimLeft conclusion mismatch";
+    case ProofRule::EquivElimRight:
+      return nodes_.op(p[0]) == Opcode::Equiv &&
+                     is_implication(c, nodes_.rhs(p[0]), nodes_.lhs(p[0]))
+                 ? nullptr
+                 : "EquivElimRight conclusion mismatch";
+    }
+    return "unknown rule";
+  }
+
+private:
+  bool binary(std::uint32_t f, Opcode op, std::uint32_t a, std::uint32_t b) const {
+    return nodes_.op(f) == op && nodes_.lhs(f) == a && nodes_.rhs(f) == b;
+  }
+
+  const Nodes &nodes_;
+};
+
+// 各规则使用的前提个数
+inline constexpr unsigned proof_rule_arity(ProofRule rule) {
+  switch (rule) {
+  case ProofRule::Hypothesis:
+  case ProofRule::TrueIntro:
+    return 0;
+  case ProofRule::ImpliesIntro:
+  case ProofRule::ImpliesElim:
+  case ProofRule::AndIntro:
+  case ProofRule::EquivIntro:
+    return 2;
+  case ProofRule::OrElim:
+    return 3;
+  default:
+    return 1;
+  }
+}
+
+inline std::uint32_t load_word(const char *p) {
+  std::uint32_t x;
+  std::memcpy(&x, p, 4);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  x = __builtin_bswap32(x);
+#endif
+  return x;
+}
+
+inline void append_word(std::string &out, std::uint32_t x) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  x = __builtin_bswap32(x);
+#endif
+  char bytes[4];
+  std::memcpy(bytes, &x, 4);
+  out.append(bytes, 4);
+}
+
+// 步骤 DAG 的支配树。边是 "步骤使用前提" (ImpliesIntro 的 p0 只是声明消去哪个
+// 假设, 不算使用)。按编号降序处理时一个步骤的全部使用者都已处理过, 它的直接
+// 支配者就是这些使用者在支配树上的最近公共祖先, 用二进制提升求。
+// 假设 h 在根处已被消去, 当且仅当消去它的 ImpliesIntro 支配 h:
+// 从根到 h 的每条路径都经过那条 ImpliesIntro 的结论部分。
+class Dominators {
+public:
+  static constexpr std::uint32_t kNone = ~std::uint32_t{0};
+
+  Dominators(std::size_t steps, std::uint32_t root)
+      : idom_(steps, kNone), depth_(steps, 0) {
+    unsigned levels = 1;
+    while ((std::size_t{1} << levels) < steps) {
+      ++levels;
+    }
+    up_.assign(levels, std::vector<std::uint32_t>(steps, root));
+    idom_[root] = root;
+  }
+
+  bool reached(std::uint32_t step) const { return idom_[step] != kNone; }
+
+  // user 使用了 step; user 必须已经 finalize
+  void add_use(std::uint32_t user, std::uint32_t step) {
+    idom_[step] = idom_[step] == kNone ? user : lca(idom_[step], user);
+  }
+
+  // step 的全部使用者都已登记
+  void finalize(std::uint32_t step) {
+    std::uint32_t parent = idom_[step];
+    if (parent == step) {
+      return; // 根
+    }
+    depth_[step] = depth_[parent] + 1;
+    up_[0][step] = parent;
+    for (std::size_t k = 1; k < up_.size(); ++k) {
+      up_[k][step] = up_[k - 1][up_[k - 1][step]];
+    }
+  }
+
+  bool dominates(std::uint32_t d, std::uint32_t step) const {
+    return depth_[step] >= depth_[d] && lift(step, depth_[step] - depth_[d]) == d;
+  }
+
+private:
+  std::uint32_t lift(std::uint32_t step, std::uint32_t distance) const {
+    for (std::size_t k = 0; distance != 0; ++k, distance >>= 1) {
+      if ((distance & 1u) != 0) {
+        step = up_[k][step];
+      }
+    }
+    return step;
+  }
+
+  std::uint32_t lca(std::uint32_t a, std::uint32_t b) const {
+    if (depth_[a] < depth_[b]) {
+      std::swap(a, b);
+    }
+    a = lift(a, depth_[a] - depth_[b]);
+    if (a == b) {
+      return a;
+    }
+    for (std::size_t k = up_.size(); k-- > 0;) {
+      if (up_[k][a] != up_[k][b]) {
+        a = up_[k][a];
+        b = up_[k][b];
+      }
+    }
+    return up_[0][a];
+  }
+
+  std::vector<std::uint32_t> idom_;
+  std::vector<std::uint32_t> depth_;
+  std::vector<std::vector<std::uint32_t>> up_; // up_[k][v]: v 的第 2^k 个支配者祖先
+};
+
+} // namespace detail
+
+// --- Certificate Builder ---
+// 按组合子逐步记录证明。每个方法由前提的结论算出新步骤的结论,
+// 前提形状不符或假设被第二次消去时抛出 std::invalid_argument;
+// serialize 在根仍依赖未消去的假设时同样抛出, 所以写出的证书总能通过检查。
+class CertificateBuilder {
+public:
+  using Step = std::uint32_t;
+
+  FormulaStore &formulas() { return store_; }
+  const FormulaStore &formulas() const { return store_; }
+
+  NodeId conclusion(Step step) const { return steps_.at(step).conclusion; }
+  std::size_t size() const { return steps_.size(); }
+
+  Step hypothesis(NodeId formula) {
+    return add(ProofRule::Hypothesis, formula, {});
+  }
+  Step true_intro() { return add(ProofRule::TrueIntro, store_.constant(true), {}); }
+  // 消去假设 hyp: A, 由 body: B 得 A → B。一个假设只能被一个 implies_intro
+  // 消去, 在另一处推理时应使用新的 hypothesis
+  Step implies_intro(Step hyp, Step body) {
+    return add(ProofRule::ImpliesIntro,
+               store_.Implies(conclusion(hyp), conclusion(body)), {hyp, body});
+  }
+  // 消去假设 hyp: A, 由 body: False 得 ¬A
+  Step not_intro(Step hyp, Step body) {
+    return add(ProofRule::ImpliesIntro, store_.Not(conclusion(hyp)), {hyp, body});
+  }
+  Step modus_ponens(Step a, Step ab) {
+    return add(ProofRule::ImpliesElim, consequent(conclusion(ab)), {a, ab});
+  }
+  Step and_intro(Step a, Step b) {
+    return add(ProofRule::AndIntro, store_.And(conclusion(a), conclusion(b)), {a, b});
+  }
+  Step and_elim_left(Step ab) {
+    return add(ProofRule::AndElimLeft, store_.lhs(conclusion(ab)), {ab});
+  }
+  Step and_elim_right(Step ab) {
+    return add(ProofRule::AndElimRight, store_.rhs(conclusion(ab)), {ab});
+  }
+  Step or_intro_left(Step a, NodeId b) {
+    return add(ProofRule::OrIntroLeft, store_.Or(conclusion(a), b), {a});
+  }
+  Step or_intro_right(NodeId a, Step b) {
+    return add(ProofRule::OrIntroRight, store_.Or(a, conclusion(b)), {b});
+  }
+  Step or_elim(Step or_ab, Step ac, Step bc) {
+    return add(ProofRule::OrElim, consequent(conclusion(ac)), {or_ab, ac, bc});
+  }
+  Step principle_of_explosion(Step f, NodeId goal) {
+    return add(ProofRule::Explosion, goal, {f});
+  }
+  Step equiv_intro(Step ab, Step ba) {
+    NodeId f = conclusion(ab);
+    NodeId b = consequent(f);
+    return add(ProofRule::EquivIntro, store_.Equiv(store_.lhs(f), b), {ab, ba});
+  }
+  Step equiv_elim_left(Step e) {
+    NodeId f = expect(conclusion(e), Opcode::Equiv);
+    return add(ProofRule::EquivElimLeft, store_.Implies(store_.lhs(f), store_.rhs(f)), {e});
+  }
+  Step equiv_elim_right(Step e) {
+    NodeId f = expect(conclusion(e), Opcode::Equiv);
+    return add(ProofRule::EquivElimRight, store_.Implies(store_.rhs(f), store_.lhs(f)), {e});
+  }
+
+  // 只写出 root 用到的步骤与公式节点, 重新编号为紧凑的拓扑序。
+  // 根依赖未消去的假设 (包括在消去它的 implies_intro 之外使用) 时抛出
+  std::string serialize(Step root) const;
+
+private:
+  std::string write(Step root) const {
+    if (root >= steps_.size()) {
+      throw std::invalid_argument("CertificateBuilder: unknown step");
+    }
+    std::vector<bool> used_step(root + 1, false);
+    std::vector<bool> used_node(store_.size(), false);
+    used_step[root] = true;
+    for (Step s = root + 1; s-- > 0;) {
+      if (!used_step[s]) {
+        continue;
+      }
+      used_node[steps_[s].conclusion] = true;
+      for (unsigned k = 0; k < detail::proof_rule_arity(steps_[s].rule); ++k) {
+        used_step[steps_[s].premises[k]] = true;
+      }
+    }
+    for (NodeId id = static_cast<NodeId>(store_.size()); id-- > 0;) {
+      if (!used_node[id]) {
+        continue;
+      }
+      Opcode op = store_.op(id);
+      if (op == Opcode::Not) {
+        used_node[store_.lhs(id)] = true;
+      } else if (op != Opcode::Var && op != Opcode::True && op != Opcode::False) {
+        used_node[store_.lhs(id)] = true;
+        used_node[store_.rhs(id)] = true;
+      }
+    }
+
+    std::vector<std::uint32_t> node_index(store_.size());
+    std::vector<std::uint32_t> step_index(root + 1);
+    std::string nodes;
+    std::string steps;
+    std::uint32_t node_count = 0;
+    std::uint32_t step_count = 0;
+    for (NodeId id = 0; id < store_.size(); ++id) {
+      if (!used_node[id]) {
+        continue;
+      }
+      node_index[id] = node_count++;
+      Opcode op = store_.op(id);
+      std::uint32_t lhs = 0;
+      std::uint32_t rhs = 0;
+      if (op == Opcode::Var) {
+        lhs = store_.lhs(id);
+      } else if (op == Opcode::Not) {
+        lhs = node_index[store_.lhs(id)];
+      } else if (op != Opcode::True && op != Opcode::False) {
+        lhs = node_index[store_.lhs(id)];
+        rhs = node_index[store_.rhs(id)];
+      }
+      detail::append_word(nodes, static_cast<std::uint32_t>(op));
+      detail::append_word(nodes, lhs);
+      detail::append_word(nodes, rhs);
+    }
+    for (Step s = 0; s <= root; ++s) {
+      if (!used_step[s]) {
+        continue;
+      }
+      step_index[s] = step_count++;
+      const Record &r = steps_[s];
+      detail::append_word(steps, static_cast<std::uint32_t>(r.rule));
+      detail::append_word(steps, node_index[r.conclusion]);
+      unsigned arity = detail::proof_rule_arity(r.rule);
+      for (unsigned k = 0; k < 3; ++k) {
+        detail::append_word(steps, k < arity ? step_index[r.premises[k]] : 0);
+      }
+    }
+
+    std::string out(kCertificateMagic, 4);
+    detail::append_word(out, kCertificateVersion);
+    detail::append_word(out, node_count);
+    detail::append_word(out, step_count);
+    detail::append_word(out, step_count - 1);
+    return out + nodes + steps;
+  }
+
+  struct Record {
+    ProofRule rule;
+    NodeId conclusion;
+    Step premises[3];
+    bool discharged = false; // 假设已被某个 ImpliesIntro 消去
+  };
+
+  // FormulaStore 的只读视图, 供 ProofRules 使用
+  struct StoreNodes {
+    const FormulaStore &store;
+    Opcode op(std::uint32_t id) const { return store.op(id); }
+    std::uint32_t lhs(std::uint32_t id) const { return store.lhs(id); }
+    std::uint32_t rhs(std::uint32_t id) const { return store.rhs(id); }
+  };
+
+  NodeId expect(NodeId f, Opcode op) const {
+    if (store_.op(f) != op) {
+      throw std::invalid_argument("CertificateBuilder: premise has the wrong shape");
+    }
+    return f;
+  }
+
+  // 蕴含 A → B 或 ¬A 的后件
+  NodeId consequent(NodeId f) {
+    if (store_.op(f) == Opcode::Not) {
+      return store_.constant(false);
+    }
+    return store_.rhs(expect(f, Opcode::Implies));
+  }
+
+  Step add(ProofRule rule, NodeId conclusion, std::initializer_list<Step> premises) {
+    Record r{rule, conclusion, {0, 0, 0}};
+    std::uint32_t formulas[3] = {0, 0, 0};
+    unsigned k = 0;
+    for (Step p : premises) {
+      if (p >= steps_.size()) {
+        throw std::invalid_argument("CertificateBuilder: unknown step");
+      }
+      r.premises[k] = p;
+      formulas[k] = steps_[p].conclusion;
+      ++k;
+    }
+    StoreNodes nodes{store_};
+    bool p0_is_hypothesis =
+        k > 0 && steps_[r.premises[0]].rule == ProofRule::Hypothesis;
+    if (const char *error = detail::ProofRules<StoreNodes>(nodes).check(
+            rule, conclusion, formulas, p0_is_hypothesis)) {
+      throw std::invalid_argument(std::string("CertificateBuilder: ") + error);
+    }
+    if (rule == ProofRule::ImpliesIntro) {
+      Record &hyp = steps_[r.premises[0]];
+      if (hyp.discharged) {
+        throw std::invalid_argument("CertificateBuilder: hypothesis is already discharged");
+      }
+      hyp.discharged = true;
+    }
+    steps_.push_back(r);
+    return static_cast<Step>(steps_.size() - 1);
+  }
+
+  FormulaStore store_;
+  std::vector<Record> steps_;
+};
+
+// --- Certificate Checking ---
+
+struct CertificateCheck {
+  bool valid = false;
+  std::string error;    // 无效时的原因
+  FormulaStore store;   // 有效时: 定理的 DAG (只含从定理可达的节点)
+  NodeId theorem = 0;   // 定理在 store 中的编号
+
+  // 展开为后缀形式; 证书中共享的子公式会被展开, 大小可能是 DAG 的指数倍
+  Formula theorem_formula() const { return store.to_formula(theorem); }
+};
+
+// 在 bytes (通常是 MappedFile::bytes()) 上原地检查证书: 一遍扫描公式节点
+// (校验拓扑序与无重复), 一遍扫描步骤 (校验规则), 再从根反向一遍确认
+// 所有假设都已消去。总代价 O(m log m)。定理以 DAG 形式返回, 所以结论中
+// 共享的子公式不会被展开, 内存与证书大小成线性。
+inline CertificateCheck verify_certificate(std::string_view bytes) {
+  auto fail = [](std::string error) {
+    CertificateCheck check;
+    check.error = std::move(error);
+    return check;
+  };
+  const std::size_t header = kCertificateHeaderWords * 4;
+  if (bytes.size() < header ||
+      bytes.substr(0, 4) != std::string_view(kCertificateMagic, 4)) {
+    return fail("not a proof certificate");
+  }
+  const char *data = bytes.data();
+  if (detail::load_word(data + 4) != kCertificateVersion) {
+    return fail("unsupported certificate version");
+  }
+  const std::uint32_t node_count = detail::load_word(data + 8);
+  const std::uint32_t step_count = detail::load_word(data + 12);
+  const std::uint32_t root = detail::load_word(data + 16);
+  if ((bytes.size() - header) / 4 !=
+          std::uint64_t{3} * node_count + std::uint64_t{5} * step_count ||
+      (bytes.size() - header) % 4 != 0) {
+    return fail("certificate size does not match its header");
+  }
+  if (root >= step_count) {
+    return fail("root step out of range");
+  }
+
+  // 公式节点直接从映射的字节读取
+  struct MappedNodes {
+    const char *base;
+    Opcode op(std::uint32_t id) const {
+      return static_cast<Opcode>(detail::load_word(base + 12 * std::size_t{id}));
+    }
+    std::uint32_t lhs(std::uint32_t id) const {
+      return detail::load_word(base + 12 * std::size_t{id} + 4);
+    }
+    std::uint32_t rhs(std::uint32_t id) const {
+      return detail::load_word(base + 12 * std::size_t{id} + 8);
+    }
+  } nodes{data + header};
+
+  // 公式节点: 拓扑序且无重复 (开放寻址表)
+  std::vector<std::uint32_t> table(std::size_t{2} << (64 - __builtin_clzll(node_count | 1)),
+                                   ~0u);
+  const std::size_t mask = table.size() - 1;
+  for (std::uint32_t id = 0; id < node_count; ++id) {
+    std::uint32_t op = static_cast<std::uint32_t>(nodes.op(id));
+    std::uint32_t lhs = nodes.lhs(id);
+    std::uint32_t rhs = nodes.rhs(id);
+    bool ok;
+    switch (static_cast<Opcode>(op)) {
+    case Opcode::Var:
+      ok = lhs <= Formula::max_index && rhs == 0;
+      break;
+    case Opcode::True:
+    case Opcode::False:
+      ok = lhs == 0 && rhs == 0;
+      break;
+    case Opcode::Not:
+      ok = lhs < id && rhs == 0;
+      break;
+    case Opcode::And:
+    case Opcode::Or:
+    case Opcode::Implies:
+    case Opcode::Equiv:
+      ok = lhs < id && rhs < id;
+      break;
+    default:
+      ok = false;
+      break;
+    }
+    if (!ok) {
+      return fail("malformed formula node " + std::to_string(id));
+    }
+    std::uint64_t h = (std::uint64_t{lhs} << 32 | rhs) * 0x9E3779B97F4A7C15ull;
+    h ^= std::uint64_t{op} * 0xBF58476D1CE4E5B9ull;
+    std::size_t slot = static_cast<std::size_t>(h ^ (h >> 29)) & mask;
+    while (table[slot] != ~0u) {
+      std::uint32_t other = table[slot];
+      if (static_cast<std::uint32_t>(nodes.op(other)) == op &&
+          nodes.lhs(other) == lhs && nodes.rhs(other) == rhs) {
+        return fail("duplicate formula node " + std::to_string(id));
+      }
+      slot = (slot + 1) & mask;
+    }
+    table[slot] = id;
+  }
+
+  // 步骤
+  const char *steps = data + header + 12 * std::size_t{node_count};
+  detail::ProofRules<MappedNodes> rules(nodes);
+  std::vector<std::uint32_t> conclusions(step_count);
+  for (std::uint32_t s = 0; s < step_count; ++s) {
+    const char *w = steps + 20 * std::size_t{s};
+    std::uint32_t raw_rule = detail::load_word(w);
+    std::uint32_t c = detail::load_word(w + 4);
+    std::uint32_t premises[3] = {detail::load_word(w + 8), detail::load_word(w + 12),
+                                 detail::load_word(w + 16)};
+    if (raw_rule >= kProofRuleCount || c >= node_count) {
+      return fail("malformed step " + std::to_string(s));
+    }
+    ProofRule rule = static_cast<ProofRule>(raw_rule);
+    unsigned arity = detail::proof_rule_arity(rule);
+    std::uint32_t formulas[3] = {0, 0, 0};
+    for (unsigned k = 0; k < 3; ++k) {
+      if (k < arity ? premises[k] >= s : premises[k] != 0) {
+        return fail("malformed step " + std::to_string(s));
+      }
+      if (k < arity) {
+        formulas[k] = conclusions[premises[k]];
+      }
+    }
+    bool p0_is_hypothesis =
+        arity > 0 &&
+        detail::load_word(steps + 20 * std::size_t{premises[0]}) ==
+            static_cast<std::uint32_t>(ProofRule::Hypothesis);
+    if (const char *error = rules.check(rule, c, formulas, p0_is_hypothesis)) {
+      return fail("step " + std::to_string(s) + ": " + error);
+    }
+    conclusions[s] = c;
+  }
+
+  // 未消去的假设: 从根开始按编号降序建立支配树
+  detail::Dominators dominators(step_count, root);
+  std::vector<std::uint32_t> discharger(step_count, detail::Dominators::kNone);
+  for (std::uint32_t s = root + 1; s-- > 0;) {
+    if (!dominators.reached(s)) {
+      continue;
+    }
+    dominators.finalize(s);
+    const char *w = steps + 20 * std::size_t{s};
+    ProofRule rule = static_cast<ProofRule>(detail::load_word(w));
+    unsigned first = 0;
+    if (rule == ProofRule::ImpliesIntro) {
+      std::uint32_t hyp = detail::load_word(w + 8);
+      if (discharger[hyp] != detail::Dominators::kNone) {
+        return fail("hypothesis " + std::to_string(hyp) + " is discharged twice");
+      }
+      discharger[hyp] = s;
+      first = 1;
+    }
+    for (unsigned k = first; k < detail::proof_rule_arity(rule); ++k) {
+      dominators.add_use(s, detail::load_word(w + 8 + 4 * k));
+    }
+  }
+  for (std::uint32_t s = 0; s <= root; ++s) {
+    if (dominators.reached(s) &&
+        detail::load_word(steps + 20 * std::size_t{s}) ==
+            static_cast<std::uint32_t>(ProofRule::Hypothesis) &&
+        (discharger[s] == detail::Dominators::kNone ||
+         !dominators.dominates(discharger[s], s))) {
+      return fail("root depends on undischarged hypotheses");
+    }
+  }
+
+  // 定理: 把从结论可达的公式节点按编号升序复制到 FormulaStore
+  CertificateCheck check;
+  check.valid = true;
+  const std::uint32_t conclusion = conclusions[root];
+  std::vector<NodeId> copied(conclusion + 1, ~0u);
+  copied[conclusion] = 0;
+  for (std::uint32_t id = conclusion + 1; id-- > 0;) {
+    if (copied[id] == ~0u) {
+      continue;
+    }
+    Opcode op = nodes.op(id);
+    if (op != Opcode::Var && op != Opcode::True && op != Opcode::False) {
+      copied[nodes.lhs(id)] = 0;
+      if (op != Opcode::Not) {
+        copied[nodes.rhs(id)] = 0;
+      }
+    }
+  }
+  for (std::uint32_t id = 0; id <= conclusion; ++id) {
+    if (copied[id] == ~0u) {
+      continue;
+    }
+    Opcode op = nodes.op(id);
+    switch (op) {
+    case Opcode::Var:
+      copied[id] = check.store.var(nodes.lhs(id));
+      break;
+    case Opcode::True:
+    case Opcode::False:
+      copied[id] = check.store.constant(op == Opcode::True);
+      break;
+    case Opcode::Not:
+      copied[id] = check.store.Not(copied[nodes.lhs(id)]);
+      break;
+    case Opcode::And:
+      copied[id] = check.store.And(copied[nodes.lhs(id)], copied[nodes.rhs(id)]);
+      break;
+    case Opcode::Or:
+      copied[id] = check.store.Or(copied[nodes.lhs(id)], copied[nodes.rhs(id)]);
+      break;
+    case Opcode::Implies:
+      copied[id] = check.store.Implies(copied[nodes.lhs(id)], copied[nodes.rhs(id)]);
+      break;
+    default:
+      copied[id] = check.store.Equiv(copied[nodes.lhs(id)], copied[nodes.rhs(id)]);
+      break;
+    }
+  }
+  check.theorem = copied[conclusion];
+  return check;
+}
+
+inline std::string CertificateBuilder::serialize(Step root) const {
+  std::string out = write(root);
+  CertificateCheck check = verify_certificate(out);
+  if (!check.valid) {
+    throw std::invalid_argument("CertificateBuilder: " + check.error);
+  }
+  return out;
+}
+
+} // namespace cpp_prop::runtime
+
+#endif // PROOF_CERTIFICATE_H
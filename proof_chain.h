@@ -0,0 +1,100 @@
+#ifndef PROOF_CHAIN_H
+#define PROOF_CHAIN_H
+
+#include "nary_logic.h"
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// --- Fused Implication Chains ---
+// compose_chain<A>(f1, f2, ..., fn): A → ... 的 n 步三段论, 一次构造完成。
+// 反复调用 syllogism 得到的是 n 层嵌套的闭包, 每次调用要逐层转发;
+// 这里的 n 个前提平铺存放在同一个 AndN 中, 调用时从左到右依次求值,
+// 中间结果不经过任何类型擦除。
+// 参数中由 static_proof::syllogism / prove_syllogism_curried 产生的嵌套组合,
+// 以及已有的链, 都会被展开为单独的步骤; normalize_chain<A>(proof) 对单个证明做同样的规范化。
+// std::function 版本的 syllogism 结果已被擦除, 无法展开, 作为一个整体的步骤。
+
+namespace static_proof {
+namespace detail {
+
+// 第 I 步及之后的步骤作用于 x
+template <std::size_t I, typename Steps, typename X>
+constexpr auto run_chain(Steps &&steps, X &&x) CPP_PROP_NOEXCEPT {
+  if constexpr (I == std::tuple_size_v<std::decay_t<Steps>>) {
+    return std::forward<X>(x);
+  } else {
+    return run_chain<I + 1>(std::forward<Steps>(steps),
+                            get<I>(std::forward<Steps>(steps))(std::forward<X>(x)));
+  }
+}
+
+// 链本身就是各步骤的合取, 无捕获的步骤不占空间
+template <typename A, typename... Fs> struct Chain : AndN<Fs...> {
+  using Steps = AndN<Fs...>;
+
+  constexpr explicit Chain(Fs... fs) : Steps(std::move(fs)...) {}
+
+  constexpr auto operator()(A a) const & CPP_PROP_NOEXCEPT {
+    return run_chain<0>(static_cast<const Steps &>(*this), std::move(a));
+  }
+  constexpr auto operator()(A a) && CPP_PROP_NOEXCEPT {
+    return run_chain<0>(static_cast<Steps &&>(*this), std::move(a));
+  }
+};
+
+// 把一个证明拆成步骤的 tuple
+template <typename F> constexpr auto chain_steps(const F &f) {
+  return std::tuple<F>(f);
+}
+
+template <typename A, typename C, typename AB, typename BC>
+constexpr auto chain_steps(const Composition<A, C, AB, BC> &c) {
+  return std::tuple_cat(chain_steps(c.ab), chain_steps(c.bc));
+}
+
+template <typename A, typename... Fs, std::size_t... Is>
+constexpr auto chain_steps(const Chain<A, Fs...> &c, std::index_sequence<Is...>) {
+  return std::tuple_cat(chain_steps(get<Is>(c))...);
+}
+
+template <typename A, typename... Fs>
+constexpr auto chain_steps(const Chain<A, Fs...> &c) {
+  return chain_steps(c, std::index_sequence_for<Fs...>{});
+}
+
+template <typename A, typename... Fs>
+constexpr Chain<A, Fs...> make_chain(std::tuple<Fs...> steps) {
+  return std::apply(
+      [](Fs &...fs) { return Chain<A, Fs...>(std::move(fs)...); },
+      steps);
+}
+
+} // namespace detail
+
+// A → ... → Z, 其中每个 fi 的结论是 f(i+1) 的前提
+template <typename A, typename... Fs> constexpr auto compose_chain(const Fs &...fs) {
+  static_assert(sizeof...(Fs) > 0, "compose_chain: 至少需要一个前提");
+  auto chain = detail::make_chain<A>(std::tuple_cat(detail::chain_steps(fs)...));
+  static_assert(std::is_invocable_v<const decltype(chain) &, A>,
+                "compose_chain: 相邻前提的结论与前提不匹配");
+  return chain;
+}
+
+// 把嵌套的 syllogism 组合展平为一条链
+template <typename A, typename F> constexpr auto normalize_chain(const F &proof) {
+  return static_proof::compose_chain<A>(proof);
+}
+
+} // namespace static_proof
+
+// 类型擦除版本: 整条链只在最外层擦除一次, 每个前提恰好被调用一次
+template <typename A, typename Policy = StdFunctionPolicy, typename... Fs>
+auto compose_chain(Fs... fs) {
+  return bind_proof<Policy, A, proof_stats::ComposeChain>(
+      static_proof::compose_chain<A>(std::move(fs)...));
+}
+
+#endif // PROOF_CHAIN_H
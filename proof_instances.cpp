@@ -0,0 +1,8 @@
+#include "constructive_logic.h"
+
+// constructive_logic.h 中常用组合子实例的唯一定义, 编入 cpp_prop_proofs。
+// 只有以默认配置 (未开启计数、未关闭异常) 编译的目标才会链接这里。
+
+#define CPP_PROP_INSTANCE(...) template __VA_ARGS__;
+CPP_PROP_COMMON_INSTANCES(CPP_PROP_INSTANCE)
+#undef CPP_PROP_INSTANCE
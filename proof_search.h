@@ -0,0 +1,1062 @@
+#ifndef PROOF_SEARCH_H
+#define PROOF_SEARCH_H
+
+#include "proof_certificate.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// --- Intuitionistic Proof Search ---
+// 直觉主义命题逻辑的判定过程, 基于 Dyckhoff 的无收缩演算 G4ip (LJT)。
+// G4ip 的每条规则都使前提比结论 "小", 所以搜索不需要环路检测就必然终止,
+// 找不到证明就说明公式没有构造性证明 (例如排中律 p ∨ ¬p、皮尔士定律)。
+//
+// 搜索顺序: 先做可逆规则 (左侧 ∧ ↔ ⊤ ⊥ 的分解、p → B 与 p 的假言推理、
+// (C ∧ D) → B 等蕴含的改写、右侧 ⊤ ∧ → ↔、左侧 ∨), 它们不会丢失可证性;
+// 剩下的不可逆选择 (右侧 ∨ 选哪一边、对哪个 (C → D) → B 做左规则) 在饱和的
+// 相继式上进行, 这些相继式的结果 (可证时记录成功的选择) 存入备忘表。进入不可逆
+// 选择之前先找经典反例: 直觉主义可证的相继式经典有效, 随机公式的大部分分支
+// 都在这里直接失败。
+//
+// 证明以 proof_certificate.h 的步骤给出, 规则对应 constructive_logic.h 的组合子:
+// →R 是 lambda (ImpliesIntro), p → B 的消去是 modus_ponens, ∨L 是 or_elim,
+// ⊥ 是 principle_of_explosion, 等等。先只做判定, 再沿备忘表记录的选择构造证明,
+// 所以失败的分支不会留下证明步骤; 重复出现的饱和相继式共享同一个引理。
+//
+// 判定可以并行: 需要两个前提都成立的规则 (右 ∧、左 ∨、(C → D) → B 的左规则)
+// 与不可逆规则的各个选择作为任务放进 work-stealing 线程池, 所有线程共享一个
+// 分片加锁的备忘表。某个选择成功或某个前提失败时, 同一分支点上其余的任务被取消;
+// 被取消的结果不进入备忘表。证明的构造仍然是单线程的。
+
+namespace cpp_prop::runtime {
+
+struct ProofSearchOptions {
+  unsigned threads = 1; // 判定阶段的线程数, 0 表示 std::thread::hardware_concurrency()
+};
+
+namespace detail {
+
+// 搜索中会用到的派生公式。搜索开始前一次算好, 搜索期间 FormulaStore 只读。
+class SearchClosure {
+public:
+  static constexpr NodeId kNone = ~NodeId{0};
+
+  // 对 A ↔ B: first = A → B, second = B → A
+  // 对上下文中的 A → B (或 ¬A, 此时 B 为 ⊥), 按前件 A 的形状:
+  //   C ∧ D: first = C → (D → B)
+  //   C ∨ D: first = C → B, second = D → B
+  //   C ↔ D: first = ((C → D) ∧ (D → C)) → B, second = (C → D) ∧ (D → C)
+  //   C → D 或 ¬C: first = D → B
+  struct Derived {
+    NodeId first = kNone;
+    NodeId second = kNone;
+  };
+
+  // 变量不超过这么多个时, 为每个公式记录它在所有经典赋值下的真值
+  static constexpr unsigned kCountermodelVars = 10;
+
+  NodeId falsum() const { return falsum_; }
+  const Derived &operator[](NodeId f) const { return derived_[f]; }
+
+  // key 为上下文加目标。直觉主义可证的相继式经典有效, 所以存在使上下文全真、
+  // 目标为假的赋值时, 相继式不可证
+  bool has_countermodel(const std::vector<NodeId> &key) const {
+    if (words_ == 0) {
+      return false;
+    }
+    for (NodeId f : key) {
+      if (std::size_t{f} * words_ >= tables_.size()) {
+        return false;
+      }
+    }
+    for (std::size_t w = 0; w < words_; ++w) {
+      std::uint64_t rows = ~tables_[std::size_t{key.back()} * words_ + w];
+      for (std::size_t i = 0; rows != 0 && i + 1 < key.size(); ++i) {
+        rows &= tables_[std::size_t{key[i]} * words_ + w];
+      }
+      if (rows != 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // 为 root 能到达的所有公式 (包括派生出的公式) 计算派生公式
+  void extend(FormulaStore &store, NodeId root) {
+    falsum_ = store.constant(false);
+    std::vector<NodeId> work{root, falsum_};
+    while (!work.empty()) {
+      NodeId f = work.back();
+      work.pop_back();
+      if (f >= visited_.size()) {
+        visited_.resize(store.size(), false);
+        derived_.resize(store.size());
+      }
+      if (visited_[f]) {
+        continue;
+      }
+      visited_[f] = true;
+      Derived d;
+      switch (store.op(f)) {
+      case Opcode::Not:
+        work.push_back(store.lhs(f));
+        d = implication(store, store.lhs(f), falsum_);
+        break;
+      case Opcode::Implies:
+        work.push_back(store.lhs(f));
+        work.push_back(store.rhs(f));
+        d = implication(store, store.lhs(f), store.rhs(f));
+        break;
+      case Opcode::Equiv:
+        work.push_back(store.lhs(f));
+        work.push_back(store.rhs(f));
+        d = {store.Implies(store.lhs(f), store.rhs(f)),
+             store.Implies(store.rhs(f), store.lhs(f))};
+        break;
+      case Opcode::And:
+      case Opcode::Or:
+        work.push_back(store.lhs(f));
+        work.push_back(store.rhs(f));
+        break;
+      default:
+        break;
+      }
+      derived_[f] = d;
+      for (NodeId g : {d.first, d.second}) {
+        if (g != kNone) {
+          work.push_back(g);
+        }
+      }
+    }
+    tabulate(store);
+  }
+
+private:
+  Derived implication(FormulaStore &store, NodeId a, NodeId b) {
+    switch (store.op(a)) {
+    case Opcode::And:
+      return {store.Implies(store.lhs(a), store.Implies(store.rhs(a), b)), kNone};
+    case Opcode::Or:
+      return {store.Implies(store.lhs(a), b), store.Implies(store.rhs(a), b)};
+    case Opcode::Equiv: {
+      NodeId c = store.lhs(a);
+      NodeId d = store.rhs(a);
+      NodeId both = store.And(store.Implies(c, d), store.Implies(d, c));
+      return {store.Implies(both, b), both};
+    }
+    case Opcode::Implies:
+      return {store.Implies(store.rhs(a), b), kNone};
+    case Opcode::Not:
+      return {store.Implies(falsum_, b), kNone};
+    default:
+      return {};
+    }
+  }
+
+  // 每个公式的真值表, 每 64 个赋值一个字; 变量太多时为空
+  void tabulate(const FormulaStore &store) {
+    std::vector<std::uint32_t> vars;
+    for (NodeId f = 0; f < store.size(); ++f) {
+      if (store.op(f) == Opcode::Var) {
+        vars.push_back(store.lhs(f));
+      }
+    }
+    std::sort(vars.begin(), vars.end());
+    vars.erase(std::unique(vars.begin(), vars.end()), vars.end());
+    tables_.clear();
+    words_ = 0;
+    if (vars.size() > kCountermodelVars) {
+      return;
+    }
+    words_ = vars.size() > 6 ? std::size_t{1} << (vars.size() - 6) : 1;
+    tables_.resize(store.size() * words_);
+    static constexpr std::uint64_t kLowBits[6] = {
+        0xAAAAAAAAAAAAAAAAull, 0xCCCCCCCCCCCCCCCCull, 0xF0F0F0F0F0F0F0F0ull,
+        0xFF00FF00FF00FF00ull, 0xFFFF0000FFFF0000ull, 0xFFFFFFFF00000000ull};
+    for (NodeId f = 0; f < store.size(); ++f) {
+      const Opcode op = store.op(f);
+      const bool leaf = op == Opcode::Var || op == Opcode::True || op == Opcode::False;
+      std::uint64_t *out = &tables_[std::size_t{f} * words_];
+      const std::uint64_t *a = leaf ? out : &tables_[std::size_t{store.lhs(f)} * words_];
+      const std::uint64_t *b = leaf ? out : &tables_[std::size_t{store.rhs(f)} * words_];
+      for (std::size_t w = 0; w < words_; ++w) {
+        switch (op) {
+        case Opcode::Var: {
+          std::size_t j = static_cast<std::size_t>(
+              std::lower_bound(vars.begin(), vars.end(), store.lhs(f)) - vars.begin());
+          out[w] = j < 6 ? kLowBits[j] : ((w >> (j - 6)) & 1) != 0 ? ~0ull : 0;
+          break;
+        }
+        case Opcode::True:
+          out[w] = ~0ull;
+          break;
+        case Opcode::False:
+          out[w] = 0;
+          break;
+        case Opcode::Not:
+          out[w] = ~a[w];
+          break;
+        case Opcode::And:
+          out[w] = a[w] & b[w];
+          break;
+        case Opcode::Or:
+          out[w] = a[w] | b[w];
+          break;
+        case Opcode::Implies:
+          out[w] = ~a[w] | b[w];
+          break;
+        case Opcode::Equiv:
+          out[w] = ~(a[w] ^ b[w]);
+          break;
+        }
+      }
+    }
+  }
+
+  std::vector<Derived> derived_;
+  std::vector<bool> visited_;
+  NodeId falsum_ = kNone;
+  std::vector<std::uint64_t> tables_;
+  std::size_t words_ = 0;
+};
+
+// 饱和相继式的键: 上下文中的公式按编号排序, 末尾是目标
+struct SequentHash {
+  std::size_t operator()(const std::vector<NodeId> &key) const {
+    std::uint64_t h = key.size();
+    for (NodeId id : key) {
+      h = (h ^ id) * 0x9E3779B97F4A7C15ull;
+      h ^= h >> 32;
+    }
+    return static_cast<std::size_t>(h);
+  }
+};
+
+// 饱和相继式 (上下文按编号排序, 末尾是目标) 的判定结果, 按目标分片加锁。
+// 结果与上下文的位置无关: 可证时记录成功的选择 (右 ∨ 的分支, 或左规则所用的公式),
+// 不可证时记录 kFailed。直觉主义逻辑允许弱化, 所以精确查找不命中时, 已证的相继式
+// 也覆盖上下文更大的相继式, 不可证的也覆盖上下文更小的相继式; 同一目标的记录
+// 用 64 位签名 (编号的位集合) 先排除大部分候选, 再用 std::includes 确认。
+class SequentMemo {
+public:
+  static constexpr std::int64_t kFailed = -1;
+
+  SequentMemo() : shards_(new Shard[kShards]) {}
+
+  bool find(const std::vector<NodeId> &key, std::int64_t &result) const {
+    const Shard &shard = shard_for(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.map.find(key);
+    if (it != shard.map.end()) {
+      result = it->second;
+      return true;
+    }
+    auto goal = shard.goals.find(key.back());
+    if (goal == shard.goals.end()) {
+      return false;
+    }
+    const std::uint64_t sig = signature(key);
+    const std::size_t size = key.size();
+    const std::vector<Entry> &entries = goal->second;
+    const std::size_t first = entries.size() > kScan ? entries.size() - kScan : 0;
+    for (std::size_t i = entries.size(); i-- > first;) {
+      const Entry &e = entries[i];
+      const std::vector<NodeId> &other = e.key->first;
+      bool covers;
+      if (e.key->second == kFailed) {
+        covers = (sig & ~e.signature) == 0 && size < other.size() &&
+                 std::includes(other.begin(), other.end() - 1, key.begin(), key.end() - 1);
+      } else {
+        covers = (e.signature & ~sig) == 0 && other.size() < size &&
+                 std::includes(key.begin(), key.end() - 1, other.begin(), other.end() - 1);
+      }
+      if (covers) {
+        result = e.key->second;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void insert(std::vector<NodeId> key, std::int64_t result) {
+    Shard &shard = shard_for(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    const std::uint64_t sig = signature(key);
+    const NodeId goal = key.back();
+    auto inserted = shard.map.emplace(std::move(key), result);
+    if (inserted.second) {
+      shard.goals[goal].push_back(Entry{sig, &*inserted.first});
+    }
+  }
+
+  std::size_t size() const {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < kShards; ++i) {
+      std::lock_guard<std::mutex> lock(shards_[i].mutex);
+      total += shards_[i].map.size();
+    }
+    return total;
+  }
+
+private:
+  static constexpr std::size_t kShards = 64;
+  static constexpr std::size_t kScan = 256; // 子集查找只检查同一目标最近的记录
+
+  using Map = std::unordered_map<std::vector<NodeId>, std::int64_t, SequentHash>;
+
+  // 同一目标的记录; 指向 map 中的元素 (unordered_map 的元素地址不会改变)
+  struct Entry {
+    std::uint64_t signature; // 上下文的签名
+    const Map::value_type *key;
+  };
+
+  struct alignas(64) Shard {
+    mutable std::mutex mutex;
+    Map map;
+    std::unordered_map<NodeId, std::vector<Entry>> goals;
+  };
+
+  // 同一目标的相继式在同一分片, 子集查找只需锁一个分片
+  Shard &shard_for(const std::vector<NodeId> &key) const {
+    return shards_[(key.back() * 0x9E3779B9u >> 16) % kShards];
+  }
+
+  static std::uint64_t signature(const std::vector<NodeId> &key) {
+    std::uint64_t sig = 0;
+    for (std::size_t i = 0; i + 1 < key.size(); ++i) {
+      sig |= std::uint64_t{1} << ((key[i] * 0x9E3779B9u) >> 26);
+    }
+    return sig;
+  }
+
+  std::unique_ptr<Shard[]> shards_;
+};
+
+// fork/join 线程池。每个线程有自己的任务队列, 从后端取自己的任务, 从其他线程
+// 队列的前端偷任务; join 时如果任务还没完成, 就执行别的任务帮忙。
+// 调用者线程是 0 号工作线程。
+class TaskPool {
+public:
+  struct Task {
+    explicit Task(std::function<void(unsigned)> run) : run(std::move(run)) {}
+    std::function<void(unsigned)> run; // 参数是执行它的工作线程
+    std::atomic<bool> done{false};
+  };
+
+  explicit TaskPool(unsigned threads)
+      : queues_(new Queue[threads]), threads_(threads), idle_(threads - 1) {
+    for (unsigned t = 1; t < threads; ++t) {
+      helpers_.emplace_back([this, t] { work(t); });
+    }
+  }
+
+  ~TaskPool() {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread &thread : helpers_) {
+      thread.join();
+    }
+  }
+
+  TaskPool(const TaskPool &) = delete;
+  TaskPool &operator=(const TaskPool &) = delete;
+
+  unsigned size() const { return threads_; }
+  // 有线程空闲时才值得拆出任务
+  bool has_idle() const { return idle_.load(std::memory_order_relaxed) > 0; }
+  std::size_t steals() const { return steals_.load(std::memory_order_relaxed); }
+
+  void fork(unsigned worker, Task &task) {
+    // 先计数再发布: 任务入队后可能立刻被取走并减一, 计数不能先于入队减到负数
+    pending_.fetch_add(1, std::memory_order_release);
+    {
+      std::lock_guard<std::mutex> lock(queues_[worker].mutex);
+      queues_[worker].tasks.push_back(&task);
+    }
+    if (has_idle()) {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      wake_.notify_one();
+    }
+  }
+
+  void join(unsigned worker, Task &task) {
+    while (!task.done.load(std::memory_order_acquire)) {
+      if (Task *other = take(worker)) {
+        execute(*other, worker);
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+private:
+  struct alignas(64) Queue {
+    std::mutex mutex;
+    std::deque<Task *> tasks;
+  };
+
+  Task *take(unsigned worker) {
+    Task *task = nullptr;
+    {
+      Queue &own = queues_[worker];
+      std::lock_guard<std::mutex> lock(own.mutex);
+      if (!own.tasks.empty()) {
+        task = own.tasks.back();
+        own.tasks.pop_back();
+      }
+    }
+    for (unsigned i = 1; task == nullptr && i < threads_; ++i) {
+      Queue &victim = queues_[(worker + i) % threads_];
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      if (!victim.tasks.empty()) {
+        task = victim.tasks.front();
+        victim.tasks.pop_front();
+        steals_.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+    if (task != nullptr) {
+      pending_.fetch_sub(1, std::memory_order_relaxed);
+    }
+    return task;
+  }
+
+  static void execute(Task &task, unsigned worker) {
+    task.run(worker);
+    task.done.store(true, std::memory_order_release);
+  }
+
+  // 辅助线程只在执行任务期间不算空闲
+  void work(unsigned self) {
+    while (true) {
+      if (Task *task = take(self)) {
+        idle_.fetch_sub(1, std::memory_order_relaxed);
+        execute(*task, self);
+        idle_.fetch_add(1, std::memory_order_relaxed);
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      wake_.wait(lock, [this] {
+        return stop_ || pending_.load(std::memory_order_acquire) > 0;
+      });
+      if (stop_) {
+        return;
+      }
+    }
+  }
+
+  std::unique_ptr<Queue[]> queues_;
+  unsigned threads_;
+  std::atomic<unsigned> idle_;
+  std::atomic<std::size_t> pending_{0};
+  std::atomic<std::size_t> steals_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  bool stop_ = false;
+  std::vector<std::thread> helpers_;
+};
+
+} // namespace detail
+
+class ProofSearch {
+public:
+  using Step = CertificateBuilder::Step;
+
+  struct Stats {
+    std::size_t sequents = 0;  // 备忘表中的饱和相继式数
+    std::size_t memo_hits = 0;
+    std::size_t countermodels = 0; // 因经典反例直接判为不可证的相继式数
+    std::size_t rule_applications = 0;
+    std::size_t tasks = 0;     // 并行判定时拆出的任务数
+    std::size_t steals = 0;
+  };
+
+  // 公式与证明步骤都记录在 builder 中
+  explicit ProofSearch(CertificateBuilder &builder, const ProofSearchOptions &options = {})
+      : proof_(builder), store_(builder.formulas()), options_(options) {}
+
+  bool provable(NodeId goal) { return decide(goal); }
+
+  // 可证时返回 true, 并把没有未消去假设的根步骤写入 root
+  bool prove(NodeId goal, Step &root) {
+    if (!decide(goal)) {
+      return false;
+    }
+    Branch sequential{0, nullptr};
+    return solve({}, goal, &root, sequential) == Outcome::Proved;
+  }
+
+  Stats stats() const {
+    Stats stats;
+    stats.sequents = memo_.size();
+    stats.steals = steals_;
+    for (const Counters &c : counters_) {
+      stats.memo_hits += c.memo_hits;
+      stats.countermodels += c.countermodels;
+      stats.rule_applications += c.rule_applications;
+      stats.tasks += c.tasks;
+    }
+    return stats;
+  }
+
+private:
+  static constexpr Step kNoStep = ~Step{0};
+  static constexpr int kUnprovable = -1;
+
+  enum class Outcome { Proved, Failed, Cancelled };
+
+  // 上下文中的公式及其证明步骤 (只判定时为 kNoStep)
+  struct Entry {
+    NodeId f;
+    Step step;
+  };
+  using Context = std::vector<Entry>;
+
+  // 一个分支点上的任务共享的取消标志; 祖先被取消时也视为取消
+  struct Scope {
+    std::atomic<bool> cancelled{false};
+    const Scope *parent = nullptr;
+
+    bool stopped() const {
+      for (const Scope *s = this; s != nullptr; s = s->parent) {
+        if (s->cancelled.load(std::memory_order_relaxed)) {
+          return true;
+        }
+      }
+      return false;
+    }
+  };
+
+  struct Branch {
+    unsigned worker;
+    const Scope *scope;
+  };
+
+  struct alignas(64) Counters {
+    std::size_t memo_hits = 0;
+    std::size_t countermodels = 0;
+    std::size_t rule_applications = 0;
+    std::size_t tasks = 0;
+  };
+
+  bool decide(NodeId goal) {
+    closure_.extend(store_, goal);
+    unsigned threads = options_.threads != 0 ? options_.threads
+                                             : std::thread::hardware_concurrency();
+    threads = std::max(threads, 1u);
+    counters_.resize(std::max<std::size_t>(counters_.size(), threads));
+    Branch root{0, nullptr};
+    if (threads == 1) {
+      return solve({}, goal, nullptr, root) == Outcome::Proved;
+    }
+    detail::TaskPool pool(threads);
+    pool_ = &pool;
+    Outcome outcome = solve({}, goal, nullptr, root);
+    pool_ = nullptr;
+    steals_ += pool.steals();
+    return outcome == Outcome::Proved;
+  }
+
+  bool is_implication(NodeId f) const {
+    Opcode op = store_.op(f);
+    return op == Opcode::Implies || op == Opcode::Not;
+  }
+  NodeId consequent(NodeId f) const {
+    return store_.op(f) == Opcode::Not ? closure_.falsum() : store_.rhs(f);
+  }
+
+  // 由假设 hyp: A 与 body 得到结论 target (A → B 或 ¬A)
+  Step intro(NodeId target, Step hyp, Step body) {
+    return store_.op(target) == Opcode::Not ? proof_.not_intro(hyp, body)
+                                            : proof_.implies_intro(hyp, body);
+  }
+
+  // 反复应用可逆的左规则, 直到上下文只剩原子、⊥、析取、前件为原子
+  // (且该原子不在上下文中) 的蕴含, 以及前件为蕴含的蕴含
+  void saturate(Context &ctx, bool build, Counters &counters) {
+    Context work = std::move(ctx);
+    ctx.clear();
+    Context stuck; // p → B, p 尚未出现
+    std::unordered_map<NodeId, Step> atoms;
+    auto step = [build](auto make) { return build ? make() : kNoStep; };
+
+    while (!work.empty()) {
+      Entry e = work.back();
+      work.pop_back();
+      switch (store_.op(e.f)) {
+      case Opcode::True:
+        break;
+      case Opcode::And:
+        work.push_back({store_.lhs(e.f), step([&] { return proof_.and_elim_left(e.step); })});
+        work.push_back({store_.rhs(e.f), step([&] { return proof_.and_elim_right(e.step); })});
+        break;
+      case Opcode::Equiv:
+        work.push_back({closure_[e.f].first, step([&] { return proof_.equiv_elim_left(e.step); })});
+        work.push_back({closure_[e.f].second, step([&] { return proof_.equiv_elim_right(e.step); })});
+        break;
+      case Opcode::Var:
+        if (atoms.emplace(e.f, e.step).second) {
+          ctx.push_back(e);
+          // 等待这个原子的蕴含现在可以消去
+          for (std::size_t i = 0; i < stuck.size();) {
+            if (store_.lhs(stuck[i].f) == e.f) {
+              Entry imp = stuck[i];
+              work.push_back({consequent(imp.f),
+                              step([&] { return proof_.modus_ponens(e.step, imp.step); })});
+              stuck[i] = stuck.back();
+              stuck.pop_back();
+            } else {
+              ++i;
+            }
+          }
+        }
+        break;
+      case Opcode::False:
+      case Opcode::Or:
+        ctx.push_back(e);
+        break;
+      case Opcode::Implies:
+      case Opcode::Not:
+        rewrite_implication(e, build, atoms, work, stuck, ctx);
+        break;
+      }
+      ++counters.rule_applications;
+    }
+    ctx.insert(ctx.end(), stuck.begin(), stuck.end());
+    std::sort(ctx.begin(), ctx.end(),
+              [](const Entry &x, const Entry &y) { return x.f < y.f; });
+    ctx.erase(std::unique(ctx.begin(), ctx.end(),
+                          [](const Entry &x, const Entry &y) { return x.f == y.f; }),
+              ctx.end());
+  }
+
+  // 上下文中的 A → B (或 ¬A) 按前件 A 的形状处理
+  void rewrite_implication(const Entry &e, bool build,
+                           const std::unordered_map<NodeId, Step> &atoms,
+                           Context &work, Context &stuck, Context &ctx) {
+    NodeId a = store_.lhs(e.f);
+    NodeId b = consequent(e.f);
+    const detail::SearchClosure::Derived &derived = closure_[e.f];
+    switch (store_.op(a)) {
+    case Opcode::True:
+      // ⊤ → B 就是 B
+      work.push_back({b, build ? proof_.modus_ponens(proof_.true_intro(), e.step) : kNoStep});
+      break;
+    case Opcode::False:
+      // ⊥ → B 没有用处
+      break;
+    case Opcode::Var: {
+      auto it = atoms.find(a);
+      if (it != atoms.end()) {
+        work.push_back({b, build ? proof_.modus_ponens(it->second, e.step) : kNoStep});
+      } else {
+        stuck.push_back(e);
+      }
+      break;
+    }
+    case Opcode::And: {
+      // (C ∧ D) → B  ⇒  C → (D → B), 证明: λc. λd. f (c, d)
+      Step s = kNoStep;
+      if (build) {
+        Step hc = proof_.hypothesis(store_.lhs(a));
+        Step hd = proof_.hypothesis(store_.rhs(a));
+        s = proof_.implies_intro(
+            hc, proof_.implies_intro(
+                    hd, proof_.modus_ponens(proof_.and_intro(hc, hd), e.step)));
+      }
+      work.push_back({derived.first, s});
+      break;
+    }
+    case Opcode::Or: {
+      // (C ∨ D) → B  ⇒  C → B, D → B
+      NodeId c = store_.lhs(a);
+      NodeId d = store_.rhs(a);
+      Step left = kNoStep;
+      Step right = kNoStep;
+      if (build) {
+        Step hc = proof_.hypothesis(c);
+        left = proof_.implies_intro(
+            hc, proof_.modus_ponens(proof_.or_intro_left(hc, d), e.step));
+        Step hd = proof_.hypothesis(d);
+        right = proof_.implies_intro(
+            hd, proof_.modus_ponens(proof_.or_intro_right(c, hd), e.step));
+      }
+      work.push_back({derived.first, left});
+      work.push_back({derived.second, right});
+      break;
+    }
+    case Opcode::Equiv: {
+      // (C ↔ D) → B  ⇒  ((C → D) ∧ (D → C)) → B
+      Step s = kNoStep;
+      if (build) {
+        Step h = proof_.hypothesis(derived.second);
+        Step equiv = proof_.equiv_intro(proof_.and_elim_left(h), proof_.and_elim_right(h));
+        s = proof_.implies_intro(h, proof_.modus_ponens(equiv, e.step));
+      }
+      work.push_back({derived.first, s});
+      break;
+    }
+    default:
+      // (C → D) → B: 留给不可逆的左规则
+      ctx.push_back(e);
+      break;
+    }
+  }
+
+  static Context with(Context ctx, Entry e) {
+    ctx.push_back(e);
+    return ctx;
+  }
+  static Context without(const Context &ctx, std::size_t index) {
+    Context rest;
+    rest.reserve(ctx.size() - 1);
+    for (std::size_t i = 0; i < ctx.size(); ++i) {
+      if (i != index) {
+        rest.push_back(ctx[i]);
+      }
+    }
+    return rest;
+  }
+
+  bool parallel(bool build) const { return !build && pool_ != nullptr && pool_->has_idle(); }
+
+  // 两个前提都要成立。并行时第二个前提作为任务拆出, 任何一个失败就取消另一个。
+  template <typename First, typename Second>
+  Outcome both(const Branch &branch, bool build, First first, Second second) {
+    if (!parallel(build)) {
+      Outcome outcome = first(branch);
+      return outcome == Outcome::Proved ? second(branch) : outcome;
+    }
+    Scope scope;
+    scope.parent = branch.scope;
+    Outcome second_outcome = Outcome::Cancelled;
+    detail::TaskPool::Task task([&](unsigned worker) {
+      second_outcome = second(Branch{worker, &scope});
+      if (second_outcome == Outcome::Failed) {
+        scope.cancelled.store(true, std::memory_order_relaxed);
+      }
+    });
+    ++counters_[branch.worker].tasks;
+    pool_->fork(branch.worker, task);
+    Outcome first_outcome = first(Branch{branch.worker, &scope});
+    if (first_outcome == Outcome::Failed) {
+      scope.cancelled.store(true, std::memory_order_relaxed);
+    }
+    pool_->join(branch.worker, task);
+    if (first_outcome == Outcome::Failed || second_outcome == Outcome::Failed) {
+      return Outcome::Failed;
+    }
+    if (first_outcome == Outcome::Proved && second_outcome == Outcome::Proved) {
+      return Outcome::Proved;
+    }
+    return Outcome::Cancelled;
+  }
+
+  // 不可逆的选择, 任意一个成立即可。并行时除第一个外都拆成任务, 成功的选择写入 winner。
+  Outcome any(const Context &ctx, NodeId goal, const std::vector<int> &choices,
+              const Branch &branch, int &winner) {
+    if (!parallel(false) || choices.size() < 2) {
+      for (int c : choices) {
+        Outcome outcome = apply(ctx, goal, c, nullptr, branch);
+        if (outcome != Outcome::Failed) {
+          winner = c;
+          return outcome;
+        }
+      }
+      return Outcome::Failed;
+    }
+    Scope scope;
+    scope.parent = branch.scope;
+    std::atomic<int> won{kUnprovable};
+    std::atomic<bool> interrupted{false};
+    auto run = [&](int c, const Branch &b) {
+      Outcome outcome = apply(ctx, goal, c, nullptr, b);
+      if (outcome == Outcome::Proved) {
+        int none = kUnprovable;
+        won.compare_exchange_strong(none, c, std::memory_order_relaxed);
+        scope.cancelled.store(true, std::memory_order_relaxed);
+      } else if (outcome == Outcome::Cancelled) {
+        interrupted.store(true, std::memory_order_relaxed);
+      }
+    };
+    std::vector<std::unique_ptr<detail::TaskPool::Task>> tasks;
+    for (std::size_t i = 1; i < choices.size(); ++i) {
+      int c = choices[i];
+      tasks.push_back(std::make_unique<detail::TaskPool::Task>(
+          [&run, &scope, c](unsigned worker) { run(c, Branch{worker, &scope}); }));
+      pool_->fork(branch.worker, *tasks.back());
+    }
+    counters_[branch.worker].tasks += tasks.size();
+    run(choices[0], Branch{branch.worker, &scope});
+    for (auto it = tasks.rbegin(); it != tasks.rend(); ++it) {
+      pool_->join(branch.worker, **it);
+    }
+    winner = won.load(std::memory_order_relaxed);
+    if (winner != kUnprovable) {
+      return Outcome::Proved;
+    }
+    return interrupted.load(std::memory_order_relaxed) ? Outcome::Cancelled
+                                                       : Outcome::Failed;
+  }
+
+  // ctx ⇒ goal; out 非空时构造证明 (只在单线程下进行)
+  Outcome solve(Context ctx, NodeId goal, Step *out, const Branch &branch) {
+    const bool build = out != nullptr;
+    if (branch.scope != nullptr && branch.scope->stopped()) {
+      return Outcome::Cancelled;
+    }
+    Counters &counters = counters_[branch.worker];
+    saturate(ctx, build, counters);
+
+    for (const Entry &e : ctx) {
+      if (store_.op(e.f) == Opcode::False) {
+        if (build) {
+          *out = proof_.principle_of_explosion(e.step, goal);
+        }
+        return Outcome::Proved;
+      }
+      if (e.f == goal) {
+        if (build) {
+          *out = e.step;
+        }
+        return Outcome::Proved;
+      }
+    }
+
+    // 可逆的右规则
+    switch (store_.op(goal)) {
+    case Opcode::True:
+      if (build) {
+        *out = proof_.true_intro();
+      }
+      return Outcome::Proved;
+    case Opcode::And:
+    case Opcode::Equiv: {
+      // A ↔ B 当作 (A → B) ∧ (B → A)
+      const bool equiv = store_.op(goal) == Opcode::Equiv;
+      NodeId a = equiv ? closure_[goal].first : store_.lhs(goal);
+      NodeId b = equiv ? closure_[goal].second : store_.rhs(goal);
+      Step pa = kNoStep;
+      Step pb = kNoStep;
+      Outcome outcome = both(
+          branch, build,
+          [&](const Branch &br) { return solve(ctx, a, build ? &pa : nullptr, br); },
+          [&](const Branch &br) { return solve(ctx, b, build ? &pb : nullptr, br); });
+      if (build && outcome == Outcome::Proved) {
+        *out = equiv ? proof_.equiv_intro(pa, pb) : proof_.and_intro(pa, pb);
+      }
+      return outcome;
+    }
+    case Opcode::Implies:
+    case Opcode::Not: {
+      NodeId a = store_.lhs(goal);
+      Step hyp = build ? proof_.hypothesis(a) : kNoStep;
+      Step body = kNoStep;
+      Outcome outcome = solve(with(std::move(ctx), {a, hyp}), consequent(goal),
+                              build ? &body : nullptr, branch);
+      if (build && outcome == Outcome::Proved) {
+        *out = intro(goal, hyp, body);
+      }
+      return outcome;
+    }
+    default:
+      break;
+    }
+
+    // 可逆的左 ∨: or_elim
+    for (std::size_t i = 0; i < ctx.size(); ++i) {
+      if (store_.op(ctx[i].f) != Opcode::Or) {
+        continue;
+      }
+      Context rest = without(ctx, i);
+      NodeId a = store_.lhs(ctx[i].f);
+      NodeId b = store_.rhs(ctx[i].f);
+      Step ha = build ? proof_.hypothesis(a) : kNoStep;
+      Step hb = build ? proof_.hypothesis(b) : kNoStep;
+      Step pa = kNoStep;
+      Step pb = kNoStep;
+      Outcome outcome = both(
+          branch, build,
+          [&](const Branch &br) {
+            return solve(with(rest, {a, ha}), goal, build ? &pa : nullptr, br);
+          },
+          [&](const Branch &br) {
+            return solve(with(rest, {b, hb}), goal, build ? &pb : nullptr, br);
+          });
+      if (build && outcome == Outcome::Proved) {
+        *out = proof_.or_elim(ctx[i].step, proof_.implies_intro(ha, pa),
+                              proof_.implies_intro(hb, pb));
+      }
+      return outcome;
+    }
+
+    // 不可逆的选择: 查备忘表, 没有记录时尝试所有可用的选择。备忘表中的左规则
+    // 以公式记录 (2 + 公式编号), 命中上下文更大的相继式时按公式找回它的位置。
+    std::vector<NodeId> key;
+    key.reserve(ctx.size() + 1);
+    for (const Entry &e : ctx) {
+      key.push_back(e.f);
+    }
+    key.push_back(goal);
+    if (closure_.has_countermodel(key)) {
+      ++counters.countermodels;
+      return Outcome::Failed;
+    }
+    int choice = kUnprovable;
+    std::int64_t memo = detail::SequentMemo::kFailed;
+    if (memo_.find(key, memo)) {
+      ++counters.memo_hits;
+      if (memo >= 2) {
+        auto it = std::lower_bound(key.begin(), key.end() - 1, static_cast<NodeId>(memo - 2));
+        choice = static_cast<int>(it - key.begin()) + 2;
+      } else {
+        choice = static_cast<int>(memo);
+      }
+    } else {
+      std::vector<int> choices;
+      if (store_.op(goal) == Opcode::Or) {
+        choices = {0, 1};
+      }
+      for (std::size_t i = 0; i < ctx.size(); ++i) {
+        if (is_implication(ctx[i].f) && is_implication(store_.lhs(ctx[i].f))) {
+          choices.push_back(static_cast<int>(i) + 2);
+        }
+      }
+      Outcome outcome = any(ctx, goal, choices, branch, choice);
+      if (outcome == Outcome::Cancelled) {
+        return outcome;
+      }
+      if (outcome == Outcome::Failed) {
+        choice = kUnprovable;
+      }
+      memo = choice < 2 ? choice : std::int64_t{2} + ctx[choice - 2].f;
+      memo_.insert(key, memo);
+    }
+    if (choice == kUnprovable) {
+      return Outcome::Failed;
+    }
+    return build ? lemma(ctx, goal, std::move(key), choice, out, branch) : Outcome::Proved;
+  }
+
+  // 饱和相继式 f1, ..., fk ⇒ goal 的证明只构造一次, 作为闭合的引理
+  // f1 → (f2 → ... → (fk → goal)), 之后每次出现都用 modus_ponens 代入上下文的
+  // 证明步骤。否则同一相继式每次出现都要重新构造, 证明会随出现次数指数增长。
+  Outcome lemma(const Context &ctx, NodeId goal, std::vector<NodeId> key, int choice,
+                Step *out, const Branch &branch) {
+    auto it = lemmas_.find(key);
+    Step s;
+    if (it != lemmas_.end()) {
+      s = it->second;
+    } else {
+      Context hyps;
+      hyps.reserve(ctx.size());
+      for (const Entry &e : ctx) {
+        hyps.push_back({e.f, proof_.hypothesis(e.f)});
+      }
+      Outcome outcome = apply(hyps, goal, choice, &s, branch);
+      if (outcome != Outcome::Proved) {
+        return outcome;
+      }
+      for (std::size_t i = hyps.size(); i-- > 0;) {
+        s = proof_.implies_intro(hyps[i].step, s);
+      }
+      lemmas_.emplace(std::move(key), s);
+    }
+    for (const Entry &e : ctx) {
+      s = proof_.modus_ponens(e.step, s);
+    }
+    *out = s;
+    return Outcome::Proved;
+  }
+
+  // 选择 0 / 1: 右 ∨ 的左 / 右分支; 选择 2 + i: 对 ctx[i] = (C → D) → B 用左规则
+  //   ctx', D → B ⇒ C → D      ctx', B ⇒ goal
+  Outcome apply(const Context &ctx, NodeId goal, int choice, Step *out,
+                const Branch &branch) {
+    const bool build = out != nullptr;
+    if (choice < 2) {
+      NodeId a = store_.lhs(goal);
+      NodeId b = store_.rhs(goal);
+      Step p = kNoStep;
+      Outcome outcome = solve(ctx, choice == 0 ? a : b, build ? &p : nullptr, branch);
+      if (build && outcome == Outcome::Proved) {
+        *out = choice == 0 ? proof_.or_intro_left(p, b) : proof_.or_intro_right(a, p);
+      }
+      return outcome;
+    }
+
+    const std::size_t index = static_cast<std::size_t>(choice - 2);
+    const Entry &f = ctx[index];
+    NodeId a = store_.lhs(f.f); // C → D 或 ¬C
+    NodeId b = consequent(f.f);
+    Context rest = without(ctx, index);
+
+    if (!build) {
+      return both(
+          branch, false,
+          [&](const Branch &br) {
+            return solve(with(rest, {closure_[f.f].first, kNoStep}), a, nullptr, br);
+          },
+          [&](const Branch &br) { return solve(with(rest, {b, kNoStep}), goal, nullptr, br); });
+    }
+
+    // D → B 由 f 得到: λd. f (λc. d)
+    Step hd = proof_.hypothesis(consequent(a));
+    Step hc = proof_.hypothesis(store_.lhs(a));
+    Step d_to_b = proof_.implies_intro(hd, proof_.modus_ponens(intro(a, hc, hd), f.step));
+    Step p1 = kNoStep;
+    Outcome outcome = solve(with(rest, {closure_[f.f].first, d_to_b}), a, &p1, branch);
+    if (outcome != Outcome::Proved) {
+      return outcome;
+    }
+    return solve(with(std::move(rest), {b, proof_.modus_ponens(p1, f.step)}), goal, out,
+                 branch);
+  }
+
+  CertificateBuilder &proof_;
+  FormulaStore &store_;
+  ProofSearchOptions options_;
+  detail::SearchClosure closure_;
+  detail::SequentMemo memo_;
+  std::unordered_map<std::vector<NodeId>, Step, detail::SequentHash> lemmas_;
+  detail::TaskPool *pool_ = nullptr;
+  std::vector<Counters> counters_;
+  std::size_t steals_ = 0;
+};
+
+struct ProofSearchResult {
+  bool provable;
+  std::string certificate; // 可证时为证明证书 (proof_certificate.h 格式)
+  ProofSearch::Stats stats;
+};
+
+// 判定 formula 在直觉主义命题逻辑中是否可证, 可证时给出证书
+inline ProofSearchResult prove_intuitionistic(const Formula &formula,
+                                              const ProofSearchOptions &options = {}) {
+  CertificateBuilder builder;
+  NodeId goal = builder.formulas().intern(formula);
+  ProofSearch search(builder, options);
+  CertificateBuilder::Step root;
+  if (!search.prove(goal, root)) {
+    return {false, {}, search.stats()};
+  }
+  return {true, builder.serialize(root), search.stats()};
+}
+
+} // namespace cpp_prop::runtime
+
+#endif // PROOF_SEARCH_H
@@ -0,0 +1,135 @@
+#include "batch_check.h"
+
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
+// prop_check: 批量检查公式文件中的每个公式是否为重言式。
+//
+//   prop_check [--threads N] [--batch N] [--cache CACHE] FILE
+//       检查 FILE (文本或二进制格式, 按文件头自动识别), 每个公式一行结果写到标准输出,
+//       汇总写到标准错误。全部有效时退出码为 0, 有无效公式为 1, 有错误为 2。
+//       给出 --cache 时先加载 CACHE 中已知的结果, 结束后把新结果写回。
+//   prop_check --convert IN OUT
+//       把文本格式的 IN 转换为二进制格式的 OUT。
+//   prop_check --list-kernels
+//       列出内置的编译内核; 文本输入中 "@名字" 一行检查同名内核。
+
+using namespace cpp_prop::runtime;
+
+namespace {
+
+// 内置内核: 常用的定理在编译期化简为直线代码
+constexpr char kPeirce[] = "((p -> q) -> p) -> p";
+constexpr char kContraposition[] = "(p -> q) <-> (~q -> ~p)";
+constexpr char kDeMorgan[] = "~(p & q) <-> (~p | ~q)";
+constexpr char kExportation[] = "((p & q) -> r) <-> (p -> (q -> r))";
+
+CPP_PROP_REGISTER_KERNEL(syllogism, type_kernel<cpp_prop::Syllogism, 3>);
+CPP_PROP_REGISTER_KERNEL(peirce, text_kernel<kPeirce>);
+CPP_PROP_REGISTER_KERNEL(contraposition, text_kernel<kContraposition>);
+CPP_PROP_REGISTER_KERNEL(de_morgan, text_kernel<kDeMorgan>);
+CPP_PROP_REGISTER_KERNEL(exportation, text_kernel<kExportation>);
+
+int usage() {
+  std::cerr << "usage: prop_check [--threads N] [--batch N] [--cache CACHE] FILE\n"
+               "       prop_check --convert TEXT_IN BINARY_OUT\n"
+               "       prop_check --list-kernels\n";
+  return 2;
+}
+
+int list_kernels() {
+  for (const FormulaKernel *kernel : KernelRegistry::global().list()) {
+    std::cout << kernel->name << "\t" << kernel->num_vars << " vars\t" << kernel->nodes
+              << " nodes\n";
+  }
+  return 0;
+}
+
+int convert(const std::string &in, const std::string &out) {
+  MappedFile file(in);
+  std::string_view input = file.bytes();
+  std::string bytes;
+  append_binary_header(bytes);
+  TextFormulaParser parser;
+  Formula formula = Formula::constant(true);
+  bool parsed = for_each_text_line(input, [&](std::size_t line_number, std::string_view line) {
+    if (!parser.parse(line, formula)) {
+      std::cerr << in << ":" << line_number << ": " << parser.error() << "\n";
+      return false;
+    }
+    append_binary_formula(bytes, formula);
+    return true;
+  });
+  if (!parsed) {
+    return 2;
+  }
+  std::ofstream stream(out, std::ios::binary);
+  stream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+  if (!stream) {
+    std::cerr << "cannot write " << out << "\n";
+    return 2;
+  }
+  return 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::ios::sync_with_stdio(false);
+  BatchOptions options;
+  std::string path;
+  std::string cache_path;
+  try {
+    for (int i = 1; i < argc; ++i) {
+      std::string arg = argv[i];
+      if (arg == "--list-kernels") {
+        return list_kernels();
+      } else if (arg == "--convert" && i + 2 < argc) {
+        return convert(argv[i + 1], argv[i + 2]);
+      } else if (arg == "--threads" && i + 1 < argc) {
+        options.threads = static_cast<unsigned>(std::stoul(argv[++i]));
+      } else if (arg == "--batch" && i + 1 < argc) {
+        options.batch_size = std::stoul(argv[++i]);
+      } else if (arg == "--cache" && i + 1 < argc) {
+        cache_path = argv[++i];
+      } else if (path.empty() && !arg.empty() && arg[0] != '-') {
+        path = arg;
+      } else {
+        return usage();
+      }
+    }
+    if (path.empty()) {
+      return usage();
+    }
+
+    MappedFile file(path);
+    InputFormat format = is_binary_formula_file(file.bytes())
+                             ? InputFormat::Binary
+                             : InputFormat::Text;
+    std::unique_ptr<TheoremCache> cache;
+    if (!cache_path.empty()) {
+      cache = std::make_unique<TheoremCache>();
+      cache->load(cache_path);
+      options.cache = cache.get();
+    }
+    BatchSummary summary = run_batch_check(file.bytes(), format, std::cout, options);
+    if (cache) {
+      cache->save(cache_path);
+      std::cerr << cache->stats().hits << " cache hits, " << cache->size()
+                << " cached theorems\n";
+    }
+    std::cerr << summary.formulas << " formulas: " << summary.valid << " valid, "
+              << summary.invalid << " invalid, " << summary.errors << " errors\n";
+    if (summary.errors != 0) {
+      return 2;
+    }
+    return summary.invalid != 0 ? 1 : 0;
+  } catch (const std::exception &e) {
+    std::cerr << "prop_check: " << e.what() << "\n";
+    return 2;
+  }
+}
@@ -1,5 +1,7 @@
 #include "constructive_logic.h"
+#include "static_logic.h"
 #include <iostream>
+#include <stdexcept>
 
 // --- Example Proofs using the library ---
 
@@ -11,8 +13,8 @@ Implies<True, True> always_true = [](True) -> True {
 
 // Example: A proof for "¬False" (False → False)
 Implies<False, False> prove_not_false = [](False f) -> False {
-  // 实际上永远不会执行，因为False类型没有实例
-  throw std::logic_error("This function should never be called.");
+  // 实际上永远不会执行，因为False类型没有实例; 恒等函数就是证明
+  return f;
 };
 
 // 下面的对证明的调用不是必须的，只要通过编译就说明证明已经通过了类型检查.
@@ -101,12 +103,16 @@ int main() {
 
   // 验证德摩根定律2: (¬True ∧ ¬False) → ¬(True ∨ False)
   auto dm2 = de_morgan_2<True, False>();
+#ifdef CPP_PROP_NO_EXCEPTIONS
+  // 无异常模式下 False 没有值, 写不出 ¬True 的闭包体; 用空的 std::function
+  // 作为类型正确的假设, 它只被传递而不会被调用
+  Not<True> not_true;
+#else
   Not<True> not_true = [](True) -> False {
     throw std::logic_error("Should not be called");
   };
-  Not<False> not_false = [](False) -> False {
-    throw std::logic_error("Should not be called");
-  };
+#endif
+  Not<False> not_false = prove_not_false;
   And<Not<True>, Not<False>> premise_dm2 = {not_true, not_false};
   Not<Or<True, False>> dm2_proof = dm2(premise_dm2);
   static_assert(std::is_same_v<decltype(dm2_proof), Not<Or<True, False>>>,
@@ -114,15 +120,34 @@ int main() {
 
   // 验证归谬律: (True → False) → ((True → ¬False) → ¬True)
   auto raa = reductio_ad_absurdum<True, False>();
+#ifdef CPP_PROP_NO_EXCEPTIONS
+  Implies<True, False> true_implies_false; // 空的假设, 同上
+#else
   Implies<True, False> true_implies_false = [](True) -> False {
-    return False{};
+    throw std::logic_error("Should not be called");
   };
+#endif
   Implies<True, Not<False>> true_implies_not_false =
       [not_false](True) -> Not<False> { return not_false; };
   Not<True> raa_proof = raa(true_implies_false)(true_implies_not_false);
   static_assert(std::is_same_v<decltype(raa_proof), Not<True>>,
                 "归谬律证明失败");
 
+  // --- 编译期求值 (static_logic.h) ---
+  // std::function 不是 constexpr, 上面只能检查结果的类型;
+  // 静态证明项可以由编译器完整求值, 这里检查的是证明得到的值
+  constexpr auto succ = [](int n) { return n + 1; };
+  static_assert(static_proof::modus_ponens(41, succ) == 42, "假言推理求值失败");
+  static_assert(static_proof::syllogism<int, int, int>(succ, succ)(0) == 2,
+                "三段论求值失败");
+  constexpr And<int, True> pair = static_proof::and_intro<int, True>()(7)(True{});
+  static_assert(static_proof::and_elim_left<int, True>()(pair) == 7,
+                "合取消去求值失败");
+  constexpr auto cases = static_proof::or_elim<int, True, int>();
+  static_assert(cases(Or<int, True>{std::in_place_index<1>, True{}})(succ)(
+                    [](True) { return 0; }) == 0,
+                "析取消去求值失败");
+
   std::cout << "所有证明均通过编译！" << std::endl;
   return 0;
 }
\ No newline at end of file
@@ -0,0 +1,258 @@
+#ifndef RUNTIME_FORMULA_H
+#define RUNTIME_FORMULA_H
+
+#include "template.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// --- Runtime Formulas ---
+// 运行时构造的命题公式, 联结词与 template.h 同名 (And, Or, Not, Implies, Equiv)。
+// 公式存储为后缀 (逆波兰) 指令序列: 求值是一次顺序扫描加一个值栈,
+// 不需要指针追踪, 可以直接交给按位并行的真值表引擎 (truth_table.h)。
+
+namespace cpp_prop::runtime {
+
+enum class Opcode : std::uint8_t { Var, True, False, Not, And, Or, Implies, Equiv };
+
+struct Instruction {
+  Opcode op;
+  std::uint32_t var; // 仅 Opcode::Var 使用: 变量编号
+};
+
+class Formula {
+public:
+  // 用 std::uint64_t 表示赋值 (第 i 位是变量 i 的值) 时最多 64 个变量;
+  // eval、真值表和 BDD 引擎受此限制, SAT 引擎 (sat.h) 不受
+  static constexpr unsigned max_vars = 64;
+  static constexpr unsigned max_index = (1u << 30) - 1;
+
+  static Formula var(unsigned index) {
+    if (index > max_index) {
+      throw std::invalid_argument("Formula: variable index out of range");
+    }
+    return Formula({Instruction{Opcode::Var, index}}, index + 1, 1);
+  }
+  static Formula constant(bool value) {
+    return Formula({Instruction{value ? Opcode::True : Opcode::False, 0}}, 0, 1);
+  }
+  // 由后缀指令序列直接构造 (解析器和二进制格式使用); 序列必须恰好留下一个值
+  static Formula from_postfix(std::vector<Instruction> code) {
+    unsigned num_vars = 0;
+    std::size_t depth = 0;
+    std::size_t max_depth = 0;
+    for (const Instruction &ins : code) {
+      switch (ins.op) {
+      case Opcode::Var:
+        if (ins.var > max_index) {
+          throw std::invalid_argument("Formula: variable index out of range");
+        }
+        num_vars = ins.var + 1 > num_vars ? ins.var + 1 : num_vars;
+        ++depth;
+        break;
+      case Opcode::True:
+      case Opcode::False:
+        ++depth;
+        break;
+      case Opcode::Not:
+        if (depth < 1) {
+          throw std::invalid_argument("Formula: malformed postfix code");
+        }
+        break;
+      case Opcode::And:
+      case Opcode::Or:
+      case Opcode::Implies:
+      case Opcode::Equiv:
+        if (depth < 2) {
+          throw std::invalid_argument("Formula: malformed postfix code");
+        }
+        --depth;
+        break;
+      default:
+        throw std::invalid_argument("Formula: unknown opcode");
+      }
+      max_depth = depth > max_depth ? depth : max_depth;
+    }
+    if (depth != 1) {
+      throw std::invalid_argument("Formula: malformed postfix code");
+    }
+    return Formula(std::move(code), num_vars, max_depth);
+  }
+
+  const std::vector<Instruction> &code() const { return code_; }
+  // 出现的最大变量编号 + 1
+  unsigned num_vars() const { return num_vars_; }
+  // 求值所需的栈深度
+  std::size_t stack_depth() const { return stack_depth_; }
+
+  // 单个赋值上的标量求值
+  bool eval(std::uint64_t assignment) const {
+    if (num_vars_ > max_vars) {
+      throw std::invalid_argument("Formula: too many variables for eval");
+    }
+    return eval_with([assignment](std::uint32_t var) {
+      return ((assignment >> var) & 1u) != 0;
+    });
+  }
+  // 变量多于 64 个时, assignment[i] 是变量 i 的值
+  bool eval(const std::vector<bool> &assignment) const {
+    if (num_vars_ > assignment.size()) {
+      throw std::invalid_argument("Formula: assignment is too short");
+    }
+    return eval_with(
+        [&assignment](std::uint32_t var) { return bool(assignment[var]); });
+  }
+
+  // ¬a
+  static Formula negate(Formula a) {
+    a.code_.push_back(Instruction{Opcode::Not, 0});
+    return a;
+  }
+  // a op b, op 为二元联结词
+  static Formula combine(Opcode op, Formula a, Formula b) {
+    // 右操作数求值时左操作数的结果还在栈上
+    std::size_t depth = a.stack_depth_ > b.stack_depth_ + 1
+                            ? a.stack_depth_
+                            : b.stack_depth_ + 1;
+    a.code_.insert(a.code_.end(), b.code_.begin(), b.code_.end());
+    a.code_.push_back(Instruction{op, 0});
+    a.num_vars_ = a.num_vars_ > b.num_vars_ ? a.num_vars_ : b.num_vars_;
+    a.stack_depth_ = depth;
+    return a;
+  }
+
+  static constexpr bool apply(Opcode op, bool a, bool b) {
+    switch (op) {
+    case Opcode::And:
+      return a && b;
+    case Opcode::Or:
+      return a || b;
+    case Opcode::Implies:
+      return !a || b;
+    default:
+      return a == b;
+    }
+  }
+
+private:
+  template <typename Value> bool eval_with(Value value) const {
+    std::vector<bool> stack;
+    stack.reserve(stack_depth_);
+    for (const Instruction &ins : code_) {
+      if (ins.op == Opcode::Var) {
+        stack.push_back(value(ins.var));
+      } else if (ins.op == Opcode::True || ins.op == Opcode::False) {
+        stack.push_back(ins.op == Opcode::True);
+      } else if (ins.op == Opcode::Not) {
+        stack.back() = !stack.back();
+      } else {
+        bool b = stack.back();
+        stack.pop_back();
+        bool a = stack.back();
+        stack.back() = apply(ins.op, a, b);
+      }
+    }
+    return stack.back();
+  }
+
+  Formula(std::vector<Instruction> code, unsigned num_vars,
+          std::size_t stack_depth)
+      : code_(std::move(code)), num_vars_(num_vars), stack_depth_(stack_depth) {}
+
+  std::vector<Instruction> code_;
+  unsigned num_vars_;
+  std::size_t stack_depth_;
+};
+
+// 与 template.h 同名的构造函数; 在本命名空间内它们隐藏 cpp_prop 中的同名模板
+inline Formula Not(Formula a) { return Formula::negate(std::move(a)); }
+inline Formula And(Formula a, Formula b) {
+  return Formula::combine(Opcode::And, std::move(a), std::move(b));
+}
+inline Formula Or(Formula a, Formula b) {
+  return Formula::combine(Opcode::Or, std::move(a), std::move(b));
+}
+inline Formula Implies(Formula a, Formula b) {
+  return Formula::combine(Opcode::Implies, std::move(a), std::move(b));
+}
+inline Formula Equiv(Formula a, Formula b) {
+  return Formula::combine(Opcode::Equiv, std::move(a), std::move(b));
+}
+
+// 各个检查引擎共用的结果
+struct TautologyResult {
+  bool tautology;
+  std::uint64_t counterexample; // 使公式为假的赋值; 重言式时为 0
+};
+
+// --- 从 template.h 降级 (Lowering) ---
+// lower<F>() 把由 Var<i>, TrueType/FalseType 和 template.h 联结词组成的公式类型
+// 转换为运行时公式。匹配按基类进行, 所以继承自某个联结词的用户公式
+// (例如 struct F : Implies<A, B> {}) 也可以降级。
+
+namespace detail {
+
+inline Formula lower_node(const TrueType *) { return Formula::constant(true); }
+inline Formula lower_node(const FalseType *) { return Formula::constant(false); }
+template <std::size_t I> Formula lower_node(const Var<I> *) {
+  return Formula::var(I);
+}
+
+template <typename A> Formula lower_node(const cpp_prop::Not<A> *);
+template <typename A, typename B>
+Formula lower_node(const cpp_prop::And<A, B> *);
+template <typename A, typename B> Formula lower_node(const cpp_prop::Or<A, B> *);
+template <typename A, typename B>
+Formula lower_node(const cpp_prop::Implies<A, B> *);
+template <typename A, typename B>
+Formula lower_node(const cpp_prop::Equiv<A, B> *);
+template <typename A, typename B, typename C>
+Formula lower_node(const cpp_prop::Syllogism<A, B, C> *);
+
+template <typename F> Formula lower_type() {
+  return lower_node(static_cast<const F *>(nullptr));
+}
+
+template <typename A> Formula lower_node(const cpp_prop::Not<A> *) {
+  return Not(lower_type<A>());
+}
+template <typename A, typename B>
+Formula lower_node(const cpp_prop::And<A, B> *) {
+  return And(lower_type<A>(), lower_type<B>());
+}
+template <typename A, typename B> Formula lower_node(const cpp_prop::Or<A, B> *) {
+  return Or(lower_type<A>(), lower_type<B>());
+}
+template <typename A, typename B>
+Formula lower_node(const cpp_prop::Implies<A, B> *) {
+  return Implies(lower_type<A>(), lower_type<B>());
+}
+template <typename A, typename B>
+Formula lower_node(const cpp_prop::Equiv<A, B> *) {
+  return Equiv(lower_type<A>(), lower_type<B>());
+}
+template <typename A, typename B, typename C>
+Formula lower_node(const cpp_prop::Syllogism<A, B, C> *) {
+  using Body = cpp_prop::Implies<
+      cpp_prop::And<cpp_prop::Implies<A, B>, cpp_prop::Implies<B, C>>,
+      cpp_prop::Implies<A, C>>;
+  return lower_type<Body>();
+}
+
+} // namespace detail
+
+template <typename F> Formula lower() { return detail::lower_type<F>(); }
+
+// N 元公式模板, 以 Var<0>, ..., Var<N-1> 实例化后降级, 例如 lower<Syllogism, 3>();
+// 公式内部读取了 ::type 时 (见 template.h 的 detail::Symbolic) 降级等价的决策树
+template <template <typename...> class F, std::size_t NVars> Formula lower() {
+  return lower<typename cpp_prop::detail::Symbolic<
+      F, std::make_index_sequence<NVars>>::type>();
+}
+
+} // namespace cpp_prop::runtime
+
+#endif // RUNTIME_FORMULA_H
@@ -0,0 +1,632 @@
+#ifndef SAT_H
+#define SAT_H
+
+#include "runtime_formula.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// --- CDCL SAT Solver ---
+// 公式 F 是重言式, 当且仅当 ¬F 不可满足。check_validity() 把 ¬F 经 Tseitin
+// 变换编码为 CNF, 交给一个 CDCL 求解器:
+//   - 双观察文字 (two watched literals) 单元传播, 每个观察项带一个 blocker 文字
+//   - 第一唯一蕴含点 (1UIP) 冲突分析与学习子句最小化
+//   - VSIDS 变量活跃度 (二叉堆) 与相位保存
+//   - Luby 序列重启; 重启时按活跃度淘汰一半学习子句
+// 可满足时, 模型在原变量上的投影就是使 F 为假的反例。变量数不受 64 位赋值的
+// 限制, 反例用 std::vector<bool> 表示。
+
+namespace cpp_prop::runtime {
+
+class SatSolver {
+public:
+  // 文字: 2 * 变量 + (取反 ? 1 : 0)
+  using Lit = std::uint32_t;
+  static constexpr Lit positive(std::uint32_t var) { return var * 2; }
+  static constexpr Lit negative(std::uint32_t var) { return var * 2 + 1; }
+  static constexpr Lit negate(Lit lit) { return lit ^ 1u; }
+  static constexpr std::uint32_t var_of(Lit lit) { return lit >> 1; }
+
+  struct Stats {
+    std::size_t decisions = 0;
+    std::size_t propagations = 0;
+    std::size_t conflicts = 0;
+    std::size_t learnt_clauses = 0;   // 学到的子句总数 (含单元子句)
+    std::size_t deleted_clauses = 0;  // 被淘汰的学习子句
+    std::size_t restarts = 0;
+  };
+
+  std::uint32_t new_var() {
+    std::uint32_t var = num_vars();
+    assigns_.push_back(kUndef);
+    level_.push_back(0);
+    reason_.push_back(kNoReason);
+    activity_.push_back(0.0);
+    phase_.push_back(false);
+    seen_.push_back(false);
+    heap_index_.push_back(kNotInHeap);
+    watches_.emplace_back();
+    watches_.emplace_back();
+    heap_insert(var);
+    return var;
+  }
+
+  std::uint32_t num_vars() const {
+    return static_cast<std::uint32_t>(assigns_.size());
+  }
+  const Stats &stats() const { return stats_; }
+
+  // 只能在两次 solve() 之间调用。返回 false 表示子句集已经不可满足。
+  bool add_clause(std::vector<Lit> lits) {
+    if (!ok_) {
+      return false;
+    }
+    std::sort(lits.begin(), lits.end());
+    std::size_t j = 0;
+    for (std::size_t i = 0; i < lits.size(); ++i) {
+      Lit lit = lits[i];
+      if (var_of(lit) >= num_vars()) {
+        throw std::invalid_argument("SatSolver: literal of unknown variable");
+      }
+      if (value(lit) == kTrue || (j > 0 && lits[j - 1] == negate(lit))) {
+        return true; // 已满足或含互补文字
+      }
+      if (value(lit) != kFalse && (j == 0 || lits[j - 1] != lit)) {
+        lits[j++] = lit;
+      }
+    }
+    lits.resize(j);
+    if (lits.empty()) {
+      return ok_ = false;
+    }
+    if (lits.size() == 1) {
+      enqueue(lits[0], kNoReason);
+      return ok_ = propagate() == kNoReason;
+    }
+    attach(store(lits, false));
+    return true;
+  }
+
+  // 可满足时返回 true, 之后可以用 model_value() 读取模型
+  bool solve() {
+    if (!ok_) {
+      return false;
+    }
+    std::size_t restart_index = 0;
+    std::size_t conflicts_until_restart = luby(restart_index) * kRestartUnit;
+    std::size_t max_learnts = clauses_.size() / 3 + 1000;
+    std::vector<Lit> learnt;
+    while (true) {
+      std::uint32_t conflict = propagate();
+      if (conflict != kNoReason) {
+        ++stats_.conflicts;
+        if (decision_level() == 0) {
+          return ok_ = false;
+        }
+        std::uint32_t backjump = analyze(conflict, learnt);
+        cancel_until(backjump);
+        ++stats_.learnt_clauses;
+        if (learnt.size() == 1) {
+          enqueue(learnt[0], kNoReason);
+        } else {
+          std::uint32_t cref = store(learnt, true);
+          attach(cref);
+          bump_clause(cref);
+          enqueue(learnt[0], cref);
+        }
+        var_inc_ /= kVarDecay;
+        clause_inc_ /= kClauseDecay;
+        if (conflicts_until_restart > 0) {
+          --conflicts_until_restart;
+        }
+        continue;
+      }
+      if (conflicts_until_restart == 0) {
+        ++stats_.restarts;
+        cancel_until(0);
+        if (num_learnts_ >= max_learnts) {
+          reduce_learnts();
+          max_learnts += max_learnts / 10;
+        }
+        conflicts_until_restart = luby(++restart_index) * kRestartUnit;
+        continue;
+      }
+      std::uint32_t next = pick_branch_var();
+      if (next == kNoVar) {
+        model_.assign(assigns_.begin(), assigns_.end());
+        cancel_until(0);
+        return true;
+      }
+      ++stats_.decisions;
+      trail_lim_.push_back(trail_.size());
+      enqueue(phase_[next] ? positive(next) : negative(next), kNoReason);
+    }
+  }
+
+  // 最近一次 solve() 成功时变量的值
+  bool model_value(std::uint32_t var) const { return model_[var] == kTrue; }
+
+private:
+  static constexpr std::uint8_t kFalse = 0;
+  static constexpr std::uint8_t kTrue = 1;
+  static constexpr std::uint8_t kUndef = 2;
+  static constexpr std::uint32_t kNoReason = ~std::uint32_t{0};
+  static constexpr std::uint32_t kNoVar = ~std::uint32_t{0};
+  static constexpr std::uint32_t kNotInHeap = ~std::uint32_t{0};
+  static constexpr double kVarDecay = 0.95;
+  static constexpr double kClauseDecay = 0.999;
+  static constexpr std::size_t kRestartUnit = 100;
+
+  struct Clause {
+    std::uint32_t start; // 在 lits_ 中的偏移
+    std::uint32_t size;
+    bool learnt;
+    double activity;
+  };
+
+  struct Watcher {
+    std::uint32_t cref;
+    Lit blocker; // 为真时不必访问子句
+  };
+
+  std::uint8_t value(Lit lit) const {
+    std::uint8_t v = assigns_[var_of(lit)];
+    return v == kUndef ? kUndef : static_cast<std::uint8_t>(v ^ (lit & 1u));
+  }
+
+  std::uint32_t decision_level() const {
+    return static_cast<std::uint32_t>(trail_lim_.size());
+  }
+
+  void enqueue(Lit lit, std::uint32_t reason) {
+    std::uint32_t var = var_of(lit);
+    assigns_[var] = static_cast<std::uint8_t>((lit & 1u) ? kFalse : kTrue);
+    level_[var] = decision_level();
+    reason_[var] = reason;
+    trail_.push_back(lit);
+  }
+
+  std::uint32_t store(const std::vector<Lit> &lits, bool learnt) {
+    std::uint32_t cref = static_cast<std::uint32_t>(clauses_.size());
+    clauses_.push_back(Clause{static_cast<std::uint32_t>(lits_.size()),
+                              static_cast<std::uint32_t>(lits.size()), learnt,
+                              0.0});
+    lits_.insert(lits_.end(), lits.begin(), lits.end());
+    if (learnt) {
+      ++num_learnts_;
+    }
+    return cref;
+  }
+
+  // 观察前两个文字
+  void attach(std::uint32_t cref) {
+    const Lit *lits = &lits_[clauses_[cref].start];
+    watches_[lits[0]].push_back(Watcher{cref, lits[1]});
+    watches_[lits[1]].push_back(Watcher{cref, lits[0]});
+  }
+
+  // --- 单元传播 ---
+  // 返回冲突子句, 没有冲突时返回 kNoReason
+  std::uint32_t propagate() {
+    while (qhead_ < trail_.size()) {
+      Lit false_lit = negate(trail_[qhead_++]);
+      std::vector<Watcher> &ws = watches_[false_lit];
+      std::size_t i = 0;
+      std::size_t j = 0;
+      while (i < ws.size()) {
+        Watcher w = ws[i++];
+        if (value(w.blocker) == kTrue) {
+          ws[j++] = w;
+          continue;
+        }
+        ++stats_.propagations;
+        const Clause &clause = clauses_[w.cref];
+        Lit *lits = &lits_[clause.start];
+        if (lits[0] == false_lit) {
+          std::swap(lits[0], lits[1]);
+        }
+        Lit first = lits[0];
+        if (first != w.blocker && value(first) == kTrue) {
+          ws[j++] = Watcher{w.cref, first};
+          continue;
+        }
+        bool moved = false;
+        for (std::uint32_t k = 2; k < clause.size; ++k) {
+          if (value(lits[k]) != kFalse) {
+            std::swap(lits[1], lits[k]);
+            watches_[lits[1]].push_back(Watcher{w.cref, first});
+            moved = true;
+            break;
+          }
+        }
+        if (moved) {
+          continue;
+        }
+        ws[j++] = Watcher{w.cref, first};
+        if (value(first) == kFalse) {
+          while (i < ws.size()) {
+            ws[j++] = ws[i++];
+          }
+          ws.resize(j);
+          qhead_ = trail_.size();
+          return w.cref;
+        }
+        enqueue(first, w.cref);
+      }
+      ws.resize(j);
+    }
+    return kNoReason;
+  }
+
+  // --- 冲突分析 (1UIP) ---
+  // learnt[0] 是断言文字, learnt[1] 是回跳层上的文字; 返回回跳层
+  std::uint32_t analyze(std::uint32_t conflict, std::vector<Lit> &learnt) {
+    learnt.assign(1, 0);
+    std::size_t path_count = 0;
+    Lit p = 0;
+    bool have_p = false;
+    std::size_t index = trail_.size();
+    do {
+      const Clause &clause = clauses_[conflict];
+      if (clause.learnt) {
+        bump_clause(conflict);
+      }
+      const Lit *lits = &lits_[clause.start];
+      // 推理子句的第一个文字就是被蕴含的 p
+      for (std::uint32_t k = have_p ? 1 : 0; k < clause.size; ++k) {
+        std::uint32_t var = var_of(lits[k]);
+        if (!seen_[var] && level_[var] > 0) {
+          bump_var(var);
+          seen_[var] = true;
+          if (level_[var] >= decision_level()) {
+            ++path_count;
+          } else {
+            learnt.push_back(lits[k]);
+          }
+        }
+      }
+      while (!seen_[var_of(trail_[--index])]) {
+      }
+      p = trail_[index];
+      have_p = true;
+      conflict = reason_[var_of(p)];
+      seen_[var_of(p)] = false;
+      --path_count;
+    } while (path_count > 0);
+    learnt[0] = negate(p);
+
+    // 最小化: 推理子句的其余文字都已在学习子句中 (或在第 0 层) 的文字是多余的
+    analyze_clear_.assign(learnt.begin(), learnt.end());
+    std::size_t j = 1;
+    for (std::size_t i = 1; i < learnt.size(); ++i) {
+      std::uint32_t reason = reason_[var_of(learnt[i])];
+      if (reason == kNoReason || !redundant(reason)) {
+        learnt[j++] = learnt[i];
+      }
+    }
+    learnt.resize(j);
+    for (Lit lit : analyze_clear_) {
+      seen_[var_of(lit)] = false;
+    }
+
+    if (learnt.size() == 1) {
+      return 0;
+    }
+    std::size_t max_index = 1;
+    for (std::size_t i = 2; i < learnt.size(); ++i) {
+      if (level_[var_of(learnt[i])] > level_[var_of(learnt[max_index])]) {
+        max_index = i;
+      }
+    }
+    std::swap(learnt[1], learnt[max_index]);
+    return level_[var_of(learnt[1])];
+  }
+
+  bool redundant(std::uint32_t reason) const {
+    const Clause &clause = clauses_[reason];
+    const Lit *lits = &lits_[clause.start];
+    for (std::uint32_t k = 1; k < clause.size; ++k) {
+      std::uint32_t var = var_of(lits[k]);
+      if (!seen_[var] && level_[var] > 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void cancel_until(std::uint32_t level) {
+    if (decision_level() <= level) {
+      return;
+    }
+    for (std::size_t i = trail_.size(); i-- > trail_lim_[level];) {
+      std::uint32_t var = var_of(trail_[i]);
+      phase_[var] = assigns_[var] == kTrue;
+      assigns_[var] = kUndef;
+      reason_[var] = kNoReason;
+      if (heap_index_[var] == kNotInHeap) {
+        heap_insert(var);
+      }
+    }
+    trail_.resize(trail_lim_[level]);
+    trail_lim_.resize(level);
+    qhead_ = trail_.size();
+  }
+
+  // --- 学习子句淘汰 ---
+  // 只在第 0 层调用, 此时没有子句作为推理原因, 可以直接压缩子句存储
+  void reduce_learnts() {
+    std::vector<std::uint32_t> learnts;
+    for (std::uint32_t cref = 0; cref < clauses_.size(); ++cref) {
+      if (clauses_[cref].learnt && clauses_[cref].size > 2) {
+        learnts.push_back(cref);
+      }
+    }
+    std::sort(learnts.begin(), learnts.end(),
+              [this](std::uint32_t a, std::uint32_t b) {
+                return clauses_[a].activity < clauses_[b].activity;
+              });
+    std::vector<bool> removed(clauses_.size(), false);
+    for (std::size_t i = 0; i < learnts.size() / 2; ++i) {
+      removed[learnts[i]] = true;
+    }
+    std::vector<Clause> clauses;
+    std::vector<Lit> lits;
+    for (std::uint32_t cref = 0; cref < clauses_.size(); ++cref) {
+      const Clause &clause = clauses_[cref];
+      if (removed[cref]) {
+        --num_learnts_;
+        ++stats_.deleted_clauses;
+        continue;
+      }
+      clauses.push_back(Clause{static_cast<std::uint32_t>(lits.size()),
+                               clause.size, clause.learnt, clause.activity});
+      lits.insert(lits.end(), lits_.begin() + clause.start,
+                  lits_.begin() + clause.start + clause.size);
+    }
+    clauses_ = std::move(clauses);
+    lits_ = std::move(lits);
+    for (std::vector<Watcher> &ws : watches_) {
+      ws.clear();
+    }
+    for (std::uint32_t cref = 0; cref < clauses_.size(); ++cref) {
+      attach(cref);
+    }
+    for (Lit lit : trail_) {
+      reason_[var_of(lit)] = kNoReason;
+    }
+  }
+
+  // --- VSIDS ---
+  void bump_var(std::uint32_t var) {
+    if ((activity_[var] += var_inc_) > 1e100) {
+      for (double &a : activity_) {
+        a *= 1e-100;
+      }
+      var_inc_ *= 1e-100;
+    }
+    if (heap_index_[var] != kNotInHeap) {
+      heap_up(heap_index_[var]);
+    }
+  }
+
+  void bump_clause(std::uint32_t cref) {
+    if ((clauses_[cref].activity += clause_inc_) > 1e20) {
+      for (Clause &clause : clauses_) {
+        clause.activity *= 1e-20;
+      }
+      clause_inc_ *= 1e-20;
+    }
+  }
+
+  std::uint32_t pick_branch_var() {
+    while (!heap_.empty()) {
+      std::uint32_t var = heap_pop();
+      if (assigns_[var] == kUndef) {
+        return var;
+      }
+    }
+    return kNoVar;
+  }
+
+  // 按活跃度排序的最大堆
+  void heap_insert(std::uint32_t var) {
+    heap_index_[var] = static_cast<std::uint32_t>(heap_.size());
+    heap_.push_back(var);
+    heap_up(heap_index_[var]);
+  }
+
+  std::uint32_t heap_pop() {
+    std::uint32_t top = heap_[0];
+    heap_index_[top] = kNotInHeap;
+    std::uint32_t last = heap_.back();
+    heap_.pop_back();
+    if (!heap_.empty()) {
+      heap_[0] = last;
+      heap_index_[last] = 0;
+      heap_down(0);
+    }
+    return top;
+  }
+
+  void heap_up(std::uint32_t i) {
+    std::uint32_t var = heap_[i];
+    while (i > 0) {
+      std::uint32_t parent = (i - 1) / 2;
+      if (activity_[heap_[parent]] >= activity_[var]) {
+        break;
+      }
+      heap_[i] = heap_[parent];
+      heap_index_[heap_[i]] = i;
+      i = parent;
+    }
+    heap_[i] = var;
+    heap_index_[var] = i;
+  }
+
+  void heap_down(std::uint32_t i) {
+    std::uint32_t var = heap_[i];
+    std::size_t size = heap_.size();
+    while (2 * std::size_t{i} + 1 < size) {
+      std::uint32_t child = 2 * i + 1;
+      if (child + 1 < size &&
+          activity_[heap_[child + 1]] > activity_[heap_[child]]) {
+        ++child;
+      }
+      if (activity_[heap_[child]] <= activity_[var]) {
+        break;
+      }
+      heap_[i] = heap_[child];
+      heap_index_[heap_[i]] = i;
+      i = child;
+    }
+    heap_[i] = var;
+    heap_index_[var] = i;
+  }
+
+  // Luby 序列 1, 1, 2, 1, 1, 2, 4, 1, ...
+  static std::size_t luby(std::size_t i) {
+    std::size_t size = 1;
+    std::size_t sequence = 0;
+    while (size < i + 1) {
+      ++sequence;
+      size = 2 * size + 1;
+    }
+    while (size - 1 != i) {
+      size = (size - 1) >> 1;
+      --sequence;
+      i %= size;
+    }
+    return std::size_t{1} << sequence;
+  }
+
+  bool ok_ = true;
+  std::vector<std::uint8_t> assigns_;
+  std::vector<std::uint8_t> model_;
+  std::vector<std::uint32_t> level_;
+  std::vector<std::uint32_t> reason_;
+  std::vector<double> activity_;
+  std::vector<bool> phase_;
+  std::vector<bool> seen_;
+  std::vector<Lit> analyze_clear_;
+  std::vector<std::uint32_t> heap_;
+  std::vector<std::uint32_t> heap_index_;
+  std::vector<std::vector<Watcher>> watches_;
+  std::vector<Clause> clauses_;
+  std::vector<Lit> lits_;
+  std::size_t num_learnts_ = 0;
+  std::vector<Lit> trail_;
+  std::vector<std::size_t> trail_lim_;
+  std::size_t qhead_ = 0;
+  double var_inc_ = 1.0;
+  double clause_inc_ = 1.0;
+  Stats stats_;
+};
+
+// --- Tseitin 编码 ---
+// 每个联结词节点引入一个新变量 x 与约束 x ↔ (a op b); 否定不引入变量。
+// 原公式的变量 i 就是求解器的变量 i。返回代表整个公式的文字。
+inline SatSolver::Lit tseitin_encode(const Formula &formula,
+                                     SatSolver &solver) {
+  using Lit = SatSolver::Lit;
+  while (solver.num_vars() < formula.num_vars()) {
+    solver.new_var();
+  }
+  std::vector<Lit> stack;
+  stack.reserve(formula.stack_depth());
+  Lit truth = 0;
+  bool have_truth = false;
+  for (const Instruction &ins : formula.code()) {
+    switch (ins.op) {
+    case Opcode::Var:
+      stack.push_back(SatSolver::positive(ins.var));
+      break;
+    case Opcode::True:
+    case Opcode::False:
+      if (!have_truth) {
+        truth = SatSolver::positive(solver.new_var());
+        solver.add_clause({truth});
+        have_truth = true;
+      }
+      stack.push_back(ins.op == Opcode::True ? truth : SatSolver::negate(truth));
+      break;
+    case Opcode::Not:
+      stack.back() = SatSolver::negate(stack.back());
+      break;
+    default: {
+      Lit b = stack.back();
+      stack.pop_back();
+      Lit a = stack.back();
+      Lit x = SatSolver::positive(solver.new_var());
+      Lit nx = SatSolver::negate(x);
+      Lit na = SatSolver::negate(a);
+      Lit nb = SatSolver::negate(b);
+      if (ins.op == Opcode::Implies) {
+        a = na; // a → b = ¬a ∨ b
+        na = SatSolver::negate(a);
+      }
+      if (ins.op == Opcode::And) {
+        solver.add_clause({nx, a});
+        solver.add_clause({nx, b});
+        solver.add_clause({x, na, nb});
+      } else if (ins.op == Opcode::Equiv) {
+        solver.add_clause({nx, na, b});
+        solver.add_clause({nx, a, nb});
+        solver.add_clause({x, a, b});
+        solver.add_clause({x, na, nb});
+      } else { // Or, Implies
+        solver.add_clause({x, na});
+        solver.add_clause({x, nb});
+        solver.add_clause({nx, a, b});
+      }
+      stack.back() = x;
+      break;
+    }
+    }
+  }
+  return stack.back();
+}
+
+struct ValidityResult {
+  bool valid;
+  std::vector<bool> counterexample; // 使公式为假的赋值, 有效时为空
+  SatSolver::Stats stats;
+};
+
+// 通过反驳 ¬F 判定 F 是否有效 (重言式)
+inline ValidityResult check_validity(const Formula &formula) {
+  SatSolver solver;
+  SatSolver::Lit root = tseitin_encode(formula, solver);
+  solver.add_clause({SatSolver::negate(root)});
+  if (!solver.solve()) {
+    return {true, {}, solver.stats()};
+  }
+  std::vector<bool> counterexample(formula.num_vars());
+  for (std::uint32_t var = 0; var < formula.num_vars(); ++var) {
+    counterexample[var] = solver.model_value(var);
+  }
+  return {false, std::move(counterexample), solver.stats()};
+}
+
+// 与真值表、BDD 引擎相同的接口, 限 64 个变量以内
+inline TautologyResult check_tautology_sat(const Formula &formula) {
+  if (formula.num_vars() > Formula::max_vars) {
+    throw std::invalid_argument(
+        "check_tautology_sat: use check_validity for more than 64 variables");
+  }
+  ValidityResult result = check_validity(formula);
+  std::uint64_t assignment = 0;
+  for (std::size_t var = 0; var < result.counterexample.size(); ++var) {
+    if (result.counterexample[var]) {
+      assignment |= std::uint64_t{1} << var;
+    }
+  }
+  return {result.valid, assignment};
+}
+
+} // namespace cpp_prop::runtime
+
+#endif // SAT_H
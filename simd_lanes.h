@@ -0,0 +1,162 @@
+#ifndef SIMD_LANES_H
+#define SIMD_LANES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// --- SIMD Lanes ---
+// 真值表 (truth_table.h) 与列式求值 (columnar.h) 共用的按位向量运算。
+// 每个指令集一个结构体, 静态成员相同:
+//   Lane, words   一个向量, 以及它包含的 64 位字数
+//   load/store    读写 words 个字, 不要求对齐
+//   splat(x)      每个字都是 x
+//   bit_and/bit_or/bit_xor/bit_not, andnot(x, y) = ¬x ∧ y
+// 编译目标支持的指令集都会定义 (例如 AVX-512 目标上 Avx512、Avx2 与 Scalar 都有),
+// 引擎默认使用最宽的 Native; Available 列出全部, 供测试逐个检查。
+
+namespace cpp_prop::runtime::simd {
+
+struct Scalar {
+  using Lane = std::uint64_t;
+  static constexpr std::size_t words = 1;
+  static constexpr const char *name = "scalar";
+
+  static Lane load(const std::uint64_t *p) { return *p; }
+  static void store(std::uint64_t *p, Lane x) { *p = x; }
+  static Lane splat(std::uint64_t x) { return x; }
+  static Lane bit_and(Lane x, Lane y) { return x & y; }
+  static Lane bit_or(Lane x, Lane y) { return x | y; }
+  static Lane bit_xor(Lane x, Lane y) { return x ^ y; }
+  static Lane andnot(Lane x, Lane y) { return ~x & y; }
+  static Lane bit_not(Lane x) { return ~x; }
+};
+
+#if defined(__AVX2__)
+struct Avx2 {
+  using Lane = __m256i;
+  static constexpr std::size_t words = 4;
+  static constexpr const char *name = "avx2";
+
+  static Lane load(const std::uint64_t *p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+  }
+  static void store(std::uint64_t *p, Lane x) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), x);
+  }
+  static Lane splat(std::uint64_t x) {
+    return _mm256_set1_epi64x(static_cast<long long>(x));
+  }
+  static Lane bit_and(Lane x, Lane y) { return _mm256_and_si256(x, y); }
+  static Lane bit_or(Lane x, Lane y) { return _mm256_or_si256(x, y); }
+  static Lane bit_xor(Lane x, Lane y) { return _mm256_xor_si256(x, y); }
+  static Lane andnot(Lane x, Lane y) { return _mm256_andnot_si256(x, y); }
+  static Lane bit_not(Lane x) { return bit_xor(x, splat(~0ull)); }
+};
+#endif
+
+#if defined(__AVX512F__)
+struct Avx512 {
+  using Lane = __m512i;
+  static constexpr std::size_t words = 8;
+  static constexpr const char *name = "avx512";
+
+  static Lane load(const std::uint64_t *p) { return _mm512_loadu_si512(p); }
+  static void store(std::uint64_t *p, Lane x) { _mm512_storeu_si512(p, x); }
+  static Lane splat(std::uint64_t x) {
+    return _mm512_set1_epi64(static_cast<long long>(x));
+  }
+  static Lane bit_and(Lane x, Lane y) { return _mm512_and_si512(x, y); }
+  static Lane bit_or(Lane x, Lane y) { return _mm512_or_si512(x, y); }
+  static Lane bit_xor(Lane x, Lane y) { return _mm512_xor_si512(x, y); }
+  static Lane andnot(Lane x, Lane y) { return _mm512_andnot_si512(x, y); }
+  static Lane bit_not(Lane x) { return bit_xor(x, splat(~0ull)); }
+};
+#endif
+
+#if defined(__ARM_NEON)
+struct Neon {
+  using Lane = uint64x2_t;
+  static constexpr std::size_t words = 2;
+  static constexpr const char *name = "neon";
+
+  static Lane load(const std::uint64_t *p) { return vld1q_u64(p); }
+  static void store(std::uint64_t *p, Lane x) { vst1q_u64(p, x); }
+  static Lane splat(std::uint64_t x) { return vdupq_n_u64(x); }
+  static Lane bit_and(Lane x, Lane y) { return vandq_u64(x, y); }
+  static Lane bit_or(Lane x, Lane y) { return vorrq_u64(x, y); }
+  static Lane bit_xor(Lane x, Lane y) { return veorq_u64(x, y); }
+  // bic(x, y) = x & ~y, 参数顺序与 x86 的 andnot 相反
+  static Lane andnot(Lane x, Lane y) { return vbicq_u64(y, x); }
+  static Lane bit_not(Lane x) { return bit_xor(x, splat(~0ull)); }
+};
+#endif
+
+#if defined(__AVX512F__)
+using Native = Avx512;
+#elif defined(__AVX2__)
+using Native = Avx2;
+#elif defined(__ARM_NEON)
+using Native = Neon;
+#else
+using Native = Scalar;
+#endif
+
+using Available = std::tuple<Scalar
+#if defined(__AVX2__)
+                             ,
+                             Avx2
+#endif
+#if defined(__AVX512F__)
+                             ,
+                             Avx512
+#endif
+#if defined(__ARM_NEON)
+                             ,
+                             Neon
+#endif
+                             >;
+
+// --- 联结词 ---
+// lane<L>(a, b) 作用于 L 的一个向量, word(a, b) 作用于单个字
+
+struct AndOp {
+  template <typename L>
+  static typename L::Lane lane(typename L::Lane a, typename L::Lane b) {
+    return L::bit_and(a, b);
+  }
+  static std::uint64_t word(std::uint64_t a, std::uint64_t b) { return a & b; }
+};
+struct OrOp {
+  template <typename L>
+  static typename L::Lane lane(typename L::Lane a, typename L::Lane b) {
+    return L::bit_or(a, b);
+  }
+  static std::uint64_t word(std::uint64_t a, std::uint64_t b) { return a | b; }
+};
+// a → b = ¬(a ∧ ¬b)
+struct ImpliesOp {
+  template <typename L>
+  static typename L::Lane lane(typename L::Lane a, typename L::Lane b) {
+    return L::bit_not(L::andnot(b, a));
+  }
+  static std::uint64_t word(std::uint64_t a, std::uint64_t b) { return ~a | b; }
+};
+// a ↔ b = ¬(a ⊕ b)
+struct EquivOp {
+  template <typename L>
+  static typename L::Lane lane(typename L::Lane a, typename L::Lane b) {
+    return L::bit_not(L::bit_xor(a, b));
+  }
+  static std::uint64_t word(std::uint64_t a, std::uint64_t b) { return ~(a ^ b); }
+};
+
+} // namespace cpp_prop::runtime::simd
+
+#endif // SIMD_LANES_H
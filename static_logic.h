@@ -0,0 +1,323 @@
+#ifndef STATIC_LOGIC_H
+#define STATIC_LOGIC_H
+
+#include "constructive_logic.h"
+
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+// --- Static Proof Terms ---
+// 静态证明项: 蕴含 A → B 的证明是任意一个具体的可调用类型 F,
+// 只要 F 可以被 A 调用并返回 B。组合子直接返回 lambda,
+// 不经过 std::function 的类型擦除, 编译器可以把整条证明链内联为直线代码。
+// 需要类型擦除时 (放入容器、跨越翻译单元), 使用 erase<A, B>(f) 显式转换为
+// constructive_logic.h 中的 Implies<A, B>。
+// 除 erase 外所有组合子都是 constexpr: 命题与前提都是字面类型时,
+// 整个证明可以在编译期求值, 例如 static_assert(modus_ponens(1, inc) == 2)。
+
+namespace static_proof {
+
+// F 是 A → B 的证明, 当且仅当 F 可由 A 调用且结果可转换为 B
+template <typename F, typename A, typename B>
+inline constexpr bool is_implication_v = std::is_invocable_r_v<B, const F &, A>;
+
+// Type-erase a static proof at an API boundary: F → Implies<A, B>
+// 显式类型擦除
+template <typename A, typename B, typename F> Implies<A, B> erase(F f) {
+  static_assert(is_implication_v<F, A, B>, "erase: F 不是 A → B 的证明");
+  return Implies<A, B>(std::move(f));
+}
+
+// Modus Ponens: (A, A → B) → B
+template <typename A, typename F>
+constexpr auto modus_ponens(A a, const F &f)
+    -> std::invoke_result_t<const F &, A> {
+  return f(std::move(a));
+}
+
+// --- Move-aware partial applications ---
+// 柯里化组合子的中间结果。以左值调用时复制捕获的前提 (可以多次调用),
+// 以右值调用时把捕获的前提移动到下一阶段, 因此沿着
+// and_intro<A, B>()(std::move(a))(std::move(b)) 这样的右值链不会发生复制。
+namespace detail {
+
+template <typename A, typename B> struct AndIntroPartial {
+  A a;
+  constexpr And<A, B> operator()(B b) const & CPP_PROP_NOEXCEPT {
+    return And<A, B>{a, std::move(b)};
+  }
+  constexpr And<A, B> operator()(B b) && CPP_PROP_NOEXCEPT {
+    return And<A, B>{std::move(a), std::move(b)};
+  }
+};
+
+template <typename A, typename B, typename C, typename AC> struct OrElimRight {
+  Or<A, B> or_ab;
+  AC ac;
+
+  template <typename BC>
+  constexpr C operator()(BC &&bc) const & CPP_PROP_NOEXCEPT {
+    static_assert(is_implication_v<std::decay_t<BC>, B, C>,
+                  "or_elim: 第三个前提必须是 B → C 的证明");
+    if (or_ab.index() == 0) {
+      return ac(std::get<0>(or_ab));
+    }
+    return std::forward<BC>(bc)(std::get<1>(or_ab));
+  }
+  template <typename BC>
+  constexpr C operator()(BC &&bc) && CPP_PROP_NOEXCEPT {
+    static_assert(is_implication_v<std::decay_t<BC>, B, C>,
+                  "or_elim: 第三个前提必须是 B → C 的证明");
+    if (or_ab.index() == 0) {
+      return std::move(ac)(std::get<0>(std::move(or_ab)));
+    }
+    return std::forward<BC>(bc)(std::get<1>(std::move(or_ab)));
+  }
+};
+
+template <typename A, typename B, typename C> struct OrElimLeft {
+  Or<A, B> or_ab;
+
+  template <typename AC>
+  constexpr auto operator()(AC &&ac) const & CPP_PROP_NOEXCEPT {
+    static_assert(is_implication_v<std::decay_t<AC>, A, C>,
+                  "or_elim: 第二个前提必须是 A → C 的证明");
+    return OrElimRight<A, B, C, std::decay_t<AC>>{or_ab, std::forward<AC>(ac)};
+  }
+  template <typename AC>
+  constexpr auto operator()(AC &&ac) && CPP_PROP_NOEXCEPT {
+    static_assert(is_implication_v<std::decay_t<AC>, A, C>,
+                  "or_elim: 第二个前提必须是 A → C 的证明");
+    return OrElimRight<A, B, C, std::decay_t<AC>>{std::move(or_ab),
+                                                  std::forward<AC>(ac)};
+  }
+};
+
+// 复合 bc ∘ ab
+template <typename A, typename C, typename AB, typename BC> struct Composition {
+  AB ab;
+  BC bc;
+  constexpr C operator()(A a) const & CPP_PROP_NOEXCEPT {
+    return bc(ab(std::move(a)));
+  }
+  constexpr C operator()(A a) && CPP_PROP_NOEXCEPT {
+    return std::move(bc)(std::move(ab)(std::move(a)));
+  }
+};
+
+template <typename B, typename A, typename C, typename F> struct PermutedInner {
+  F f;
+  B b;
+  constexpr C operator()(A a) const & CPP_PROP_NOEXCEPT {
+    return f(std::move(a))(b);
+  }
+  constexpr C operator()(A a) && CPP_PROP_NOEXCEPT {
+    return std::move(f)(std::move(a))(std::move(b));
+  }
+};
+
+template <typename A, typename B, typename C, typename F> struct Permuted {
+  F f;
+  constexpr PermutedInner<B, A, C, F> operator()(B b) const & CPP_PROP_NOEXCEPT {
+    return {f, std::move(b)};
+  }
+  constexpr PermutedInner<B, A, C, F> operator()(B b) && CPP_PROP_NOEXCEPT {
+    return {std::move(f), std::move(b)};
+  }
+};
+
+template <typename A, typename B, typename C, typename F> struct ExportedInner {
+  F f;
+  A a;
+  constexpr C operator()(B b) const & CPP_PROP_NOEXCEPT {
+    return f(And<A, B>{a, std::move(b)});
+  }
+  constexpr C operator()(B b) && CPP_PROP_NOEXCEPT {
+    return std::move(f)(And<A, B>{std::move(a), std::move(b)});
+  }
+};
+
+template <typename A, typename B, typename C, typename F> struct Exported {
+  F f;
+  constexpr ExportedInner<A, B, C, F> operator()(A a) const & CPP_PROP_NOEXCEPT {
+    return {f, std::move(a)};
+  }
+  constexpr ExportedInner<A, B, C, F> operator()(A a) && CPP_PROP_NOEXCEPT {
+    return {std::move(f), std::move(a)};
+  }
+};
+
+template <typename A, typename B, typename C, typename F> struct Imported {
+  F f;
+  constexpr C operator()(And<A, B> premises) const & CPP_PROP_NOEXCEPT {
+    return f(std::move(premises.a))(std::move(premises.b));
+  }
+  constexpr C operator()(And<A, B> premises) && CPP_PROP_NOEXCEPT {
+    return std::move(f)(std::move(premises.a))(std::move(premises.b));
+  }
+};
+
+} // namespace detail
+
+// And Introduction: A → (B → (A ∧ B))
+template <typename A, typename B> constexpr auto and_intro() {
+  return [](A a) CPP_PROP_NOEXCEPT {
+    return detail::AndIntroPartial<A, B>{std::move(a)};
+  };
+}
+
+// And Elimination (Left): (A ∧ B) → A
+template <typename A, typename B> constexpr auto and_elim_left() {
+  return [](And<A, B> and_ab) CPP_PROP_NOEXCEPT { return and_ab.a; };
+}
+
+// And Elimination (Right): (A ∧ B) → B
+template <typename A, typename B> constexpr auto and_elim_right() {
+  return [](And<A, B> and_ab) CPP_PROP_NOEXCEPT { return and_ab.b; };
+}
+
+// Or Introduction (Left): A → A ∨ B
+template <typename A, typename B> constexpr auto or_intro_left() {
+  return [](A a) CPP_PROP_NOEXCEPT { return Or<A, B>{std::in_place_index<0>, a}; };
+}
+
+// Or Introduction (Right): B → A ∨ B
+template <typename A, typename B> constexpr auto or_intro_right() {
+  return [](B b) CPP_PROP_NOEXCEPT { return Or<A, B>{std::in_place_index<1>, b}; };
+}
+
+// Or Elimination: (A ∨ B) → ((A → C) → ((B → C) → C))
+template <typename A, typename B, typename C> constexpr auto or_elim() {
+  return [](Or<A, B> or_ab) CPP_PROP_NOEXCEPT {
+    return detail::OrElimLeft<A, B, C>{std::move(or_ab)};
+  };
+}
+
+// Double Negation Introduction: A → ¬¬A
+// ¬A 的证明可以是任意 A → False 的可调用对象
+template <typename A> constexpr auto double_negation_intro() {
+  return [](A a) CPP_PROP_NOEXCEPT {
+    return [a](auto not_a) CPP_PROP_NOEXCEPT -> False {
+      static_assert(is_implication_v<decltype(not_a), A, False>,
+                    "double_negation_intro: 前提必须是 ¬A 的证明");
+      return not_a(a);
+    };
+  };
+}
+
+// Principle of Explosion (Ex Falso Quodlibet): False → A
+template <typename A> constexpr auto principle_of_explosion() {
+  return [](False) CPP_PROP_NOEXCEPT -> A {
+#ifdef CPP_PROP_NO_EXCEPTIONS
+    proof_unreachable(); // False 没有值, 这里不可达
+#else
+    throw std::logic_error("Explosion!");
+#endif
+  };
+}
+
+// 三段论: (A→B) ∧ (B→C) → (A→C)
+template <typename A, typename B, typename C, typename AB, typename BC>
+constexpr auto syllogism(AB &&ab, BC &&bc) {
+  using F = std::decay_t<AB>;
+  using G = std::decay_t<BC>;
+  static_assert(is_implication_v<F, A, B>, "syllogism: ab 不是 A → B");
+  static_assert(is_implication_v<G, B, C>, "syllogism: bc 不是 B → C");
+  return detail::Composition<A, C, F, G>{std::forward<AB>(ab),
+                                         std::forward<BC>(bc)};
+}
+
+// 柯里化三段论: (A→B) → ((B→C) → (A→C))
+template <typename A, typename B, typename C>
+constexpr auto prove_syllogism_curried() {
+  return [](auto ab) CPP_PROP_NOEXCEPT {
+    return [ab = std::move(ab)](auto bc) CPP_PROP_NOEXCEPT {
+      return syllogism<A, B, C>(ab, std::move(bc));
+    };
+  };
+}
+
+// 换质位定律 (Contraposition): (A → B) → (¬B → ¬A)
+template <typename A, typename B> constexpr auto contraposition() {
+  return [](auto ab) CPP_PROP_NOEXCEPT {
+    static_assert(is_implication_v<decltype(ab), A, B>,
+                  "contraposition: 前提必须是 A → B 的证明");
+    return [ab](auto not_b) CPP_PROP_NOEXCEPT {
+      static_assert(is_implication_v<decltype(not_b), B, False>,
+                    "contraposition: 第二个前提必须是 ¬B 的证明");
+      return [ab, not_b](A a) CPP_PROP_NOEXCEPT -> False { return not_b(ab(a)); };
+    };
+  };
+}
+
+// 交换律 (Permutation): (A → (B → C)) → (B → (A → C))
+template <typename A, typename B, typename C, typename F>
+constexpr auto permute(F &&f) {
+  return detail::Permuted<A, B, C, std::decay_t<F>>{std::forward<F>(f)};
+}
+
+// 导出规则 (Exportation): ((A ∧ B) → C) → (A → (B → C))
+template <typename A, typename B, typename C, typename F>
+constexpr auto exportation(F &&f) {
+  static_assert(is_implication_v<std::decay_t<F>, And<A, B>, C>,
+                "exportation: 前提必须是 (A ∧ B) → C 的证明");
+  return detail::Exported<A, B, C, std::decay_t<F>>{std::forward<F>(f)};
+}
+
+// 导入规则 (Importation): (A → (B → C)) → ((A ∧ B) → C)
+template <typename A, typename B, typename C, typename F>
+constexpr auto importation(F &&f) {
+  return detail::Imported<A, B, C, std::decay_t<F>>{std::forward<F>(f)};
+}
+
+// ¬(A ∨ B) → (¬A ∧ ¬B)
+// 结论中的 ¬A, ¬B 是具体的 lambda, 因此返回 And<decltype(not_a), ...>
+template <typename A, typename B> constexpr auto de_morgan_1() {
+  return [](auto not_or_ab) CPP_PROP_NOEXCEPT {
+    static_assert(is_implication_v<decltype(not_or_ab), Or<A, B>, False>,
+                  "de_morgan_1: 前提必须是 ¬(A ∨ B) 的证明");
+    auto not_a = [not_or_ab](A a) CPP_PROP_NOEXCEPT -> False {
+      return not_or_ab(or_intro_left<A, B>()(a));
+    };
+    auto not_b = [not_or_ab](B b) CPP_PROP_NOEXCEPT -> False {
+      return not_or_ab(or_intro_right<A, B>()(b));
+    };
+    return And<decltype(not_a), decltype(not_b)>{not_a, not_b};
+  };
+}
+
+// (¬A ∧ ¬B) → ¬(A ∨ B)
+template <typename A, typename B> constexpr auto de_morgan_2() {
+  return [](auto not_a_and_not_b) CPP_PROP_NOEXCEPT {
+    auto not_a = not_a_and_not_b.a;
+    auto not_b = not_a_and_not_b.b;
+    static_assert(is_implication_v<decltype(not_a), A, False> &&
+                      is_implication_v<decltype(not_b), B, False>,
+                  "de_morgan_2: 前提必须是 ¬A ∧ ¬B 的证明");
+    return [not_a, not_b](Or<A, B> or_ab) CPP_PROP_NOEXCEPT -> False {
+      return or_elim<A, B, False>()(or_ab)(not_a)(not_b);
+    };
+  };
+}
+
+// (A → B) → ((A → ¬B) → ¬A) (Reductio ad Absurdum)
+template <typename A, typename B> constexpr auto reductio_ad_absurdum() {
+  return [](auto a_implies_b) CPP_PROP_NOEXCEPT {
+    static_assert(is_implication_v<decltype(a_implies_b), A, B>,
+                  "reductio_ad_absurdum: 前提必须是 A → B 的证明");
+    return [a_implies_b](auto a_implies_not_b) CPP_PROP_NOEXCEPT {
+      return [a_implies_b, a_implies_not_b](A a) CPP_PROP_NOEXCEPT -> False {
+        B b = modus_ponens(a, a_implies_b);
+        auto not_b = modus_ponens(a, a_implies_not_b);
+        static_assert(is_implication_v<decltype(not_b), B, False>,
+                      "reductio_ad_absurdum: 第二个前提必须是 A → ¬B");
+        return modus_ponens(b, not_b);
+      };
+    };
+  };
+}
+
+} // namespace static_proof
+
+#endif // STATIC_LOGIC_H
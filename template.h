@@ -1,18 +1,86 @@
+#ifndef TEMPLATE_H
+#define TEMPLATE_H
+
+#include <cstddef>
+#include <cstdint>
 #include <type_traits>
+#include <utility>
 
 namespace cpp_prop {
 
 // 基础逻辑类型
-struct TrueType {};
-struct FalseType {};
+// 真值也是求值到自身的元函数, 可以直接作为惰性联结词的操作数
+struct TrueType {
+  using type = TrueType;
+  static constexpr bool eval(std::uint32_t) { return true; }
+};
+struct FalseType {
+  using type = FalseType;
+  static constexpr bool eval(std::uint32_t) { return false; }
+};
+
+// --- 常量求值桥 (Constexpr Evaluation Bridge) ---
+// 除了 ::type, 每个联结词还提供 static constexpr bool eval(std::uint32_t),
+// 参数是一组赋值: 第 i 位为 1 表示变量 Var<i> 为真。用 Var<i> 代替真值实例化
+// 一次公式, 之后每个赋值只是一次 constexpr 函数调用, 不再产生新的类型。
+// Var<i> 不是真值: 以它 (或 detail::Unknown) 为操作数的联结词, ::type 是
+// detail::Unknown。公式内部读取了这样的 ::type 时 (例如 Or<A, typename Not<A>::type>),
+// 结构中会出现 Unknown, IsTautology 据此改为逐个赋值求值。
+template <std::size_t I> struct Var {
+  static_assert(I < 32, "Var: 赋值只有 32 位");
+  static constexpr bool eval(std::uint32_t assignment) {
+    return ((assignment >> I) & 1u) != 0;
+  }
+};
+
+namespace detail {
+
+// 由 Var<i> 算出的 ::type: 真值未知, 没有 eval
+struct Unknown {
+  using type = Unknown;
+};
+
+template <typename T> inline constexpr bool is_symbolic_value_v = false;
+template <std::size_t I> inline constexpr bool is_symbolic_value_v<Var<I>> = true;
+template <> inline constexpr bool is_symbolic_value_v<Unknown> = true;
+
+// 联结词默认情况的 ::type: 任一操作数不是真值时为 Unknown, 否则为 V
+template <typename V, typename... Operands>
+using StrictValue =
+    std::conditional_t<(is_symbolic_value_v<Operands> || ...), Unknown, V>;
+
+// 联结词的各个特化共用的 eval
+template <typename A, typename B> struct AndEval {
+  static constexpr bool eval(std::uint32_t assignment) {
+    return A::eval(assignment) && B::eval(assignment);
+  }
+};
+template <typename A, typename B> struct OrEval {
+  static constexpr bool eval(std::uint32_t assignment) {
+    return A::eval(assignment) || B::eval(assignment);
+  }
+};
+template <typename A> struct NotEval {
+  static constexpr bool eval(std::uint32_t assignment) {
+    return !A::eval(assignment);
+  }
+};
+template <typename A, typename B> struct ImpliesEval {
+  static constexpr bool eval(std::uint32_t assignment) {
+    return !A::eval(assignment) || B::eval(assignment);
+  }
+};
+
+} // namespace detail
 
 // 合取：A ∧ B 为真，当且仅当A和B都为真
-template <typename A, typename B> struct And {
+template <typename A, typename B> struct And : detail::AndEval<A, B> {
   // 默认情况：A或B为假，则整体为假
-  using type = FalseType;
+  using type = detail::StrictValue<FalseType, A, B>;
 };
 // 特化：A和B都为真时，整体为真
-template <> struct And<TrueType, TrueType> {
+template <>
+struct And<TrueType, TrueType> : detail::AndEval<TrueType, TrueType> {
   using type = TrueType;
 };
 
@@ -24,22 +92,25 @@ static_assert(std::is_same_v<And<TrueType, FalseType>::type, FalseType>,
               "And: True ∧ False 应为假");
 
 // 析取：A ∨ B 为真，当且仅当A或B至少一个为真
-template <typename A, typename B> struct Or {
+template <typename A, typename B> struct Or : detail::OrEval<A, B> {
   // 默认情况：A和B都为假，则整体为假
-  using type = FalseType;
+  using type = detail::StrictValue<FalseType, A, B>;
 };
 // 特化：A为真时，整体为真
-template <typename B> struct Or<TrueType, B> {
+template <typename B>
+struct Or<TrueType, B> : detail::OrEval<TrueType, B> {
   using type = TrueType;
 };
 // 特化：B为真时，整体为真（即使A为假）
 
-template <typename A> struct Or<A, TrueType> {
+template <typename A>
+struct Or<A, TrueType> : detail::OrEval<A, TrueType> {
   using type = TrueType;
 };
 // 特化：解决当A和B都为TrueType时的歧义
 
-template <> struct Or<TrueType, TrueType> {
+template <>
+struct Or<TrueType, TrueType> : detail::OrEval<TrueType, TrueType> {
   using type = TrueType;
 };
 
@@ -51,12 +122,12 @@ static_assert(std::is_same_v<Or<FalseType, FalseType>::type, FalseType>,
               "Or: False ∨ False 应为假");
 
 // 否定：¬A 为真，当且仅当A为假
-template <typename A> struct Not {
+template <typename A> struct Not : detail::NotEval<A> {
   // 默认情况：A为真，则否定为假
-  using type = FalseType;
+  using type = detail::StrictValue<FalseType, A>;
 };
 // 特化：A为假时，否定为真
-template <> struct Not<FalseType> {
+template <> struct Not<FalseType> : detail::NotEval<FalseType> {
   using type = TrueType;
 };
 
@@ -68,10 +139,12 @@ static_assert(std::is_same_v<Not<FalseType>::type, TrueType>,
               "Not: ¬False 应为真");
 
 // 蕴含：A → B 为真，当且仅当A为假或B为真（之前的IfThen）
-template <typename A, typename B> struct Implies {
-  using type = TrueType; // 默认：A为假时，蕴含为真
+template <typename A, typename B>
+struct Implies : detail::ImpliesEval<A, B> {
+  using type = detail::StrictValue<TrueType, A, B>; // 默认：A为假时，蕴含为真
 };
-template <typename B> struct Implies<TrueType, B> {
+template <typename B>
+struct Implies<TrueType, B> : detail::ImpliesEval<TrueType, B> {
   using type = B; // A为真时，蕴含结果等于B
 };
 
@@ -79,6 +152,9 @@ template <typename B> struct Implies<TrueType, B> {
 template <typename A, typename B> struct Equiv {
   using type = typename And<typename Implies<A, B>::type,
                             typename Implies<B, A>::type>::type;
+  static constexpr bool eval(std::uint32_t assignment) {
+    return A::eval(assignment) == B::eval(assignment);
+  }
 };
 
 // 验证：True ↔ True → True
@@ -98,34 +174,331 @@ template <typename A, typename B, typename C> struct Syllogism {
       typename Implies<typename And<AB, BC>::type,  // 前提：(A→B) ∧ (B→C)
                        typename Implies<A, C>::type // 结论：A→C
                        >::type;
+  static constexpr bool eval(std::uint32_t assignment) {
+    return Implies<And<Implies<A, B>, Implies<B, C>>, Implies<A, C>>::eval(
+        assignment);
+  }
+};
+
+// --- 惰性联结词 (Lazy Connectives) ---
+// And/Or/Implies 总是先实例化两个操作数的 ::type。惰性版本的操作数是未求值的
+// 元函数 (带 ::type 的类型: TrueType/FalseType, Implies<A, B>, 另一个惰性联结词等),
+// 只有左操作数不能决定结果时才实例化右操作数的 ::type。
+// 默认仍使用严格的 And/Or/Implies; 惰性版本是需要时显式选用的别名模板。
+// 别名不为公式的每个节点产生新类: 结果只是 Decided<真值> 或 Deferred<右操作数>,
+// 与严格版本一样按值 (或右操作数的类型) 共享。两者都不是带 eval 的联结词,
+// 所以 IsTautology 对惰性公式总是逐个赋值求值。
+
+namespace detail {
+// 已确定的值
+template <typename V> struct Decided {
+  using type = V;
+};
+// 未求值的右操作数, 求值时才实例化 R::type; R 没有 ::type 时 (例如 Var<i>)
+// Deferred<R> 也没有, 而不是实例化出错
+template <typename R, typename = void> struct DeferredType {};
+template <typename R>
+struct DeferredType<R, std::void_t<typename R::type>> {
+  using type = typename R::type;
+};
+template <typename R> struct Deferred : DeferredType<R> {};
+template <bool Decides> struct LazySelect {
+  template <typename Result, typename R> using type = Decided<Result>;
+};
+template <> struct LazySelect<false> {
+  template <typename Result, typename R> using type = Deferred<R>;
+};
+} // namespace detail
+
+// False ∧ R → False, 不求值 R
+template <typename L, typename R>
+using LazyAnd = typename detail::LazySelect<
+    std::is_same_v<typename L::type, FalseType>>::template type<FalseType, R>;
+
+// True ∨ R → True, 不求值 R
+template <typename L, typename R>
+using LazyOr = typename detail::LazySelect<
+    std::is_same_v<typename L::type, TrueType>>::template type<TrueType, R>;
+
+// False → R 为真, 不求值 R
+template <typename L, typename R>
+using LazyImplies = typename detail::LazySelect<
+    std::is_same_v<typename L::type, FalseType>>::template type<TrueType, R>;
+
+template <typename X>
+using LazyNot = detail::Decided<typename Not<typename X::type>::type>;
+
+// 等价总是需要两边的值
+template <typename L, typename R>
+using LazyEquiv =
+    detail::Decided<typename Equiv<typename L::type, typename R::type>::type>;
+
+// --- 重言式检查 (Tautology Checking) ---
+// IsTautology<Formula, N> 枚举 N 个变量的全部 2^N 种真值赋值。
+// 赋值用 N 位整数编码: 第 i 位为 1 表示第 i 个变量为 TrueType。
+// 如果 Formula<Var<0>, ..., Var<N-1>> 的每个节点都是带 eval 的联结词, 就只实例化
+// 这一次, 按块做 constexpr 循环; 否则逐个赋值实例化 Formula<TrueType/FalseType...>::type。
+// 两种方式都把赋值按块分组, 块内与块间各用一次 std::integer_sequence 上的
+// 折叠展开, 没有递归, 也就不受模板深度的限制。
+
+// 一组具体的真值赋值, 用于报告反例
+template <typename... Vs> struct Assignment {};
+
+namespace detail {
+
+inline constexpr std::uint32_t kNoFalsifying = ~std::uint32_t{0};
+
+struct NoCounterexample {
+  using assignment = void;
+};
+
+template <std::uint32_t Bits, std::size_t I>
+using VarValue =
+    std::conditional_t<((Bits >> I) & 1u) != 0, TrueType, FalseType>;
+
+template <template <typename...> class Formula, std::uint32_t Bits,
+          typename Indices>
+struct EvaluateAt;
+template <template <typename...> class Formula, std::uint32_t Bits,
+          std::size_t... Is>
+struct EvaluateAt<Formula, Bits, std::index_sequence<Is...>> {
+  using assignment = Assignment<VarValue<Bits, Is>...>;
+  static constexpr bool value =
+      std::is_same_v<typename Formula<VarValue<Bits, Is>...>::type, TrueType>;
+};
+
+// 组内: 返回第一个使公式为假的赋值, 没有则返回 kNoFalsifying
+template <template <typename...> class Formula, std::size_t NVars,
+          std::uint32_t Base, std::uint32_t... Low>
+constexpr std::uint32_t
+first_falsifying_in_block(std::integer_sequence<std::uint32_t, Low...>) {
+  constexpr bool holds[] = {
+      EvaluateAt<Formula, Base | Low, std::make_index_sequence<NVars>>::value...};
+  for (std::uint32_t i = 0; i < sizeof...(Low); ++i) {
+    if (!holds[i]) {
+      return Base | i;
+    }
+  }
+  return kNoFalsifying;
+}
+
+// 组间
+template <template <typename...> class Formula, std::size_t NVars,
+          std::size_t LowBits, std::uint32_t... High>
+constexpr std::uint32_t
+first_falsifying(std::integer_sequence<std::uint32_t, High...>) {
+  constexpr std::uint32_t results[] = {
+      first_falsifying_in_block<Formula, NVars, (High << LowBits)>(
+          std::make_integer_sequence<std::uint32_t,
+                                     (std::uint32_t{1} << LowBits)>{})...};
+  for (std::uint32_t result : results) {
+    if (result != kNoFalsifying) {
+      return result;
+    }
+  }
+  return kNoFalsifying;
+}
+
+// --- 符号实例化 ---
+// is_eval_tree_v<F>: F 的每个节点都是带 eval 的联结词 (And/Or/Not/Implies/Equiv/Syllogism,
+// 或派生自它们的公式类)、Var<i> 或真值。节点按指针匹配, 所以派生类匹配其基类
+// 联结词; Unknown、惰性节点以及其它类都不匹配。
+constexpr bool eval_tree(const void *) { return false; }
+constexpr bool eval_tree(const TrueType *) { return true; }
+constexpr bool eval_tree(const FalseType *) { return true; }
+template <std::size_t I> constexpr bool eval_tree(const Var<I> *) { return true; }
+template <typename A> constexpr bool eval_tree(const Not<A> *);
+template <typename A, typename B> constexpr bool eval_tree(const And<A, B> *);
+template <typename A, typename B> constexpr bool eval_tree(const Or<A, B> *);
+template <typename A, typename B> constexpr bool eval_tree(const Implies<A, B> *);
+template <typename A, typename B> constexpr bool eval_tree(const Equiv<A, B> *);
+template <typename A, typename B, typename C>
+constexpr bool eval_tree(const Syllogism<A, B, C> *);
+
+template <typename T>
+inline constexpr bool is_eval_tree_v = eval_tree(static_cast<const T *>(nullptr));
+
+template <typename A> constexpr bool eval_tree(const Not<A> *) {
+  return is_eval_tree_v<A>;
+}
+template <typename A, typename B> constexpr bool eval_tree(const And<A, B> *) {
+  return is_eval_tree_v<A> && is_eval_tree_v<B>;
+}
+template <typename A, typename B> constexpr bool eval_tree(const Or<A, B> *) {
+  return is_eval_tree_v<A> && is_eval_tree_v<B>;
+}
+template <typename A, typename B> constexpr bool eval_tree(const Implies<A, B> *) {
+  return is_eval_tree_v<A> && is_eval_tree_v<B>;
+}
+template <typename A, typename B> constexpr bool eval_tree(const Equiv<A, B> *) {
+  return is_eval_tree_v<A> && is_eval_tree_v<B>;
+}
+template <typename A, typename B, typename C>
+constexpr bool eval_tree(const Syllogism<A, B, C> *) {
+  return is_eval_tree_v<A> && is_eval_tree_v<B> && is_eval_tree_v<C>;
+}
+
+// Formula<Var<0>, ..., Var<N-1>>; 它不满足 is_eval_tree_v (惰性公式, 读取了 Var 的 ::type,
+// 或没有 eval) 或不能实例化时为 void, 这时只能逐个赋值求值
+template <template <typename...> class Formula, typename Indices, typename = void>
+struct SymbolicOrVoid {
+  using type = void;
+};
+template <template <typename...> class Formula, std::size_t... Is>
+struct SymbolicOrVoid<Formula, std::index_sequence<Is...>,
+                      std::void_t<Formula<Var<Is>...>>> {
+  using type = std::conditional_t<is_eval_tree_v<Formula<Var<Is>...>>,
+                                  Formula<Var<Is>...>, void>;
+};
+
+// 由逐个赋值的结果构造的等价公式: 按 Var<I> 分情况的决策树, 相同的子树与
+// 常量分支合并。共 2^N 次实例化, 只在 SymbolicOrVoid 为 void 时使用
+template <typename V, typename Hi, typename Lo> struct Branch {
+  using type = Or<And<V, Hi>, And<Not<V>, Lo>>;
+};
+template <typename V, typename Same> struct Branch<V, Same, Same> {
+  using type = Same;
+};
+template <typename V> struct Branch<V, TrueType, FalseType> {
+  using type = V;
+};
+template <typename V> struct Branch<V, FalseType, TrueType> {
+  using type = Not<V>;
+};
+
+template <template <typename...> class Formula, std::size_t NVars, std::size_t I,
+          std::uint32_t Bits>
+struct DecisionTree {
+  using type = typename Branch<
+      Var<I>,
+      typename DecisionTree<Formula, NVars, I + 1, (Bits | (std::uint32_t{1} << I))>::type,
+      typename DecisionTree<Formula, NVars, I + 1, Bits>::type>::type;
+};
+template <template <typename...> class Formula, std::size_t NVars, std::uint32_t Bits>
+struct DecisionTree<Formula, NVars, NVars, Bits> {
+  using type = std::conditional_t<
+      EvaluateAt<Formula, Bits, std::make_index_sequence<NVars>>::value, TrueType,
+      FalseType>;
+};
+
+template <template <typename...> class Formula, std::size_t NVars, typename F>
+struct SymbolicSelect {
+  using type = F;
+};
+template <template <typename...> class Formula, std::size_t NVars>
+struct SymbolicSelect<Formula, NVars, void> {
+  using type = typename DecisionTree<Formula, NVars, 0, 0>::type;
+};
+
+// 与 Formula 等价且满足 is_eval_tree_v 的公式, 变量为 Var<0>, ..., Var<N-1>: 能直接用 Var 实例化时
+// 就是 Formula<Var<0>, ..., Var<N-1>>, 否则是决策树。lower、lift 与 type_kernel 使用
+template <template <typename...> class Formula, typename Indices>
+struct Symbolic;
+template <template <typename...> class Formula, std::size_t... Is>
+struct Symbolic<Formula, std::index_sequence<Is...>>
+    : SymbolicSelect<Formula, sizeof...(Is),
+                     typename SymbolicOrVoid<Formula, std::index_sequence<Is...>>::type> {
+};
+
+template <typename F, typename = void> struct HasEval : std::false_type {};
+template <typename F>
+struct HasEval<F, std::void_t<decltype(F::eval(std::uint32_t{}))>>
+    : std::true_type {};
+
+// constexpr 路径的一块。每块是一个独立的常量表达式, 块大小 2^16 让循环
+// 次数和求值步数都低于编译器的默认上限 (-fconstexpr-loop-limit 等)
+template <typename F, std::uint32_t Base, std::uint32_t Count>
+constexpr std::uint32_t first_falsifying_eval_in_block() {
+  for (std::uint32_t i = 0; i < Count; ++i) {
+    if (!F::eval(Base | i)) {
+      return Base | i;
+    }
+  }
+  return kNoFalsifying;
+}
+template <typename F, std::uint32_t Base, std::uint32_t Count>
+inline constexpr std::uint32_t first_falsifying_eval_in_block_v =
+    first_falsifying_eval_in_block<F, Base, Count>();
+
+template <typename F, std::size_t LowBits, std::uint32_t... High>
+constexpr std::uint32_t
+first_falsifying_eval(std::integer_sequence<std::uint32_t, High...>) {
+  constexpr std::uint32_t results[] = {
+      first_falsifying_eval_in_block_v<F, (High << LowBits),
+                                       (std::uint32_t{1} << LowBits)>...};
+  for (std::uint32_t result : results) {
+    if (result != kNoFalsifying) {
+      return result;
+    }
+  }
+  return kNoFalsifying;
+}
+
+template <template <typename...> class Formula, std::size_t NVars,
+          typename F = typename SymbolicOrVoid<
+              Formula, std::make_index_sequence<NVars>>::type,
+          bool = HasEval<F>::value>
+struct FirstFalsifying {
+  static constexpr std::size_t low_bits = NVars < 10 ? NVars : 10;
+  static constexpr std::uint32_t value =
+      first_falsifying<Formula, NVars, low_bits>(
+          std::make_integer_sequence<std::uint32_t,
+                                     (std::uint32_t{1} << (NVars - low_bits))>{});
+};
+template <template <typename...> class Formula, std::size_t NVars, typename F>
+struct FirstFalsifying<Formula, NVars, F, true> {
+  static constexpr std::size_t low_bits = NVars < 16 ? NVars : 16;
+  static constexpr std::uint32_t value = first_falsifying_eval<F, low_bits>(
+      std::make_integer_sequence<std::uint32_t,
+                                 (std::uint32_t{1} << (NVars - low_bits))>{});
+};
+
+} // namespace detail
+
+template <template <typename...> class Formula, std::size_t NVars>
+struct IsTautology {
+  static_assert(NVars < 32, "IsTautology: 最多支持 31 个变量");
+
+  // 第一个使公式为假的赋值 (按编码从小到大), 重言式时为 ~0u
+  static constexpr std::uint32_t first_falsifying =
+      detail::FirstFalsifying<Formula, NVars>::value;
+  static constexpr bool value = first_falsifying == detail::kNoFalsifying;
+  // 第一个反例 Assignment<...>; 重言式时为 void
+  using counterexample = typename std::conditional_t<
+      value, detail::NoCounterexample,
+      detail::EvaluateAt<Formula, first_falsifying,
+                         std::make_index_sequence<NVars>>>::assignment;
+};
+
+template <template <typename...> class Formula, std::size_t NVars>
+inline constexpr bool is_tautology_v = IsTautology<Formula, NVars>::value;
+
+// 诊断: 实例化时编译器会打印 Falsified<Formula, Assignment<...>>,
+// 即第一个使公式为假的赋值
+template <template <typename...> class Formula, typename Counterexample>
+struct Falsified {
+  static_assert(sizeof(Counterexample) == 0,
+                "公式不是重言式, 第一个反例见 Falsified<Formula, Assignment<...>>");
+  static constexpr bool value = false;
+};
+
+// 用法: static_assert(AssertTautology<Syllogism, 3>::value);
+template <template <typename...> class Formula, std::size_t NVars,
+          bool = IsTautology<Formula, NVars>::value>
+struct AssertTautology {
+  static constexpr bool value = true;
+};
+template <template <typename...> class Formula, std::size_t NVars>
+struct AssertTautology<Formula, NVars, false>
+    : Falsified<Formula, typename IsTautology<Formula, NVars>::counterexample> {
 };
 
 // --- 验证三段论是重言式 ---
-// 通过静态断言在编译期检查所有可能的真值组合 (2^3 = 8)
-// 只要有一个组合不为 TrueType，编译就会失败
-static_assert(
-    std::is_same_v<Syllogism<TrueType, TrueType, TrueType>::type, TrueType>,
-    "Syllogism failed for TTT");
-static_assert(
-    std::is_same_v<Syllogism<TrueType, TrueType, FalseType>::type, TrueType>,
-    "Syllogism failed for TTF");
-static_assert(
-    std::is_same_v<Syllogism<TrueType, FalseType, TrueType>::type, TrueType>,
-    "Syllogism failed for TFT");
-static_assert(
-    std::is_same_v<Syllogism<TrueType, FalseType, FalseType>::type, TrueType>,
-    "Syllogism failed for TFF");
-static_assert(
-    std::is_same_v<Syllogism<FalseType, TrueType, TrueType>::type, TrueType>,
-    "Syllogism failed for FTT");
-static_assert(
-    std::is_same_v<Syllogism<FalseType, TrueType, FalseType>::type, TrueType>,
-    "Syllogism failed for FTF");
-static_assert(
-    std::is_same_v<Syllogism<FalseType, FalseType, TrueType>::type, TrueType>,
-    "Syllogism failed for FFT");
-static_assert(
-    std::is_same_v<Syllogism<FalseType, FalseType, FalseType>::type, TrueType>,
-    "Syllogism failed for FFF");
+// 在编译期检查所有可能的真值组合 (2^3 = 8)
+// 只要有一个组合不为 TrueType，编译就会失败, 并报告第一个反例
+static_assert(AssertTautology<Syllogism, 3>::value,
+              "Syllogism 不是重言式");
 
 } // namespace cpp_prop
+
+#endif // TEMPLATE_H
@@ -0,0 +1,23 @@
+#ifndef TESTS_ALLOCATION_COUNTER_H
+#define TESTS_ALLOCATION_COUNTER_H
+
+#include <cstddef>
+
+// 统计全局 operator new 的调用次数, 用于验证证明对象不进行堆分配
+namespace allocation_counter {
+
+std::size_t count();
+
+// 在作用域内统计新增的堆分配次数
+class Scope {
+public:
+  Scope() : start_(count()) {}
+  std::size_t allocations() const { return count() - start_; }
+
+private:
+  std::size_t start_;
+};
+
+} // namespace allocation_counter
+
+#endif // TESTS_ALLOCATION_COUNTER_H
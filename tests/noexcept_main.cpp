@@ -0,0 +1,8 @@
+#include <gtest/gtest.h>
+
+// noexcept_tests 的入口。GTest::gtest_main 以启用异常的方式编译,
+// 这里以 -fno-exceptions 与测试一起编译, 整个可执行文件中的测试代码都不含异常处理。
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
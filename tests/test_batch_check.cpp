@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include "../batch_check.h"
+
+#include <sstream>
+
+using namespace cpp_prop;
+using runtime::BatchOptions;
+using runtime::BatchSummary;
+using runtime::Formula;
+using runtime::InputFormat;
+
+// Test Fixture for the batch checker
+class BatchCheckTest : public ::testing::Test {};
+
+TEST_F(BatchCheckTest, TextResultsInInputOrder) {
+    std::string input =
+        "# classical theorems\n"
+        "(p -> q) & (q -> r) -> p -> r\n"
+        "\n"
+        "p -> q\n"
+        "p &\n"
+        "~(a & b) <-> ~a | ~b";
+    std::ostringstream out;
+    BatchOptions options;
+    options.threads = 3;
+    options.batch_size = 1;
+    options.max_inflight = 2;
+    BatchSummary summary = runtime::run_batch_check(input, InputFormat::Text, out, options);
+    ASSERT_EQ(summary.formulas, 4u);
+    ASSERT_EQ(summary.valid, 2u);
+    ASSERT_EQ(summary.invalid, 1u);
+    ASSERT_EQ(summary.errors, 1u);
+    ASSERT_EQ(out.str(),
+              "2\tvalid\ttruth-table\n"
+              "4\tinvalid\ttruth-table\tp=1 q=0\n"
+              "5\terror\tunexpected end of formula at column 4\n"
+              "6\tvalid\ttruth-table\n");
+}
+
+TEST_F(BatchCheckTest, ManyFormulasAcrossBatches) {
+    // 交替的重言式与非重言式, 小批次让结果必须跨线程重新排序
+    std::string input;
+    for (int i = 0; i < 2000; ++i) {
+        input += i % 2 == 0 ? "x | ~x\n" : "x -> y\n";
+    }
+    for (unsigned threads : {1u, 4u}) {
+        std::ostringstream out;
+        BatchOptions options;
+        options.threads = threads;
+        options.batch_size = 7;
+        BatchSummary summary = runtime::run_batch_check(input, InputFormat::Text, out, options);
+        ASSERT_EQ(summary.valid, 1000u);
+        ASSERT_EQ(summary.invalid, 1000u);
+        std::istringstream lines(out.str());
+        std::string line;
+        for (int i = 1; i <= 2000; ++i) {
+            ASSERT_TRUE(std::getline(lines, line));
+            ASSERT_EQ(line.substr(0, line.find('\t')), std::to_string(i));
+        }
+        ASSERT_FALSE(std::getline(lines, line));
+    }
+}
+
+TEST_F(BatchCheckTest, BinaryInputAndSatBackend) {
+    // 30 个变量的 (x0 ∧ ... ∧ x29) → x29 超出真值表阈值, 由 SAT 检查
+    Formula wide = Formula::var(0);
+    for (unsigned i = 1; i < 30; ++i) {
+        wide = runtime::And(std::move(wide), Formula::var(i));
+    }
+    std::string bytes;
+    runtime::append_binary_header(bytes);
+    runtime::append_binary_formula(bytes, runtime::Implies(wide, Formula::var(29)));
+    runtime::append_binary_formula(bytes, runtime::Implies(Formula::var(29), wide));
+    runtime::append_binary_formula(bytes, runtime::Or(Formula::var(0), Formula::var(1)));
+    bytes += "\5\0\0"; // 截断的记录
+
+    std::ostringstream out;
+    BatchSummary summary = runtime::run_batch_check(bytes, InputFormat::Binary, out);
+    ASSERT_EQ(summary.formulas, 4u);
+    ASSERT_EQ(summary.valid, 1u);
+    ASSERT_EQ(summary.invalid, 2u);
+    ASSERT_EQ(summary.errors, 1u);
+    std::istringstream lines(out.str());
+    std::string line;
+    ASSERT_TRUE(std::getline(lines, line));
+    ASSERT_EQ(line, "1\tvalid\tsat");
+    ASSERT_TRUE(std::getline(lines, line));
+    ASSERT_EQ(line.substr(0, 12), "2\tinvalid\tsa");
+    ASSERT_NE(line.find("x29=1"), std::string::npos);
+    ASSERT_TRUE(std::getline(lines, line));
+    ASSERT_EQ(line, "3\tinvalid\ttruth-table\tx0=0 x1=0");
+    ASSERT_TRUE(std::getline(lines, line));
+    ASSERT_EQ(line, "4\terror\ttruncated binary formula record");
+}
+
+TEST_F(BatchCheckTest, BinarySparseVariablesKeepOriginalNames) {
+    std::string bytes;
+    runtime::append_binary_header(bytes);
+    Formula high = Formula::var(runtime::kBinaryMaxVar);
+    runtime::append_binary_formula(bytes, runtime::Or(high, runtime::Not(high)));
+    runtime::append_binary_formula(bytes, runtime::Implies(Formula::var(1000), high));
+
+    std::ostringstream out;
+    BatchSummary summary = runtime::run_batch_check(bytes, InputFormat::Binary, out);
+    ASSERT_EQ(summary.valid, 1u);
+    ASSERT_EQ(summary.invalid, 1u);
+    ASSERT_EQ(out.str(), "1\tvalid\ttruth-table\n"
+                         "2\tinvalid\ttruth-table\tx1000=1 x536870911=0\n");
+}
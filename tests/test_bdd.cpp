@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include "../bdd.h"
+#include "../truth_table.h"
+
+using namespace cpp_prop;
+using runtime::Bdd;
+using runtime::BddManager;
+using runtime::Formula;
+
+// Test Fixture for the ROBDD engine
+class BddTest : public ::testing::Test {};
+
+namespace {
+
+Formula v(unsigned i) { return Formula::var(i); }
+
+// (x0 ∧ x1) ∨ (x2 ∧ x3) ∨ ... ∨ (x[2n-2] ∧ x[2n-1])
+Formula pairs(unsigned n) {
+    Formula f = runtime::And(v(0), v(1));
+    for (unsigned i = 1; i < n; ++i) {
+        f = runtime::Or(std::move(f), runtime::And(v(2 * i), v(2 * i + 1)));
+    }
+    return f;
+}
+
+} // namespace
+
+TEST_F(BddTest, EquivalentFormulasShareRoot) {
+    BddManager manager(2);
+    // De Morgan: ¬(A ∨ B) ↔ ¬A ∧ ¬B
+    ASSERT_TRUE(manager.equivalent(runtime::Not(runtime::Or(v(0), v(1))),
+                                   runtime::And(runtime::Not(v(0)), runtime::Not(v(1)))));
+    ASSERT_FALSE(manager.equivalent(runtime::Implies(v(0), v(1)), runtime::Implies(v(1), v(0))));
+    Bdd a = manager.var(0);
+    ASSERT_TRUE(manager.Or(a, manager.Not(a)).is_true());
+    ASSERT_TRUE(manager.And(a, manager.Not(a)).is_false());
+}
+
+TEST_F(BddTest, TautologyAndCounterexample) {
+    BddManager manager(3);
+    ASSERT_TRUE(manager.check_tautology(runtime::lower<Syllogism, 3>()).tautology);
+
+    Formula f = runtime::Implies(runtime::Or(v(0), v(2)), runtime::And(v(1), v(2)));
+    runtime::TautologyResult result = manager.check_tautology(f);
+    ASSERT_FALSE(result.tautology);
+    ASSERT_FALSE(f.eval(result.counterexample));
+    ASSERT_FALSE(runtime::check_tautology(f, 3).tautology);
+}
+
+TEST_F(BddTest, MatchesTruthTable) {
+    Formula f = runtime::Equiv(runtime::Or(runtime::And(v(0), v(7)), runtime::Not(v(3))),
+                               runtime::Implies(v(5), runtime::Or(v(2), v(0))));
+    BddManager manager(8);
+    Bdd root = manager.build(f);
+    std::vector<std::uint64_t> table = runtime::truth_table(f, 8);
+    for (std::uint64_t a = 0; a < 256; ++a) {
+        // 把赋值 a 写成常量公式, 检查 f ∧ (赋值) 是否为假
+        Formula point = Formula::constant(true);
+        for (unsigned i = 0; i < 8; ++i) {
+            point = runtime::And(std::move(point), ((a >> i) & 1u) != 0 ? v(i) : runtime::Not(v(i)));
+        }
+        bool holds = !manager.And(root, manager.build(point)).is_false();
+        ASSERT_EQ(holds, ((table[a / 64] >> (a % 64)) & 1u) != 0) << "assignment " << a;
+    }
+}
+
+TEST_F(BddTest, VariableOrderAffectsSize) {
+    // 交错顺序下 pairs(n) 是线性大小, 把每对拆开则是指数大小
+    BddManager interleaved(12);
+    std::vector<unsigned> split_order;
+    for (unsigned i = 0; i < 12; i += 2) split_order.push_back(i);
+    for (unsigned i = 1; i < 12; i += 2) split_order.push_back(i);
+    BddManager split(split_order);
+    std::size_t small = interleaved.node_count(interleaved.build(pairs(6)));
+    std::size_t large = split.node_count(split.build(pairs(6)));
+    ASSERT_EQ(small, 14u);
+    ASSERT_GT(large, 8 * small);
+}
+
+TEST_F(BddTest, StatisticsAndGarbageCollection) {
+    BddManager manager(40);
+    {
+        Bdd big = manager.build(pairs(20));
+        ASSERT_EQ(manager.node_count(big), 42u);
+    }
+    const BddManager::Stats &stats = manager.stats();
+    ASSERT_GT(stats.unique_lookups, 0u);
+    ASSERT_GT(stats.cache_lookups, 0u);
+    std::size_t before = stats.live_nodes;
+    Bdd kept = manager.var(3);
+    manager.collect_garbage();
+    ASSERT_EQ(stats.gc_runs, 1u);
+    ASSERT_EQ(stats.live_nodes, 3u); // 两个终结点和 x3
+    ASSERT_EQ(stats.nodes_collected, before - 3); // x3 已经在 big 中
+    ASSERT_GE(stats.peak_nodes, before);
+
+    // 回收之后重建, 节点编号复用, 结果仍是规范的
+    Bdd again = manager.build(pairs(20));
+    ASSERT_TRUE(manager.equivalent(pairs(20), pairs(20)));
+    ASSERT_EQ(manager.node_count(again), 42u);
+    ASSERT_TRUE(manager.And(kept, manager.var(3)) == kept);
+}
+
+TEST_F(BddTest, ManyVariableEquivalence) {
+    // 60 个变量: 超出真值表的范围, 但 BDD 很小
+    BddManager manager(60);
+    Formula left = pairs(30);
+    Formula right = runtime::Not(runtime::And(runtime::Not(runtime::And(v(0), v(1))),
+                                              runtime::Not(runtime::Or(pairs(30), runtime::And(v(0), v(1))))));
+    ASSERT_TRUE(manager.equivalent(left, right));
+    manager.set_gc_threshold(64);
+    ASSERT_TRUE(manager.check_tautology(runtime::Implies(runtime::And(v(58), v(59)), left)).tautology);
+    ASSERT_GT(manager.stats().gc_runs, 0u);
+}
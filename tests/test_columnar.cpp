@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include "../columnar.h"
+
+#include <random>
+#include <vector>
+
+using namespace cpp_prop;
+
+namespace {
+
+// 内部读取 ::type 的公式, 以 Var<i> 实例化时不能直接提升
+template <typename A> using NestedExcludedMiddle = Or<A, typename Not<A>::type>;
+template <typename A, typename B> using NestedImplies = Or<typename Not<A>::type, B>;
+
+} // namespace
+
+// Test Fixture for fused columnar evaluation
+class ColumnarTest : public ::testing::Test {
+protected:
+    // vars 列随机数据, 每列 rows 行
+    void fill(unsigned vars, std::size_t rows) {
+        this->rows = rows;
+        std::mt19937_64 rng(42);
+        data.assign(vars, std::vector<std::uint64_t>((rows + 63) / 64));
+        for (auto &col : data) {
+            for (std::uint64_t &w : col) {
+                w = rng();
+            }
+        }
+        pointers.clear();
+        for (const auto &col : data) {
+            pointers.push_back(col.data());
+        }
+    }
+
+    // 第 r 行的赋值, 与 template.h 的 eval 一致
+    std::uint32_t assignment(std::size_t r) const {
+        std::uint32_t a = 0;
+        for (std::size_t i = 0; i < data.size(); ++i) {
+            a |= static_cast<std::uint32_t>((data[i][r / 64] >> (r % 64)) & 1u) << i;
+        }
+        return a;
+    }
+
+    std::size_t rows = 0;
+    std::vector<std::vector<std::uint64_t>> data;
+    std::vector<const std::uint64_t *> pointers;
+};
+
+TEST_F(ColumnarTest, MatchesRowByRowEvaluation) {
+    fill(3, 1000); // 不是 64 的整数倍
+    using F = Or<And<Var<0>, Not<Var<1>>>, Equiv<Var<1>, Var<2>>>;
+    auto expr = runtime::lift<F>(pointers.data());
+    std::vector<std::uint64_t> out = runtime::evaluate_columns(expr, rows);
+    std::uint64_t expected_count = 0;
+    for (std::size_t r = 0; r < rows; ++r) {
+        bool expected = F::eval(assignment(r));
+        expected_count += expected;
+        ASSERT_EQ(((out[r / 64] >> (r % 64)) & 1u) != 0, expected) << "row " << r;
+    }
+    // 最后一个字中 rows 之后的位为 0
+    ASSERT_EQ(out.back() >> (rows % 64), 0u);
+    ASSERT_EQ(runtime::count_satisfied(expr, rows), expected_count);
+}
+
+TEST_F(ColumnarTest, BuildersShareTemplateNames) {
+    fill(2, 64 * 37);
+    auto a = runtime::column(data[0]);
+    auto b = runtime::column(data[1]);
+    auto expr = runtime::Implies(runtime::And(a, runtime::Not(b)), runtime::Or(a, b));
+    using F = Implies<And<Var<0>, Not<Var<1>>>, Or<Var<0>, Var<1>>>;
+    ASSERT_EQ(runtime::evaluate_columns(expr, rows),
+              runtime::evaluate_columns(runtime::lift<F>(pointers.data()), rows));
+    // 重言式在每一行都成立
+    ASSERT_EQ(runtime::count_satisfied(expr, rows), rows);
+    ASSERT_EQ(runtime::count_satisfied(runtime::lift<Syllogism, 3>(pointers.data()), 0), 0u);
+}
+
+TEST_F(ColumnarTest, LiftsNestedTypeFormulas) {
+    fill(2, 64 * 5 + 3);
+    ASSERT_EQ(runtime::count_satisfied(runtime::lift<NestedExcludedMiddle, 1>(pointers.data()), 64),
+              64u);
+    ASSERT_EQ(runtime::count_satisfied(runtime::lift<NestedExcludedMiddle, 1>(pointers.data()), rows),
+              rows);
+    ASSERT_EQ(runtime::evaluate_columns(runtime::lift<NestedImplies, 2>(pointers.data()), rows),
+              runtime::evaluate_columns(runtime::lift<Implies, 2>(pointers.data()), rows));
+}
+
+TEST_F(ColumnarTest, ThreadsAgreeWithSingleThread) {
+    fill(4, 64 * 10000 + 5);
+    using F = Implies<And<Var<0>, Var<1>>, Or<Var<2>, Not<Var<3>>>>;
+    auto expr = runtime::lift<F>(pointers.data());
+    runtime::ColumnarOptions options;
+    options.threads = 4;
+    options.chunk_words = 100; // 不是 SIMD 宽度的整数倍
+    ASSERT_EQ(runtime::evaluate_columns(expr, rows, options),
+              runtime::evaluate_columns(expr, rows));
+    ASSERT_EQ(runtime::count_satisfied(expr, rows, options),
+              runtime::count_satisfied(expr, rows));
+    ASSERT_EQ(runtime::count_satisfied(runtime::column_constant(true), rows, options), rows);
+}
+
+TEST_F(ColumnarTest, EveryBuiltLaneSetAgreesWithScalar) {
+    fill(3, 64 * 501 + 17);
+    using F = Equiv<Implies<Var<0>, Var<1>>, Or<Not<Var<0>>, Var<1>>>;
+    auto expr = runtime::Or(runtime::lift<F>(pointers.data()),
+                            runtime::And(runtime::column(data[2]), runtime::column_constant(false)));
+    using runtime::simd::Scalar;
+    const std::vector<std::uint64_t> expected = runtime::evaluate_columns<Scalar>(expr, rows);
+    const std::uint64_t expected_count = runtime::count_satisfied<Scalar>(expr, rows);
+    ASSERT_EQ(expected_count, rows);
+    auto check = [&](auto tag) {
+        using L = decltype(tag);
+        SCOPED_TRACE(L::name);
+        runtime::ColumnarOptions options;
+        options.chunk_words = 37;
+        ASSERT_EQ(runtime::evaluate_columns<L>(expr, rows, options), expected);
+        ASSERT_EQ(runtime::count_satisfied<L>(expr, rows, options), expected_count);
+    };
+    std::apply([&](auto... tags) { (check(tags), ...); }, runtime::simd::Available{});
+}
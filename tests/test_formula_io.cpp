@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include "../formula_io.h"
+#include "../truth_table.h"
+
+#include <cstdio>
+#include <fstream>
+
+using namespace cpp_prop;
+using runtime::BinaryFormulaReader;
+using runtime::Formula;
+using runtime::TextFormulaParser;
+
+// Test Fixture for formula file I/O
+class FormulaIoTest : public ::testing::Test {};
+
+TEST_F(FormulaIoTest, ParsesTextFormulas) {
+    TextFormulaParser parser;
+    Formula f = Formula::constant(false);
+
+    // 三段论: ((p -> q) & (q -> r)) -> (p -> r)
+    ASSERT_TRUE(parser.parse("(p -> q) & (q -> r) -> p -> r", f));
+    ASSERT_EQ(parser.names().size(), 3u);
+    ASSERT_EQ(parser.names()[0], "p");
+    ASSERT_EQ(parser.names()[2], "r");
+    ASSERT_TRUE(runtime::check_tautology(f).tautology);
+    ASSERT_EQ(f.code().size(), (runtime::lower<Syllogism, 3>().code().size()));
+
+    // -> 右结合: p -> q -> p 是重言式, (p -> q) -> p 不是
+    ASSERT_TRUE(parser.parse("p -> q -> p", f));
+    ASSERT_TRUE(runtime::check_tautology(f).tautology);
+    ASSERT_TRUE(parser.parse("(p -> q) -> p", f));
+    ASSERT_FALSE(runtime::check_tautology(f).tautology);
+
+    // 优先级: ~ > & > | > -> > <->
+    ASSERT_TRUE(parser.parse("~(a | b) <-> !a & ~b", f));
+    ASSERT_TRUE(runtime::check_tautology(f).tautology);
+    ASSERT_TRUE(parser.parse("a | b & false <-> a", f));
+    ASSERT_TRUE(runtime::check_tautology(f).tautology);
+    ASSERT_TRUE(parser.parse("~~~true", f));
+    ASSERT_FALSE(f.eval(0));
+}
+
+TEST_F(FormulaIoTest, ReportsTextErrors) {
+    TextFormulaParser parser;
+    Formula f = Formula::constant(true);
+    ASSERT_FALSE(parser.parse("p &", f));
+    ASSERT_FALSE(parser.error().empty());
+    ASSERT_FALSE(parser.parse("(p | q", f));
+    ASSERT_FALSE(parser.parse("p q", f));
+    ASSERT_FALSE(parser.parse("p - q", f));
+    ASSERT_FALSE(parser.parse(std::string(2000, '(') + "p" + std::string(2000, ')'), f));
+    ASSERT_TRUE(parser.parse(std::string(100, '(') + "p" + std::string(100, ')'), f));
+
+    ASSERT_TRUE(TextFormulaParser::is_blank("   "));
+    ASSERT_TRUE(TextFormulaParser::is_blank("  # comment"));
+    ASSERT_FALSE(TextFormulaParser::is_blank(" p"));
+}
+
+TEST_F(FormulaIoTest, BinaryRoundTripThroughMappedFile) {
+    TextFormulaParser parser;
+    const char *lines[] = {"(p -> q) & (q -> r) -> p -> r", "p | ~p", "p -> q",
+                           "a <-> b <-> c"};
+    std::string bytes;
+    runtime::append_binary_header(bytes);
+    std::vector<Formula> expected;
+    for (const char *line : lines) {
+        Formula f = Formula::constant(true);
+        ASSERT_TRUE(parser.parse(line, f));
+        runtime::append_binary_formula(bytes, f);
+        expected.push_back(f);
+    }
+
+    std::string path = ::testing::TempDir() + "formula_io_test.bin";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+    runtime::MappedFile file(path);
+    ASSERT_EQ(file.bytes(), bytes);
+    ASSERT_TRUE(runtime::is_binary_formula_file(file.bytes()));
+
+    BinaryFormulaReader reader(file.bytes());
+    Formula f = Formula::constant(true);
+    for (const Formula &e : expected) {
+        ASSERT_TRUE(reader.next(f));
+        ASSERT_EQ(f.num_vars(), e.num_vars());
+        ASSERT_EQ(f.stack_depth(), e.stack_depth());
+        ASSERT_EQ(runtime::truth_table(f, 3), runtime::truth_table(e, 3));
+    }
+    ASSERT_FALSE(reader.next(f));
+    std::remove(path.c_str());
+
+    // 截断或不合法的记录
+    BinaryFormulaReader truncated(std::string_view(bytes).substr(0, bytes.size() - 2));
+    for (std::size_t i = 0; i + 1 < expected.size(); ++i) {
+        ASSERT_TRUE(truncated.next(f));
+    }
+    ASSERT_THROW(truncated.next(f), std::runtime_error);
+
+    std::string malformed;
+    runtime::append_binary_header(malformed);
+    runtime::append_binary_formula(malformed, runtime::And(Formula::var(0), Formula::var(1)));
+    malformed[8] = 2; // 指令数改为 2: 留下两个值
+    BinaryFormulaReader bad(std::string_view(malformed).substr(0, malformed.size() - 4));
+    ASSERT_THROW(bad.next(f), std::runtime_error);
+    ASSERT_THROW(BinaryFormulaReader("CPPX\1\0\0\0"), std::runtime_error);
+}
+
+TEST_F(FormulaIoTest, BinaryRenumbersSparseVariables) {
+    // 编号接近 2^29 的变量不应让后续引擎按编号大小分配内存
+    const std::uint32_t high = runtime::kBinaryMaxVar;
+    std::string bytes;
+    runtime::append_binary_header(bytes);
+    runtime::append_binary_formula(
+        bytes, runtime::Or(Formula::var(high), runtime::Not(Formula::var(high))));
+    runtime::append_binary_formula(
+        bytes, runtime::Implies(Formula::var(7), Formula::var(3)));
+    runtime::append_binary_formula(bytes, runtime::And(Formula::var(0), Formula::var(1)));
+
+    BinaryFormulaReader reader(bytes);
+    Formula f = Formula::constant(true);
+    ASSERT_TRUE(reader.next(f));
+    ASSERT_EQ(f.num_vars(), 1u);
+    ASSERT_EQ(reader.variables(), std::vector<std::uint32_t>({high}));
+    ASSERT_TRUE(runtime::check_tautology(f).tautology);
+
+    ASSERT_TRUE(reader.next(f));
+    ASSERT_EQ(f.num_vars(), 2u);
+    ASSERT_EQ(reader.variables(), std::vector<std::uint32_t>({3, 7}));
+    ASSERT_EQ(runtime::truth_table(f, 2),
+              runtime::truth_table(runtime::Implies(Formula::var(1), Formula::var(0)), 2));
+
+    ASSERT_TRUE(reader.next(f));
+    ASSERT_EQ(reader.variables(), std::vector<std::uint32_t>({0, 1}));
+    ASSERT_FALSE(reader.next(f));
+}
+
+TEST_F(FormulaIoTest, MissingAndEmptyFiles) {
+    ASSERT_THROW(runtime::MappedFile("/nonexistent/formulas.txt"), std::system_error);
+    std::string path = ::testing::TempDir() + "formula_io_empty.txt";
+    { std::ofstream out(path); }
+    runtime::MappedFile file(path);
+    ASSERT_TRUE(file.bytes().empty());
+    std::remove(path.c_str());
+}
@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+#include "../batch_check.h"
+#include "../formula_kernel.h"
+
+#include <sstream>
+
+using namespace cpp_prop;
+using runtime::BatchOptions;
+using runtime::BatchSummary;
+using runtime::Formula;
+using runtime::FormulaKernel;
+using runtime::InputFormat;
+using runtime::KernelRegistry;
+using runtime::TautologyResult;
+
+namespace {
+
+constexpr char kFolded[] = "(p & true) -> (p | false)";
+constexpr char kCommuted[] = "((p -> q) & (q -> p)) <-> ((q -> p) & (p -> q))";
+constexpr char kPeirce[] = "((p -> q) -> p) -> p";
+constexpr char kNotPeirce[] = "((p -> q) -> p) -> q";
+constexpr char kWide[] = "(a & b & c & d & e & f & g & h & i & j & k) -> (k <-> ~~k)";
+constexpr char kWideInvalid[] = "(a | b | c | d | e | f | g | h | i | j) -> k";
+constexpr char kTooWide[] =
+    "(a | b | c | d | e | f | g | h | i | j | k | l | m | n | o | p | q | r | s | t) -> u";
+
+// 内部读取 ::type 的公式: A ∨ ¬A 与 ¬A → False (即 A)
+template <typename A> using NestedExcludedMiddle = Or<A, typename Not<A>::type>;
+template <typename A> using NotAImpliesFalse = Implies<typename Not<A>::type, FalseType>;
+
+Formula parse(const char *text) {
+    runtime::TextFormulaParser parser;
+    Formula formula = Formula::constant(true);
+    EXPECT_TRUE(parser.parse(text, formula)) << parser.error();
+    return formula;
+}
+
+} // namespace
+
+// Test Fixture for compiled formula kernels
+class FormulaKernelTest : public ::testing::Test {};
+
+TEST_F(FormulaKernelTest, ConstantsFoldAtCompileTime) {
+    // (p ∧ ⊤) → (p ∨ ⊥) 化简为 p → p, 再化简为 ⊤
+    constexpr auto &folded = runtime::detail::TextSource<kFolded>::program;
+    static_assert(folded.size == 1);
+    static_assert(folded.nodes[0].op == runtime::Opcode::True);
+
+    using Contradiction = And<Var<0>, Not<Var<0>>>;
+    constexpr auto &contradiction = runtime::detail::TypeSource<Contradiction>::program;
+    static_assert(contradiction.size == 1);
+    static_assert(contradiction.nodes[0].op == runtime::Opcode::False);
+
+    FormulaKernel kernel = runtime::text_kernel<kFolded>("folded");
+    ASSERT_EQ(kernel.num_vars, 1u);
+    ASSERT_TRUE(runtime::check_tautology(kernel).tautology);
+}
+
+TEST_F(FormulaKernelTest, SharedSubtermsAreComputedOnce) {
+    // 三个变量, A → B, B → C, 合取, A → C, 蕴涵
+    FormulaKernel syllogism = runtime::type_kernel<Syllogism, 3>("syllogism");
+    ASSERT_EQ(syllogism.nodes, 8u);
+    ASSERT_EQ(syllogism.num_vars, 3u);
+
+    // 交换律下相同的两边合并, 整个等价式成为 ⊤
+    FormulaKernel commuted = runtime::text_kernel<kCommuted>("commuted");
+    ASSERT_EQ(commuted.nodes, 1u);
+    ASSERT_TRUE(runtime::check_tautology(commuted).tautology);
+}
+
+TEST_F(FormulaKernelTest, AgreesWithTruthTableEvaluator) {
+    struct Case {
+        FormulaKernel kernel;
+        const char *text;
+    };
+    Case cases[] = {
+        {runtime::text_kernel<kPeirce>("peirce"), kPeirce},
+        {runtime::text_kernel<kNotPeirce>("not_peirce"), kNotPeirce},
+        {runtime::text_kernel<kWide>("wide"), kWide},
+        {runtime::text_kernel<kWideInvalid>("wide_invalid"), kWideInvalid},
+    };
+    for (const Case &c : cases) {
+        Formula formula = parse(c.text);
+        ASSERT_EQ(c.kernel.num_vars, formula.num_vars()) << c.text;
+        TautologyResult expected = runtime::check_tautology(formula);
+        TautologyResult actual = runtime::check_tautology(c.kernel);
+        ASSERT_EQ(actual.tautology, expected.tautology) << c.text;
+        ASSERT_EQ(actual.counterexample, expected.counterexample) << c.text;
+        runtime::TruthTableEvaluator evaluator(formula, formula.num_vars());
+        for (std::uint64_t block = 0; block < evaluator.num_blocks(); ++block) {
+            runtime::Block value = c.kernel.evaluate(block);
+            const runtime::Block &reference = evaluator.evaluate(block);
+            for (std::size_t i = 0; i < runtime::Block::words; ++i) {
+                ASSERT_EQ(value.w[i] & runtime::detail::valid_mask(formula.num_vars(), i),
+                          reference.w[i] & runtime::detail::valid_mask(formula.num_vars(), i))
+                    << c.text;
+            }
+        }
+    }
+
+    FormulaKernel not_peirce = runtime::text_kernel<kNotPeirce>("not_peirce");
+    ASSERT_EQ(not_peirce.names.size(), 2u);
+    ASSERT_EQ(not_peirce.names[0], "p");
+    ASSERT_EQ(not_peirce.names[1], "q");
+}
+
+TEST_F(FormulaKernelTest, CompilesNestedTypeFormulas) {
+    FormulaKernel lem = runtime::type_kernel<NestedExcludedMiddle, 1>("lem");
+    ASSERT_TRUE(runtime::check_tautology(lem).tautology);
+    FormulaKernel not_a = runtime::type_kernel<NotAImpliesFalse, 1>("not_a");
+    TautologyResult result = runtime::check_tautology(not_a);
+    ASSERT_FALSE(result.tautology);
+    ASSERT_EQ(result.counterexample, 0u);
+
+    KernelRegistry registry;
+    registry.add(std::move(lem));
+    registry.add(std::move(not_a));
+    std::ostringstream out;
+    BatchOptions options;
+    options.threads = 1;
+    options.kernels = &registry;
+    runtime::run_batch_check("@lem\n@not_a\n", InputFormat::Text, out, options);
+    ASSERT_EQ(out.str(), "1\tvalid\tkernel\n2\tinvalid\tkernel\tx0=0\n");
+}
+
+TEST_F(FormulaKernelTest, RegistryFindsKernelsByName) {
+    KernelRegistry registry;
+    ASSERT_TRUE(registry.add(runtime::text_kernel<kPeirce>("peirce")));
+    ASSERT_TRUE(registry.add(runtime::type_kernel<Syllogism, 3>("syllogism")));
+    ASSERT_FALSE(registry.add(runtime::text_kernel<kNotPeirce>("peirce")));
+    const FormulaKernel *peirce = registry.find("peirce");
+    ASSERT_NE(peirce, nullptr);
+    ASSERT_EQ(peirce->num_vars, 2u);
+    ASSERT_EQ(registry.find("missing"), nullptr);
+    ASSERT_EQ(registry.list().size(), 2u);
+    ASSERT_EQ(registry.list()[1]->name, "syllogism");
+}
+
+TEST_F(FormulaKernelTest, BatchDispatchesKernelLines) {
+    KernelRegistry registry;
+    registry.add(runtime::text_kernel<kPeirce>("peirce"));
+    registry.add(runtime::text_kernel<kNotPeirce>("not_peirce"));
+    std::string input =
+        "@peirce\n"
+        "p -> p\n"
+        "  @not_peirce \n"
+        "@missing\n";
+    std::ostringstream out;
+    BatchOptions options;
+    options.threads = 2;
+    options.kernels = &registry;
+    BatchSummary summary = runtime::run_batch_check(input, InputFormat::Text, out, options);
+    ASSERT_EQ(summary.formulas, 4u);
+    ASSERT_EQ(summary.valid, 2u);
+    ASSERT_EQ(summary.invalid, 1u);
+    ASSERT_EQ(summary.errors, 1u);
+    ASSERT_EQ(out.str(),
+              "1\tvalid\tkernel\n"
+              "2\tvalid\ttruth-table\n"
+              "3\tinvalid\tkernel\tp=1 q=0\n"
+              "4\terror\tunknown kernel 'missing'\n");
+}
+
+TEST_F(FormulaKernelTest, BatchRejectsKernelsBeyondTruthTableLimit) {
+    FormulaKernel wide = runtime::text_kernel<kTooWide>("too_wide");
+    ASSERT_EQ(wide.num_vars, runtime::kTruthTableMaxVars + 1);
+    ASSERT_THROW(runtime::check_formula(wide), std::invalid_argument);
+
+    KernelRegistry registry;
+    registry.add(std::move(wide));
+    std::ostringstream out;
+    BatchOptions options;
+    options.threads = 1;
+    options.kernels = &registry;
+    BatchSummary summary = runtime::run_batch_check("@too_wide\n", InputFormat::Text, out, options);
+    ASSERT_EQ(summary.errors, 1u);
+    ASSERT_EQ(out.str(),
+              "1\terror\tkernel 'too_wide' has 21 variables, more than the truth-table limit of 20\n");
+}
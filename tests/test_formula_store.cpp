@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include "../formula_store.h"
+#include "../template.h"
+
+#include <random>
+
+using namespace cpp_prop;
+using runtime::Formula;
+using runtime::FormulaStore;
+using runtime::NodeId;
+
+// Test Fixture for the hash-consed formula DAG
+class FormulaStoreTest : public ::testing::Test {};
+
+namespace {
+
+// 随机公式, 变量取自 0..num_vars-1
+Formula random_formula(std::mt19937 &rng, unsigned num_vars, int depth) {
+    if (depth == 0 || rng() % 4 == 0) {
+        return Formula::var(rng() % num_vars);
+    }
+    switch (rng() % 5) {
+    case 0:
+        return runtime::Not(random_formula(rng, num_vars, depth - 1));
+    case 1:
+        return runtime::And(random_formula(rng, num_vars, depth - 1),
+                            random_formula(rng, num_vars, depth - 1));
+    case 2:
+        return runtime::Or(random_formula(rng, num_vars, depth - 1),
+                           random_formula(rng, num_vars, depth - 1));
+    case 3:
+        return runtime::Implies(random_formula(rng, num_vars, depth - 1),
+                                random_formula(rng, num_vars, depth - 1));
+    default:
+        return runtime::Equiv(random_formula(rng, num_vars, depth - 1),
+                              random_formula(rng, num_vars, depth - 1));
+    }
+}
+
+} // namespace
+
+TEST_F(FormulaStoreTest, IdenticalStructureSharesId) {
+    FormulaStore store;
+    NodeId a = store.var(0);
+    NodeId b = store.var(1);
+    ASSERT_EQ(store.var(0), a);
+    ASSERT_EQ(store.Implies(a, b), store.Implies(store.var(0), store.var(1)));
+    ASSERT_NE(store.Implies(a, b), store.Implies(b, a));
+    ASSERT_NE(store.And(a, b), store.Or(a, b));
+    ASSERT_EQ(store.constant(true), store.constant(true));
+    ASSERT_NE(store.constant(true), store.constant(false));
+
+    // Syllogism 在同一个 store 中只存一份
+    NodeId first = store.intern(runtime::lower<Syllogism, 3>());
+    std::size_t size = store.size();
+    NodeId second = store.intern(runtime::lower<Syllogism, 3>());
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(store.size(), size);
+    ASSERT_GT(store.stats().hits, 0u);
+}
+
+TEST_F(FormulaStoreTest, SharedSubformulasAreStoredOnce) {
+    FormulaStore store;
+    // f_0 = x0, f_{k+1} = f_k ∧ f_k: 展开成树有 2^(k+1) - 1 个节点, DAG 只有 k + 1 个
+    NodeId f = store.var(0);
+    for (int k = 0; k < 40; ++k) {
+        f = store.And(f, f);
+    }
+    ASSERT_EQ(store.reachable(f).size(), 41u);
+    ASSERT_EQ(store.tree_size(f), (std::uint64_t{1} << 41) - 1);
+    ASSERT_TRUE(store.eval(f, 1));
+    ASSERT_FALSE(store.eval(f, 0));
+
+    // Syllogism 中 A → B、B → C 等子公式各出现两次
+    NodeId syllogism = store.intern(runtime::lower<Syllogism, 3>());
+    ASSERT_LT(store.reachable(syllogism).size(), store.tree_size(syllogism));
+}
+
+TEST_F(FormulaStoreTest, RoundTripsThroughPostfixFormula) {
+    FormulaStore store;
+    std::mt19937 rng(12);
+    for (int i = 0; i < 200; ++i) {
+        Formula formula = random_formula(rng, 6, 6);
+        NodeId id = store.intern(formula);
+        Formula back = store.to_formula(id);
+        ASSERT_EQ(back.code().size(), formula.code().size());
+        ASSERT_EQ(store.intern(back), id);
+        for (std::uint64_t a = 0; a < 64; ++a) {
+            ASSERT_EQ(store.eval(id, a), formula.eval(a));
+        }
+    }
+}
+
+TEST_F(FormulaStoreTest, TautologyCheckMatchesTruthTable) {
+    FormulaStore store;
+    ASSERT_TRUE(store.check_tautology(store.intern(runtime::lower<Syllogism, 3>()), 3).tautology);
+
+    std::mt19937 rng(34);
+    for (int i = 0; i < 200; ++i) {
+        Formula formula = random_formula(rng, 12, 7);
+        NodeId id = store.intern(formula);
+        runtime::TautologyResult expected = runtime::check_tautology(formula, 12);
+        runtime::TautologyResult actual = store.check_tautology(id, 12);
+        ASSERT_EQ(actual.tautology, expected.tautology);
+        ASSERT_EQ(actual.counterexample, expected.counterexample);
+    }
+
+    // 共享很深的公式: 展开的后缀形式放不进内存, DAG 上仍可以检查
+    NodeId x = store.var(10);
+    NodeId f = store.Or(x, store.Not(x));
+    for (int k = 0; k < 40; ++k) {
+        f = store.And(f, f);
+    }
+    ASSERT_TRUE(store.check_tautology(f, 11).tautology);
+    ASSERT_THROW(store.check_tautology(f, 10), std::invalid_argument);
+}
+
+TEST_F(FormulaStoreTest, EvalRejectsVariablesBeyondAssignment) {
+    FormulaStore store;
+    NodeId low = store.var(63);
+    ASSERT_TRUE(store.eval(low, std::uint64_t{1} << 63));
+    NodeId f = store.And(store.var(0), store.var(64));
+    ASSERT_THROW(store.eval(f, ~std::uint64_t{0}), std::invalid_argument);
+}
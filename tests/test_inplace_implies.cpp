@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include "../constructive_logic.h"
+#include "../inplace_implies.h"
+#include "allocation_counter.h"
+
+#include <memory>
+
+using Inplace = InplacePolicy<64>;
+
+// Test Fixture for fixed-capacity type-erased implications
+class InplaceImpliesTest : public ::testing::Test {};
+
+TEST_F(InplaceImpliesTest, StoresClosureInline) {
+    int offset = 3;
+    allocation_counter::Scope scope;
+    InplaceImplies<int, int, 16> f = [offset](int x) { return x + offset; };
+    InplaceImplies<int, int, 16> g = f;
+    InplaceImplies<int, int, 32> wider = g;
+    ASSERT_EQ(f(1), 4);
+    ASSERT_EQ(g(2), 5);
+    ASSERT_EQ(wider(3), 6);
+    ASSERT_EQ(scope.allocations(), 0u);
+}
+
+TEST_F(InplaceImpliesTest, EmptyThrowsLikeStdFunction) {
+    InplaceImplies<int, int> empty;
+    ASSERT_FALSE(static_cast<bool>(empty));
+    ASSERT_THROW(empty(1), std::bad_function_call);
+}
+
+TEST_F(InplaceImpliesTest, RunsCaptureDestructors) {
+    auto shared = std::make_shared<int>(7);
+    {
+        InplaceImplies<int, int> f = [shared](int x) { return x + *shared; };
+        InplaceImplies<int, int> moved = std::move(f);
+        ASSERT_EQ(shared.use_count(), 2);
+        ASSERT_EQ(moved(1), 8);
+    }
+    ASSERT_EQ(shared.use_count(), 1);
+}
+
+TEST_F(InplaceImpliesTest, OrElimWithPolicyNeverAllocates) {
+    ImpliesWith<True, int, Inplace> one = [](True) { return 1; };
+    ImpliesWith<True, False, Inplace> refute = [](True) { return False{}; };
+
+    allocation_counter::Scope scope;
+    auto elim = or_elim<True, True, int, Inplace>();
+    int left = elim(Or<True, True>{std::in_place_index<0>, True{}})(one)(one);
+    auto dm2 = de_morgan_2<True, True, Inplace>();
+    False f = dm2(And<NotWith<True, Inplace>, NotWith<True, Inplace>>{refute, refute})(
+        Or<True, True>{std::in_place_index<1>, True{}});
+    auto curried = prove_syllogism_curried<True, int, int, Inplace>();
+    ImpliesWith<int, int, Inplace> inc = [](int x) { return x + 1; };
+    int chained = curried(one)(inc)(True{});
+    (void)f;
+    ASSERT_EQ(left, 1);
+    ASSERT_EQ(chained, 2);
+    ASSERT_EQ(scope.allocations(), 0u);
+}
+
+TEST_F(InplaceImpliesTest, BindGrowsCapacityExplicitly) {
+    auto small = [](int x) { return x; };
+    ASSERT_TRUE((std::is_same_v<decltype(Inplace::bind<int>(small)),
+                                InplaceImplies<int, int, 64>>));
+
+    // 捕获两个 64 字节前提的闭包放不进 64 字节, 结果的容量随闭包增大
+    ImpliesWith<int, int, Inplace> f = [](int x) { return x + 1; };
+    auto both = [f, g = f](int x) { return g(f(x)); };
+    using Bound = Inplace::bound<int, decltype(both)>;
+    ASSERT_EQ(Inplace::bound_capacity<decltype(both)>, sizeof(both));
+    ASSERT_GT(Bound::capacity, 64u);
+    ASSERT_TRUE((std::is_same_v<decltype(Inplace::bind<int>(both)), Bound>));
+    ASSERT_EQ(Inplace::bind<int>(both)(1), 3);
+}
+
+TEST_F(InplaceImpliesTest, DefaultPolicyKeepsTheoremSignatures) {
+    ASSERT_TRUE((std::is_same_v<decltype(or_elim<True, False, True>()),
+                                decltype(or_elim<True, False, True, StdFunctionPolicy>())>));
+    ASSERT_TRUE((std::is_same_v<decltype(contraposition<True, True>()),
+                                Implies<Implies<True, True>, Implies<Not<True>, Not<True>>>>));
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include "../constructive_logic.h"
+#include "../inplace_implies.h"
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// 本文件同时编入 logic_tests (未开启计数) 与 instrumented_tests
+// (以 CPP_PROP_INSTRUMENT 编译), 分别检查两种配置
+
+// Test Fixture for proof instrumentation counters
+class InstrumentationTest : public ::testing::Test {
+protected:
+    void SetUp() override { before = proof_stats::snapshot(); }
+
+    // 自 SetUp 以来的新增计数
+    std::uint64_t delta(proof_stats::Combinator c, proof_stats::Event e) const {
+        return proof_stats::snapshot()(c, e) - before(c, e);
+    }
+
+    proof_stats::Snapshot before;
+};
+
+#ifdef CPP_PROP_INSTRUMENT
+
+TEST_F(InstrumentationTest, CountsConstructionsAndInvocations) {
+    And<int, int> both = and_intro<int, int>()(1)(2);
+    ASSERT_EQ(both.b, 2);
+    // 外层与内层闭包各构造一次、各调用一次
+    ASSERT_EQ(delta(proof_stats::AndIntro, proof_stats::Construction), 2u);
+    ASSERT_EQ(delta(proof_stats::AndIntro, proof_stats::Invocation), 2u);
+
+    Implies<int, int> inc = [](int x) { return x + 1; };
+    ASSERT_EQ(modus_ponens(1, inc), 2);
+    ASSERT_EQ(delta(proof_stats::ModusPonens, proof_stats::Invocation), 1u);
+}
+
+TEST_F(InstrumentationTest, CountsPremiseCopies) {
+    Implies<int, int> inc = [](int x) { return x + 1; };
+    Implies<int, int> chain = syllogism<int, int, int>(inc, inc);
+    std::uint64_t copies = delta(proof_stats::Syllogism, proof_stats::PremiseCopy);
+    Implies<int, int> copy = chain;
+    ASSERT_EQ(copy(0), 2);
+    ASSERT_EQ(delta(proof_stats::Syllogism, proof_stats::PremiseCopy), copies + 1);
+}
+
+TEST_F(InstrumentationTest, CountsOrElimBranches) {
+    Implies<int, int> id = [](int x) { return x; };
+    Implies<bool, int> one = [](bool) { return 1; };
+    auto elim = or_elim<int, bool, int>();
+    elim(Or<int, bool>{std::in_place_index<0>, 5})(id)(one);
+    elim(Or<int, bool>{std::in_place_index<1>, true})(id)(one);
+    elim(Or<int, bool>{std::in_place_index<1>, false})(id)(one);
+    ASSERT_EQ(delta(proof_stats::OrElim, proof_stats::LeftBranch), 1u);
+    ASSERT_EQ(delta(proof_stats::OrElim, proof_stats::RightBranch), 2u);
+}
+
+TEST_F(InstrumentationTest, CountsExplosions) {
+    Implies<False, int> explode = principle_of_explosion<int>();
+    ASSERT_THROW(explode(False{}), std::logic_error);
+    ASSERT_EQ(delta(proof_stats::PrincipleOfExplosion, proof_stats::Explosion), 1u);
+    ASSERT_EQ(delta(proof_stats::PrincipleOfExplosion, proof_stats::Invocation), 1u);
+}
+
+TEST_F(InstrumentationTest, InplacePolicyStaysAllocationFreeAndCounted) {
+    using Inplace = InplacePolicy<64>;
+    ImpliesWith<int, False, Inplace> refute = [](int) { return False{}; };
+    auto dm2 = de_morgan_2<int, int, Inplace>();
+    dm2(And<NotWith<int, Inplace>, NotWith<int, Inplace>>{refute, refute})(
+        Or<int, int>{std::in_place_index<0>, 1});
+    ASSERT_EQ(delta(proof_stats::DeMorgan2, proof_stats::Construction), 2u);
+    ASSERT_EQ(delta(proof_stats::OrElim, proof_stats::LeftBranch), 1u);
+}
+
+TEST_F(InstrumentationTest, AggregatesAcrossThreads) {
+    const unsigned threads = 4, calls = 1000;
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([] {
+            Implies<int, int> inc = [](int x) { return x + 1; };
+            int x = 0;
+            for (unsigned i = 0; i < calls; ++i) {
+                x = modus_ponens(x, inc);
+            }
+            EXPECT_EQ(x, static_cast<int>(calls));
+        });
+    }
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+    // 线程退出后计数并入汇总
+    ASSERT_EQ(delta(proof_stats::ModusPonens, proof_stats::Invocation), threads * calls);
+    ASSERT_STREQ(proof_stats::name(proof_stats::ModusPonens), "modus_ponens");
+}
+
+#else
+
+TEST_F(InstrumentationTest, DisabledCountersStayZero) {
+    static_assert(!proof_stats::enabled);
+    And<int, int> both = and_intro<int, int>()(1)(2);
+    ASSERT_EQ(both.a, 1);
+    ASSERT_EQ(proof_stats::snapshot().total(proof_stats::Construction), 0u);
+    ASSERT_EQ(proof_stats::snapshot().total(proof_stats::Invocation), 0u);
+}
+
+#endif // CPP_PROP_INSTRUMENT
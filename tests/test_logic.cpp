@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "../template.h"
+#include <tuple>
 
 using namespace cpp_prop;
 
@@ -43,5 +44,161 @@ TEST_F(LogicTest, Syllogism) {
     ASSERT_TRUE((std::is_same_v<Syllogism<TrueType, TrueType, TrueType>::type, TrueType>));
     ASSERT_TRUE((std::is_same_v<Syllogism<TrueType, TrueType, FalseType>::type, TrueType>));
     ASSERT_TRUE((std::is_same_v<Syllogism<TrueType, FalseType, TrueType>::type, TrueType>));
+    ASSERT_TRUE((std::is_same_v<Syllogism<TrueType, FalseType, FalseType>::type, TrueType>));
     ASSERT_TRUE((std::is_same_v<Syllogism<FalseType, TrueType, TrueType>::type, TrueType>));
+    ASSERT_TRUE((std::is_same_v<Syllogism<FalseType, TrueType, FalseType>::type, TrueType>));
+    ASSERT_TRUE((std::is_same_v<Syllogism<FalseType, FalseType, TrueType>::type, TrueType>));
+    ASSERT_TRUE((std::is_same_v<Syllogism<FalseType, FalseType, FalseType>::type, TrueType>));
+}
+
+// 排中律: A ∨ ¬A
+template <typename A> struct ExcludedMiddle {
+    using type = typename Or<A, typename Not<A>::type>::type;
+};
+
+// 非重言式: A → B
+template <typename A, typename B> struct Converse {
+    using type = typename Implies<A, B>::type;
+};
+
+// 12 个变量, 只有最后一个参与: A0, ..., A11 ⊢ A11 ∨ ¬A11
+template <typename... Vs> struct LastExcludedMiddle {
+    using last = std::tuple_element_t<sizeof...(Vs) - 1, std::tuple<Vs...>>;
+    using type = typename ExcludedMiddle<last>::type;
+};
+
+TEST_F(LogicTest, IsTautology) {
+    ASSERT_TRUE((is_tautology_v<Syllogism, 3>));
+    ASSERT_TRUE((is_tautology_v<ExcludedMiddle, 1>));
+    ASSERT_FALSE((is_tautology_v<Equiv, 2>));
+    ASSERT_TRUE((is_tautology_v<LastExcludedMiddle, 12>));
+    ASSERT_FALSE((is_tautology_v<Converse, 2>));
+}
+
+TEST_F(LogicTest, IsTautologyCounterexample) {
+    // A → B 在 A = True, B = False (编码 0b01) 时为假
+    ASSERT_EQ((IsTautology<Converse, 2>::first_falsifying), 1u);
+    ASSERT_TRUE((std::is_same_v<IsTautology<Converse, 2>::counterexample,
+                                Assignment<TrueType, FalseType>>));
+    ASSERT_TRUE((std::is_same_v<IsTautology<Syllogism, 3>::counterexample, void>));
+    ASSERT_TRUE((AssertTautology<Syllogism, 3>::value));
+}
+
+// 求值即编译失败的操作数, 用于检查惰性联结词没有实例化它
+template <typename T> struct Poison {
+    static_assert(sizeof(T) == 0, "Poison 不应被求值");
+    using type = TrueType;
+};
+
+TEST_F(LogicTest, LazyConnectivesShortCircuit) {
+    ASSERT_TRUE((std::is_same_v<LazyAnd<FalseType, Poison<int>>::type, FalseType>));
+    ASSERT_TRUE((std::is_same_v<LazyOr<TrueType, Poison<int>>::type, TrueType>));
+    ASSERT_TRUE((std::is_same_v<LazyImplies<FalseType, Poison<int>>::type, TrueType>));
+    // 左操作数本身也可以是未求值的元函数
+    ASSERT_TRUE((std::is_same_v<
+                 LazyImplies<LazyAnd<Implies<TrueType, FalseType>, Poison<int>>, Poison<long>>::type,
+                 TrueType>));
+}
+
+// 三段论的惰性写法, 与严格版本逐个赋值比较
+template <typename A, typename B, typename C> struct LazySyllogism {
+    using type = typename LazyImplies<LazyAnd<Implies<A, B>, Implies<B, C>>,
+                                      Implies<A, C>>::type;
+};
+template <typename A, typename B, typename C> struct LazyMatchesEager {
+    using type = typename LazyEquiv<Syllogism<A, B, C>, LazySyllogism<A, B, C>>::type;
+};
+
+// 别名形式的惰性公式: 用 Var<i> 实例化时不能被当作带 eval 的公式
+template <typename A, typename B, typename C>
+using LazySyllogismAlias =
+    LazyImplies<LazyAnd<Implies<A, B>, Implies<B, C>>, Implies<A, C>>;
+template <typename A, typename B, typename C> using LazyOrOfImplies = LazyOr<Implies<A, B>, C>;
+template <typename A, typename B> using LazyEquivOfImplies = LazyEquiv<Implies<A, B>, Implies<B, A>>;
+
+TEST_F(LogicTest, LazyConnectivesMatchEager) {
+    ASSERT_TRUE((is_tautology_v<LazyMatchesEager, 3>));
+    ASSERT_TRUE((is_tautology_v<LazySyllogismAlias, 3>));
+    ASSERT_FALSE((is_tautology_v<LazyOrOfImplies, 3>));
+    ASSERT_TRUE((std::is_same_v<IsTautology<LazyOrOfImplies, 3>::counterexample,
+                                Assignment<TrueType, FalseType, FalseType>>));
+    ASSERT_FALSE((is_tautology_v<LazyEquivOfImplies, 2>));
+    ASSERT_TRUE((std::is_same_v<LazyNot<Implies<TrueType, FalseType>>::type, TrueType>));
+    ASSERT_TRUE((std::is_same_v<LazyOr<FalseType, Not<TrueType>>::type, FalseType>));
+    ASSERT_TRUE((std::is_same_v<LazyEquiv<FalseType, Not<TrueType>>::type, TrueType>));
+}
+
+TEST_F(LogicTest, ConstexprEval) {
+    // 赋值 0b01: Var<0> 为真, Var<1> 为假
+    static_assert(Var<0>::eval(0b01) && !Var<1>::eval(0b01));
+    ASSERT_FALSE((And<Var<0>, Var<1>>::eval(0b01)));
+    ASSERT_TRUE((Or<Var<0>, Var<1>>::eval(0b01)));
+    ASSERT_TRUE((Not<Var<1>>::eval(0b01)));
+    ASSERT_FALSE((Implies<Var<0>, Var<1>>::eval(0b01)));
+    ASSERT_FALSE((Equiv<Var<0>, Var<1>>::eval(0b01)));
+    // 真值的特化同样提供 eval, 与 ::type 一致
+    ASSERT_TRUE((And<TrueType, TrueType>::eval(0)));
+    ASSERT_FALSE((Implies<TrueType, FalseType>::eval(0)));
+    ASSERT_TRUE((Or<FalseType, TrueType>::eval(0)));
+}
+
+// 0 元公式, 用于逐个赋值比较 eval 与 ::type
+template <std::uint32_t Bits> struct SyllogismAgreesAt {
+    using Typed = Syllogism<detail::VarValue<Bits, 0>, detail::VarValue<Bits, 1>,
+                            detail::VarValue<Bits, 2>>;
+    static constexpr bool value =
+        Syllogism<Var<0>, Var<1>, Var<2>>::eval(Bits) ==
+        std::is_same_v<typename Typed::type, TrueType>;
+};
+
+// 16 个变量, 只有前两个参与: (A0 ∧ A1) → A0
+template <typename A0, typename A1, typename... Vs>
+struct ConjunctionElim : Implies<And<A0, A1>, A0> {};
+
+TEST_F(LogicTest, IsTautologyUsesEval) {
+    ASSERT_TRUE((SyllogismAgreesAt<0>::value && SyllogismAgreesAt<1>::value &&
+                 SyllogismAgreesAt<2>::value && SyllogismAgreesAt<3>::value &&
+                 SyllogismAgreesAt<4>::value && SyllogismAgreesAt<5>::value &&
+                 SyllogismAgreesAt<6>::value && SyllogismAgreesAt<7>::value));
+    ASSERT_TRUE((detail::HasEval<Syllogism<Var<0>, Var<1>, Var<2>>>::value));
+    ASSERT_TRUE((is_tautology_v<ConjunctionElim, 16>));
+    // eval 路径给出的反例与逐个实例化的路径相同
+    ASSERT_EQ((IsTautology<Implies, 2>::first_falsifying),
+              (IsTautology<Converse, 2>::first_falsifying));
+    ASSERT_TRUE((std::is_same_v<IsTautology<Implies, 2>::counterexample,
+                                Assignment<TrueType, FalseType>>));
+}
+
+// 原有写法的公式: 内部读取联结词的 ::type。以 Var<i> 实例化时这些 ::type 是 Unknown,
+// 不能走 eval 路径
+template <typename A> using NestedExcludedMiddle = Or<A, typename Not<A>::type>;
+template <typename A> using NotAImpliesFalse = Implies<typename Not<A>::type, FalseType>;
+
+TEST_F(LogicTest, NestedTypeFormulasAreEnumerated) {
+    ASSERT_TRUE((std::is_same_v<Not<Var<0>>::type, detail::Unknown>));
+    ASSERT_TRUE((std::is_same_v<Implies<Var<0>, FalseType>::type, detail::Unknown>));
+    ASSERT_TRUE((std::is_same_v<Implies<TrueType, Var<0>>::type, Var<0>>));
+    ASSERT_FALSE((detail::is_eval_tree_v<NestedExcludedMiddle<Var<0>>>));
+    ASSERT_TRUE((detail::is_eval_tree_v<Syllogism<Var<0>, Var<1>, Var<2>>>));
+
+    ASSERT_TRUE((is_tautology_v<NestedExcludedMiddle, 1>));
+    // ¬A → False 即 A, 在 A = False 时为假
+    ASSERT_FALSE((is_tautology_v<NotAImpliesFalse, 1>));
+    ASSERT_TRUE((std::is_same_v<IsTautology<NotAImpliesFalse, 1>::counterexample,
+                                Assignment<FalseType>>));
+}
+
+TEST_F(LogicTest, SymbolicFallsBackToDecisionTree) {
+    // 决策树与原公式逐个赋值一致, 常量分支被合并
+    ASSERT_TRUE((std::is_same_v<detail::Symbolic<NestedExcludedMiddle, std::index_sequence<0>>::type,
+                                TrueType>));
+    ASSERT_TRUE((std::is_same_v<detail::Symbolic<NotAImpliesFalse, std::index_sequence<0>>::type,
+                                Var<0>>));
+    using ConverseTree = detail::Symbolic<Converse, std::index_sequence<0, 1>>::type;
+    for (std::uint32_t bits = 0; bits < 4; ++bits) {
+        ASSERT_EQ(ConverseTree::eval(bits), (bits & 1u) == 0 || (bits & 2u) != 0) << bits;
+    }
+    // 能直接用 Var 实例化的公式保持原样
+    ASSERT_TRUE((std::is_same_v<detail::Symbolic<Syllogism, std::index_sequence<0, 1, 2>>::type,
+                                Syllogism<Var<0>, Var<1>, Var<2>>>));
 }
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include "../constructive_logic.h"
+#include "../static_logic.h"
+
+// Test Fixture for move-aware combinators
+class MoveAwareTest : public ::testing::Test {
+protected:
+    void SetUp() override { copies = 0; }
+
+    // 统计复制次数的前提
+    struct Premise {
+        Premise() = default;
+        Premise(const Premise &) { ++copies; }
+        Premise(Premise &&) noexcept = default;
+        Premise &operator=(const Premise &) { ++copies; return *this; }
+        Premise &operator=(Premise &&) noexcept = default;
+    };
+
+    static int copies;
+};
+
+int MoveAwareTest::copies = 0;
+
+TEST_F(MoveAwareTest, AndIntroRvaluePathDoesNotCopy) {
+    And<Premise, Premise> both = static_proof::and_intro<Premise, Premise>()(Premise{})(Premise{});
+    (void)both;
+    ASSERT_EQ(copies, 0);
+
+    // 左值调用可以重复使用, 每次复制捕获的前提一次
+    auto partial = static_proof::and_intro<Premise, Premise>()(Premise{});
+    partial(Premise{});
+    partial(Premise{});
+    ASSERT_EQ(copies, 2);
+}
+
+TEST_F(MoveAwareTest, OrElimRvaluePathDoesNotCopy) {
+    auto ac = [](Premise p) { return p; };
+    auto bc = [](int) { return Premise{}; };
+    Premise result = static_proof::or_elim<Premise, int, Premise>()(
+        Or<Premise, int>{std::in_place_index<0>, Premise{}})(ac)(bc);
+    (void)result;
+    ASSERT_EQ(copies, 0);
+}
+
+TEST_F(MoveAwareTest, SyllogismMovesIntermediateResults) {
+    auto make = [](int) { return Premise{}; };
+    auto keep = [](Premise p) { return p; };
+    auto chain = static_proof::syllogism<int, Premise, Premise>(make, keep);
+    auto longer = static_proof::syllogism<int, Premise, Premise>(std::move(chain), keep);
+    Premise p = longer(1);
+    (void)p;
+    ASSERT_EQ(copies, 0);
+}
+
+TEST_F(MoveAwareTest, ExportationImportationPermuteRvaluePaths) {
+    auto use = [](And<Premise, Premise> p) { return std::move(p.a); };
+    Premise exported = static_proof::exportation<Premise, Premise, Premise>(use)(Premise{})(Premise{});
+    auto curried = static_proof::exportation<Premise, Premise, Premise>(use);
+    Premise imported = static_proof::importation<Premise, Premise, Premise>(std::move(curried))(
+        And<Premise, Premise>{Premise{}, Premise{}});
+    auto curried2 = static_proof::exportation<Premise, Premise, Premise>(use);
+    Premise permuted = static_proof::permute<Premise, Premise, Premise>(std::move(curried2))(Premise{})(Premise{});
+    (void)exported;
+    (void)imported;
+    (void)permuted;
+    ASSERT_EQ(copies, 0);
+}
+
+TEST_F(MoveAwareTest, StdFunctionPathMovesPremisesIntoClosures) {
+    // std::function 的闭包可以被多次调用, 因此调用时仍需复制捕获的前提;
+    // 但构造证明的过程中前提只会被移动
+    auto and_i = and_intro<Premise, Premise>();
+    Implies<Premise, And<Premise, Premise>> partial = and_i(Premise{});
+    ASSERT_EQ(copies, 0);
+    partial(Premise{});
+    ASSERT_EQ(copies, 1);
+
+    Implies<And<Premise, Premise>, Premise> first = and_elim_left<Premise, Premise>();
+    copies = 0;
+    Premise p = importation<Premise, Premise, Premise>(exportation<Premise, Premise, Premise>(first))(
+        And<Premise, Premise>{Premise{}, Premise{}});
+    (void)p;
+    ASSERT_EQ(copies, 1);
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "../nary_logic.h"
+
+#include <string>
+#include <type_traits>
+
+// Test Fixture for flat n-ary And / Or
+class NaryLogicTest : public ::testing::Test {};
+
+TEST_F(NaryLogicTest, EmptyMembersTakeNoSpace) {
+    static_assert(std::is_empty_v<AndN<True, True, False>>);
+    static_assert(sizeof(AndN<True, int, True, True>) == sizeof(int));
+    static_assert(sizeof(AndN<True, int, True, True>) < sizeof(NestedAnd<True, int, True, True>));
+
+    // 无捕获 lambda 走空基类优化
+    auto refute = [](int) { return False{}; };
+    static_assert(sizeof(AndN<decltype(refute), double>) == sizeof(double));
+    // 嵌套的 AndN 仍然可以逐层投影
+    using Inner = AndN<True, int>;
+    AndN<True, Inner> outer(True{}, Inner(True{}, 4));
+    ASSERT_EQ(get<1>(get<1>(outer)), 4);
+}
+
+TEST_F(NaryLogicTest, ProjectionAndStructuredBindings) {
+    auto intro = static_proof::and_intro_n<int, std::string, True, char>();
+    AndN<int, std::string, True, char> premises = intro(1, "two", True{}, '4');
+    auto second = static_proof::and_elim_n<1, int, std::string, True, char>();
+    ASSERT_EQ(second(premises), "two");
+    get<0>(premises) = 10;
+    auto &[a, b, t, d] = premises;
+    (void)t;
+    ASSERT_EQ(a, 10);
+    ASSERT_EQ(b, "two");
+    ASSERT_EQ(d, '4');
+
+    constexpr AndN<int, True, int> sum(1, True{}, 2);
+    static_assert(get<0>(sum) + get<2>(sum) == 3);
+}
+
+TEST_F(NaryLogicTest, InterchangesWithNestedAnd) {
+    using Nested = NestedAnd<int, True, char>;
+    static_assert(std::is_same_v<Nested, And<int, And<True, char>>>);
+    Nested nested{1, {True{}, 'c'}};
+    auto flat = static_proof::flatten_and<int, True, char>()(nested);
+    ASSERT_EQ(get<0>(flat), 1);
+    ASSERT_EQ(get<2>(flat), 'c');
+
+    Nested back = static_proof::nest_and<int, True, char>()(flat);
+    ASSERT_EQ(back.a, 1);
+    ASSERT_EQ(back.b.b, 'c');
+}
+
+TEST_F(NaryLogicTest, InjectionAndCaseAnalysis) {
+    // 重复的析取支按位置区分
+    using Premise = OrN<int, int, std::string>;
+    auto elim = static_proof::or_elim_n<int, int, int, std::string>();
+    auto first = [](int x) { return x; };
+    auto second = [](int x) { return -x; };
+    auto third = [](const std::string &s) { return static_cast<int>(s.size()); };
+
+    Premise p0 = static_proof::or_intro_n<0, int, int, std::string>()(5);
+    Premise p1 = static_proof::or_intro_n<1, int, int, std::string>()(5);
+    Premise p2 = static_proof::or_intro_n<2, int, int, std::string>()("abc");
+    ASSERT_EQ(elim(p0)(first, second, third), 5);
+    ASSERT_EQ(elim(p1)(first, second, third), -5);
+    ASSERT_EQ(elim(p2)(first, second, third), 3);
+}
+
+TEST_F(NaryLogicTest, InterchangesWithNestedOr) {
+    // 二元情形与 Or 是同一个类型
+    static_assert(std::is_same_v<OrN<int, char>, Or<int, char>>);
+    using Nested = NestedOr<int, char, bool>;
+    static_assert(std::is_same_v<Nested, Or<int, Or<char, bool>>>);
+
+    Nested nested{std::in_place_index<1>, Or<char, bool>{std::in_place_index<1>, true}};
+    OrN<int, char, bool> flat = static_proof::flatten_or<int, char, bool>()(nested);
+    ASSERT_EQ(flat.index(), 2u);
+    ASSERT_TRUE(std::get<2>(flat));
+
+    Nested back = static_proof::nest_or<int, char, bool>()(flat);
+    ASSERT_EQ(back.index(), 1u);
+    ASSERT_EQ(std::get<1>(back).index(), 1u);
+
+    OrN<int, char, bool> left{std::in_place_index<0>, 7};
+    ASSERT_EQ(std::get<0>(static_proof::nest_or<int, char, bool>()(left)), 7);
+}
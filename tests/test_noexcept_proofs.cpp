@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include "../classical_logic.h"
+#include "../constructive_logic.h"
+#include "../static_logic.h"
+
+#include <type_traits>
+
+// 本文件编入 noexcept_tests, 以 -fno-exceptions (CPP_PROP_NO_EXCEPTIONS) 编译
+
+// Test Fixture for the exception-free proof mode
+class NoexceptProofTest : public ::testing::Test {
+protected:
+    // 不做类型擦除的策略, 以便检查组合子构造的闭包本身的 noexcept
+    struct ClosurePolicy {
+        template <typename A, typename B> using implies = std::function<B(A)>;
+        template <typename A, typename F> static F bind(F f) { return f; }
+    };
+};
+
+TEST_F(NoexceptProofTest, FalseIsUninhabited) {
+    static_assert(!std::is_default_constructible_v<False>);
+    static_assert(!std::is_constructible_v<False, int>);
+    // 复制一个不存在的值是空洞成立的, 证明可以原样传递 False
+    static_assert(std::is_nothrow_copy_constructible_v<False>);
+    static_assert(std::is_same_v<decltype(proof_unreachable()), void>);
+}
+
+TEST_F(NoexceptProofTest, CombinatorClosuresAreNoexcept) {
+    auto explode = principle_of_explosion<int, ClosurePolicy>();
+    static_assert(std::is_nothrow_invocable_r_v<int, decltype(explode), False>);
+    auto pair = and_intro<int, int, ClosurePolicy>();
+    static_assert(std::is_nothrow_invocable_v<decltype(pair), int>);
+    static_assert(std::is_nothrow_invocable_v<decltype(pair(1)), int>);
+    ASSERT_EQ(pair(1)(2).b, 2);
+
+    auto elim = or_elim<int, bool, int, ClosurePolicy>();
+    Implies<int, int> id = [](int x) { return x; };
+    Implies<bool, int> one = [](bool) { return 1; };
+    ASSERT_EQ(elim(Or<int, bool>{std::in_place_index<1>, true})(id)(one), 1);
+}
+
+TEST_F(NoexceptProofTest, StaticProofChainsAreNoexcept) {
+    auto inc = [](int x) noexcept { return x + 1; };
+    auto chain = static_proof::syllogism<int, int, int>(
+        static_proof::syllogism<int, int, int>(inc, inc), inc);
+    static_assert(std::is_nothrow_invocable_v<decltype(chain), int>);
+    static_assert(std::is_nothrow_invocable_r_v<
+                  int, decltype(static_proof::principle_of_explosion<int>()), False>);
+    ASSERT_EQ(chain(0), 3);
+}
+
+TEST_F(NoexceptProofTest, ClassicalTransformersChain) {
+    // A ∨ ¬A 的左侧: A 被构造出来, ¬A 的证明从不需要
+    Or<int, Not<int>> lem{std::in_place_index<0>, 42};
+    auto nna = [](Not<int> na) noexcept -> False { return na(0); };
+
+    // LEM → DNE → Peirce → DNE, 全部是具体的 noexcept 闭包
+    auto dne = static_proof::prove_dne_from_lem<int>(lem);
+    static_assert(std::is_nothrow_invocable_r_v<int, decltype(dne), decltype(nna)>);
+    ASSERT_EQ(dne(nna), 42);
+
+    auto peirce = static_proof::prove_peirce_from_dne<int, False>(dne);
+    auto f = [](auto) noexcept { return 7; };
+    ASSERT_EQ(peirce(f), 42);
+
+    auto dne_again = static_proof::prove_dne_from_peirce<int>(peirce);
+    ASSERT_EQ(dne_again(nna), 42);
+
+    // std::function 版本在这种模式下同样可用
+    ASSERT_EQ(prove_dne_from_lem<int>(lem)(nna), 42);
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include "../parallel_truth_table.h"
+
+using namespace cpp_prop;
+using runtime::Formula;
+
+// Test Fixture for the multi-threaded truth-table checker
+class ParallelTruthTableTest : public ::testing::Test {};
+
+namespace {
+
+Formula v(unsigned i) { return Formula::var(i); }
+
+// x0 ∧ ... ∧ x[n-1] → x[n-1]
+Formula conjunction_implies_last(unsigned n) {
+    Formula conj = v(0);
+    for (unsigned i = 1; i < n; ++i) {
+        conj = runtime::And(std::move(conj), v(i));
+    }
+    return runtime::Implies(std::move(conj), v(n - 1));
+}
+
+} // namespace
+
+TEST_F(ParallelTruthTableTest, TautologyVisitsEveryBlock) {
+    runtime::ParallelOptions options;
+    options.threads = 4;
+    options.chunk_blocks = 8;
+    runtime::ParallelStats stats;
+    runtime::TautologyResult result =
+        runtime::check_tautology_parallel(conjunction_implies_last(20), 20, options, &stats);
+    ASSERT_TRUE(result.tautology);
+    ASSERT_EQ(stats.threads, 4u);
+    ASSERT_EQ(stats.blocks_evaluated, std::size_t{1} << (20 - 9));
+}
+
+TEST_F(ParallelTruthTableTest, UnevenThreadCountSteals) {
+    // 3 个线程, 每次只取一个 Block: 先做完的线程必须去偷
+    runtime::ParallelOptions options;
+    options.threads = 3;
+    options.chunk_blocks = 1;
+    runtime::ParallelStats stats;
+    ASSERT_TRUE(runtime::check_tautology_parallel(conjunction_implies_last(18), 18, options, &stats)
+                    .tautology);
+    ASSERT_EQ(stats.blocks_evaluated, std::size_t{1} << (18 - 9));
+}
+
+TEST_F(ParallelTruthTableTest, CounterexampleCancelsWorkers) {
+    runtime::ParallelOptions options;
+    options.threads = 4;
+    runtime::ParallelStats stats;
+    // x0 ∨ x23 在赋值 0 处为假, 第一个线程的第一块就能找到
+    Formula f = runtime::Or(v(0), v(23));
+    runtime::TautologyResult result = runtime::check_tautology_parallel(f, 24, options, &stats);
+    ASSERT_FALSE(result.tautology);
+    ASSERT_FALSE(f.eval(result.counterexample));
+    ASSERT_LT(stats.blocks_evaluated, std::size_t{1} << (24 - 9));
+}
+
+TEST_F(ParallelTruthTableTest, SmallFormulasUseOneThread) {
+    runtime::ParallelStats stats;
+    runtime::TautologyResult result =
+        runtime::check_tautology_parallel(runtime::Implies(v(0), v(1)), 2, {}, &stats);
+    ASSERT_FALSE(result.tautology);
+    ASSERT_EQ(result.counterexample, 1u);
+    ASSERT_EQ(stats.threads, 1u);
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include "../peano.h"
+
+#include <type_traits>
+
+// Test Fixture for type-level natural numbers
+class PeanoTest : public ::testing::Test {};
+
+namespace {
+
+template <std::uint64_t K> using B = typename MakeBin<K>::type;
+
+} // namespace
+
+TEST_F(PeanoTest, BinaryLiteralsAreCanonical) {
+    ASSERT_TRUE((std::is_same_v<B<0>, BinNil>));
+    ASSERT_TRUE((std::is_same_v<B<6>, Bin<B0, Bin<B1, Bin<B1, BinNil>>>>));
+    ASSERT_EQ(bin_value_v<B<0>>, 0u);
+    ASSERT_EQ(bin_value_v<B<1000003>>, 1000003u);
+    ASSERT_EQ((bin_value_v<typename BinAdd<B<0>, B<0>>::type>), 0u);
+    ASSERT_TRUE((std::is_same_v<typename BinMultiply<B<0>, B<12345>>::type, BinNil>));
+    ASSERT_TRUE((std::is_same_v<typename BinMultiply<B<12345>, B<0>>::type, BinNil>));
+}
+
+TEST_F(PeanoTest, BinaryArithmeticMatchesNative) {
+    ASSERT_TRUE((std::is_same_v<typename BinAdd<B<255>, B<1>>::type, B<256>>));
+    ASSERT_TRUE((std::is_same_v<typename BinAdd<B<1>, B<255>>::type, B<256>>));
+    ASSERT_TRUE((std::is_same_v<typename BinAdd<B<3999999>, B<6000001>>::type, B<10000000>>));
+    ASSERT_TRUE((std::is_same_v<typename BinMultiply<B<4096>, B<4096>>::type, B<16777216>>));
+    ASSERT_TRUE((std::is_same_v<typename BinMultiply<B<2718281>, B<3141592>>::type,
+                                B<2718281ull * 3141592ull>>));
+    // (a * b) * c = a * (b * c), a * (b + c) = a * b + a * c
+    using A = B<1000003>;
+    using C = B<999983>;
+    using D = B<65537>;
+    ASSERT_TRUE((std::is_same_v<typename BinMultiply<typename BinMultiply<A, C>::type, D>::type,
+                                typename BinMultiply<A, typename BinMultiply<C, D>::type>::type>));
+    ASSERT_TRUE((std::is_same_v<
+                 typename BinMultiply<A, typename BinAdd<C, D>::type>::type,
+                 typename BinAdd<typename BinMultiply<A, C>::type,
+                                 typename BinMultiply<A, D>::type>::type>));
+}
+
+TEST_F(PeanoTest, BinaryComparison) {
+    ASSERT_EQ((BinCompare<B<5>, B<5>>::value), 0);
+    ASSERT_EQ((BinCompare<B<4>, B<5>>::value), -1);
+    ASSERT_EQ((BinCompare<B<6>, B<5>>::value), 1);
+    ASSERT_EQ((BinCompare<B<0>, B<1>>::value), -1);
+    ASSERT_TRUE((bin_less_v<B<1048575>, B<1048576>>));
+    ASSERT_FALSE((bin_less_v<B<1048576>, B<1048575>>));
+    ASSERT_TRUE((bin_less_v<B<2000000>, B<2000001>>));
+    ASSERT_TRUE((bin_equal_v<typename BinAdd<B<7>, B<9>>::type, B<16>>));
+}
+
+TEST_F(PeanoTest, ConversionToAndFromUnary) {
+    using Two = Succ<Succ<Zero>>;
+    using Three = Succ<Two>;
+    ASSERT_TRUE((std::is_same_v<typename ToUnary<B<0>>::type, Zero>));
+    ASSERT_TRUE((std::is_same_v<typename ToUnary<B<3>>::type, Three>));
+    ASSERT_TRUE((std::is_same_v<typename FromUnary<Three>::type, B<3>>));
+    ASSERT_TRUE((std::is_same_v<typename FromUnary<typename Multiply<Three, Two>::type>::type,
+                                B<6>>));
+
+    // 往返: 一元的 1000 会使 Add 递归 1000 层, 二进制这边不需要
+    using Big = typename ToUnary<B<1000>>::type;
+    ASSERT_TRUE((std::is_same_v<typename FromUnary<Big>::type, B<1000>>));
+    ASSERT_TRUE((std::is_same_v<typename ToUnary<typename BinAdd<B<1000>, B<3>>::type>::type,
+                                typename Add<Three, Big>::type>));
+}
+
+namespace {
+
+// 只在 (3, 5) 处不成立
+template <typename N, typename M>
+struct FailsAtThreeFive
+    : std::bool_constant<!std::is_same_v<N, Nat<3>> || !std::is_same_v<M, Nat<5>>> {};
+
+template <typename N, typename M>
+struct AddZeroIsIdentity : std::is_same<typename Add<N, Zero>::type, N> {};
+
+} // namespace
+
+TEST_F(PeanoTest, CheckForAllCoversTheWholeRange) {
+    ASSERT_TRUE((std::is_same_v<Nat<0>, Zero>));
+    ASSERT_TRUE((std::is_same_v<Nat<2>, Succ<Succ<Zero>>>));
+    ASSERT_TRUE((CheckForAll<20, 1, AddZeroIsIdentity>::value));
+    ASSERT_TRUE((CheckForAll<20, 20, AddCommutes>::value));
+    ASSERT_TRUE((CheckForAll<12, 12, MultiplyCommutes>::value));
+    ASSERT_TRUE((CheckForAll<12, 12, MultiplyDistributes>::value));
+    ASSERT_TRUE((CheckForAll<12, 12, BinaryAgreesWithUnary>::value));
+    ASSERT_TRUE((CheckForAll<0, 5, AddCommutes>::value));
+
+    using Failing = CheckForAll<8, 8, FailsAtThreeFive>;
+    ASSERT_FALSE(Failing::value);
+    ASSERT_EQ(Failing::counterexample_n, 3u);
+    ASSERT_EQ(Failing::counterexample_m, 5u);
+}
+
+TEST_F(PeanoTest, ValueReflection) {
+    ASSERT_EQ(to_value<Zero>, 0u);
+    ASSERT_EQ((to_value<Succ<Succ<Succ<Zero>>>>), 3u);
+    ASSERT_EQ(to_value<Nat<1000>>, 1000u);
+    ASSERT_EQ(to_value<B<123456789>>, 123456789u);
+    ASSERT_TRUE((std::is_same_v<typename FromValue<0>::type, Zero>));
+    ASSERT_TRUE((std::is_same_v<typename FromValue<4>::type, Succ<Succ<Succ<Succ<Zero>>>>>));
+    ASSERT_EQ(to_value<typename FromValue<4099>::type>, 4099u);
+    ASSERT_EQ((to_value<typename Multiply<Nat<9>, Nat<13>>::type>), 117u);
+}
+
+TEST_F(PeanoTest, ArithmeticTableMatchesNative) {
+    using Table = ArithmeticTable<14>;
+    ASSERT_TRUE(Table::matches_native);
+    ASSERT_EQ(Table::sum(13, 9), 22u);
+    ASSERT_EQ(Table::product(13, 9), 117u);
+    // 运行时下标同样可用
+    for (std::size_t n = 0; n < 14; ++n) {
+        ASSERT_EQ(Table::product(n, n), n * n);
+    }
+}
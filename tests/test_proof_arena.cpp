@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include "../constructive_logic.h"
+#include "../proof_arena.h"
+#include "allocation_counter.h"
+
+#include <memory>
+
+// Test Fixture for arena-allocated proof closures
+class ProofArenaTest : public ::testing::Test {};
+
+namespace {
+
+using P = Or<True, And<True, True>>;
+using Q = And<Or<True, False>, True>;
+
+False check_de_morgan(ProofArena &arena) {
+    ProofArena::Scope scope(arena);
+    ArenaImplies<Or<P, Q>, False> not_or = [](Or<P, Q>) { return False{}; };
+    auto dm1 = de_morgan_1<P, Q, ArenaPolicy>()(not_or);
+    auto dm2 = de_morgan_2<P, Q, ArenaPolicy>();
+    And<NotWith<P, ArenaPolicy>, NotWith<Q, ArenaPolicy>> premise{dm1.a, dm1.b};
+    return dm2(premise)(Or<P, Q>{std::in_place_index<1>, Q{}});
+}
+
+} // namespace
+
+TEST_F(ProofArenaTest, ResetReusesBlocksWithoutHeapAllocation) {
+    ProofArena arena(4096);
+    check_de_morgan(arena);
+    const std::size_t first_batch = arena.stats().bytes_in_use;
+    ASSERT_GT(first_batch, 0u);
+    ASSERT_EQ(arena.high_water_mark(), first_batch);
+    arena.reset();
+    ASSERT_EQ(arena.stats().bytes_in_use, 0u);
+
+    allocation_counter::Scope scope;
+    for (int i = 0; i < 100; ++i) {
+        check_de_morgan(arena);
+        arena.reset();
+    }
+    ASSERT_EQ(scope.allocations(), 0u);
+    ASSERT_EQ(arena.high_water_mark(), first_batch);
+    ASSERT_EQ(arena.stats().blocks, 1u);
+}
+
+TEST_F(ProofArenaTest, HighWaterMarkSpansBatchesAndBlocks) {
+    ProofArena arena(128);
+    {
+        ProofArena::Scope scope(arena);
+        for (int i = 0; i < 64; ++i) {
+            ArenaImplies<int, int> f = [i](int x) { return x + i; };
+            ASSERT_EQ(f(1), i + 1);
+        }
+    }
+    const std::size_t peak = arena.high_water_mark();
+    ASSERT_GT(arena.stats().blocks, 1u);
+    arena.reset();
+    arena.reset_stats();
+    ASSERT_EQ(arena.high_water_mark(), 0u);
+    ASSERT_GT(peak, 0u);
+}
+
+TEST_F(ProofArenaTest, ResetRunsNonTrivialDestructors) {
+    auto shared = std::make_shared<int>(1);
+    ProofArena arena;
+    {
+        ProofArena::Scope scope(arena);
+        ArenaImplies<int, int> f = [shared](int x) { return x + *shared; };
+        ArenaImplies<int, int> copy = f;
+        ASSERT_EQ(copy(1), 2);
+    }
+    ASSERT_EQ(shared.use_count(), 2);
+    arena.reset();
+    ASSERT_EQ(shared.use_count(), 1);
+}
+
+TEST_F(ProofArenaTest, RequiresActiveScope) {
+    ASSERT_THROW((ArenaImplies<int, int>([](int x) { return x; })), std::logic_error);
+}
@@ -0,0 +1,245 @@
+#include <gtest/gtest.h>
+#include "../formula_io.h"
+#include "../proof_certificate.h"
+#include "../truth_table.h"
+
+#include <array>
+#include <cstdio>
+#include <fstream>
+
+using namespace cpp_prop;
+using runtime::CertificateBuilder;
+using runtime::NodeId;
+using runtime::Opcode;
+using runtime::ProofRule;
+
+// Test Fixture for proof certificates
+class ProofCertificateTest : public ::testing::Test {};
+
+namespace {
+
+// prove_syllogism: ((A → B) ∧ (B → C)) → (A → C)
+CertificateBuilder::Step syllogism(CertificateBuilder &proof) {
+    runtime::FormulaStore &f = proof.formulas();
+    NodeId a = f.var(0), b = f.var(1), c = f.var(2);
+    auto premises = proof.hypothesis(f.And(f.Implies(a, b), f.Implies(b, c)));
+    auto hyp_a = proof.hypothesis(a);
+    auto proof_b = proof.modus_ponens(hyp_a, proof.and_elim_left(premises));
+    auto proof_c = proof.modus_ponens(proof_b, proof.and_elim_right(premises));
+    return proof.implies_intro(premises, proof.implies_intro(hyp_a, proof_c));
+}
+
+// de_morgan_2: (¬A ∧ ¬B) → ¬(A ∨ B), 经由 or_elim
+CertificateBuilder::Step de_morgan_2(CertificateBuilder &proof) {
+    runtime::FormulaStore &f = proof.formulas();
+    NodeId a = f.var(0), b = f.var(1);
+    auto premises = proof.hypothesis(f.And(f.Not(a), f.Not(b)));
+    auto or_ab = proof.hypothesis(f.Or(a, b));
+    auto contradiction =
+        proof.or_elim(or_ab, proof.and_elim_left(premises), proof.and_elim_right(premises));
+    return proof.implies_intro(premises, proof.not_intro(or_ab, contradiction));
+}
+
+template <std::size_t N> using Words = std::array<std::uint32_t, N>;
+
+constexpr std::uint32_t op(Opcode o) { return static_cast<std::uint32_t>(o); }
+constexpr std::uint32_t rule(ProofRule r) { return static_cast<std::uint32_t>(r); }
+
+// 按证书格式直接拼出字节, 用于构造 CertificateBuilder 拒绝写出的证书
+std::string raw_certificate(const std::vector<Words<3>> &nodes,
+                            const std::vector<Words<5>> &steps, std::uint32_t root) {
+    std::string out(runtime::kCertificateMagic, 4);
+    runtime::detail::append_word(out, runtime::kCertificateVersion);
+    runtime::detail::append_word(out, static_cast<std::uint32_t>(nodes.size()));
+    runtime::detail::append_word(out, static_cast<std::uint32_t>(steps.size()));
+    runtime::detail::append_word(out, root);
+    for (const Words<3> &node : nodes) {
+        for (std::uint32_t w : node) {
+            runtime::detail::append_word(out, w);
+        }
+    }
+    for (const Words<5> &step : steps) {
+        for (std::uint32_t w : step) {
+            runtime::detail::append_word(out, w);
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+TEST_F(ProofCertificateTest, VerifiesLibraryTheorems) {
+    CertificateBuilder proof;
+    std::string bytes = proof.serialize(syllogism(proof));
+    runtime::CertificateCheck check = runtime::verify_certificate(bytes);
+    ASSERT_TRUE(check.valid) << check.error;
+    ASSERT_EQ(runtime::truth_table(check.theorem_formula(), 3),
+              (runtime::truth_table(runtime::lower<Syllogism, 3>(), 3)));
+
+    CertificateBuilder de_morgan;
+    check = runtime::verify_certificate(de_morgan.serialize(de_morgan_2(de_morgan)));
+    ASSERT_TRUE(check.valid) << check.error;
+    ASSERT_TRUE(runtime::check_tautology(check.theorem_formula()).tautology);
+
+    // A → (B → (A ∧ B)), 以及 False → A 与 A ↔ A
+    CertificateBuilder more;
+    runtime::FormulaStore &f = more.formulas();
+    auto a = more.hypothesis(f.var(0));
+    auto b = more.hypothesis(f.var(1));
+    auto and_intro = more.implies_intro(a, more.implies_intro(b, more.and_intro(a, b)));
+    ASSERT_TRUE(runtime::verify_certificate(more.serialize(and_intro)).valid);
+    auto bottom = more.hypothesis(f.constant(false));
+    auto explosion = more.implies_intro(bottom, more.principle_of_explosion(bottom, f.var(0)));
+    ASSERT_TRUE(runtime::verify_certificate(more.serialize(explosion)).valid);
+    auto a2 = more.hypothesis(f.var(0));
+    auto identity = more.implies_intro(a2, a2);
+    auto equiv = more.equiv_intro(identity, identity);
+    ASSERT_TRUE(runtime::verify_certificate(more.serialize(equiv)).valid);
+    ASSERT_TRUE(runtime::verify_certificate(more.serialize(more.equiv_elim_right(equiv))).valid);
+}
+
+TEST_F(ProofCertificateTest, RejectsUndischargedHypotheses) {
+    // CertificateBuilder 不会写出这样的证书, 这里直接拼出字节
+    const std::uint32_t hyp = rule(ProofRule::Hypothesis);
+    const std::uint32_t intro = rule(ProofRule::ImpliesIntro);
+    const std::uint32_t elim = rule(ProofRule::ImpliesElim);
+    const std::uint32_t conj = rule(ProofRule::AndIntro);
+    const std::uint32_t var = op(Opcode::Var);
+    const std::uint32_t implies = op(Opcode::Implies);
+    const std::uint32_t and_ = op(Opcode::And);
+
+    // 节点: A, B, A → B, (A → B) → B, A → ((A → B) → B)
+    std::vector<Words<3>> mp_nodes = {
+        {var, 0, 0}, {var, 1, 0}, {implies, 0, 1}, {implies, 2, 1}, {implies, 0, 3}};
+    // 只消去了 A → B, A 仍是未消去的假设
+    std::vector<Words<5>> mp_steps = {
+        {hyp, 0, 0, 0, 0}, {hyp, 2, 0, 0, 0}, {elim, 1, 0, 1, 0}, {intro, 3, 1, 2, 0}};
+    runtime::CertificateCheck check =
+        runtime::verify_certificate(raw_certificate(mp_nodes, mp_steps, 3));
+    ASSERT_FALSE(check.valid);
+    ASSERT_EQ(check.error, "root depends on undischarged hypotheses");
+    mp_steps.push_back({intro, 4, 0, 3, 0});
+    ASSERT_TRUE(runtime::verify_certificate(raw_certificate(mp_nodes, mp_steps, 4)).valid);
+
+    // 节点: A, A → A, (A → A) ∧ A, (A → A) ∧ (A → A)
+    std::vector<Words<3>> id_nodes = {{var, 0, 0}, {implies, 0, 0}, {and_, 1, 0}, {and_, 1, 1}};
+    // 同一个假设既在 implies_intro 内又在其外被使用
+    std::vector<Words<5>> outside = {{hyp, 0, 0, 0, 0}, {intro, 1, 0, 0, 0}, {conj, 2, 1, 0, 0}};
+    ASSERT_FALSE(runtime::verify_certificate(raw_certificate(id_nodes, outside, 2)).valid);
+    // 被两个不同的 implies_intro 消去
+    std::vector<Words<5>> twice = {
+        {hyp, 0, 0, 0, 0}, {intro, 1, 0, 0, 0}, {intro, 1, 0, 0, 0}, {conj, 3, 1, 2, 0}};
+    ASSERT_EQ(runtime::verify_certificate(raw_certificate(id_nodes, twice, 3)).error,
+              "hypothesis 0 is discharged twice");
+    // 共享同一个 implies_intro 没有问题
+    std::vector<Words<5>> shared = {{hyp, 0, 0, 0, 0}, {intro, 1, 0, 0, 0}, {conj, 3, 1, 1, 0}};
+    ASSERT_TRUE(runtime::verify_certificate(raw_certificate(id_nodes, shared, 2)).valid);
+}
+
+TEST_F(ProofCertificateTest, BuilderRejectsDoubleDischarge) {
+    CertificateBuilder proof;
+    runtime::FormulaStore &f = proof.formulas();
+    auto a = proof.hypothesis(f.var(0));
+    auto identity = proof.implies_intro(a, a);
+    ASSERT_THROW(proof.implies_intro(a, a), std::invalid_argument);
+    auto contradiction = proof.hypothesis(f.constant(false));
+    ASSERT_THROW(proof.not_intro(a, contradiction), std::invalid_argument);
+    // 失败的调用不留下步骤, 共享同一个 implies_intro 没有问题
+    ASSERT_EQ(proof.size(), 3u);
+    ASSERT_TRUE(runtime::verify_certificate(
+                    proof.serialize(proof.and_intro(identity, identity)))
+                    .valid);
+}
+
+TEST_F(ProofCertificateTest, BuilderRejectsOpenHypotheses) {
+    CertificateBuilder proof;
+    runtime::FormulaStore &f = proof.formulas();
+    auto a = proof.hypothesis(f.var(0));
+    auto ab = proof.hypothesis(f.Implies(f.var(0), f.var(1)));
+    auto b = proof.modus_ponens(a, ab);
+    // 只消去了 A → B, A 仍是未消去的假设
+    auto open = proof.implies_intro(ab, b);
+    ASSERT_THROW(proof.serialize(open), std::invalid_argument);
+    ASSERT_TRUE(runtime::verify_certificate(proof.serialize(proof.implies_intro(a, open))).valid);
+
+    // 同一个假设既在 implies_intro 内又在其外被使用
+    auto c = proof.hypothesis(f.var(2));
+    auto outside = proof.and_intro(proof.implies_intro(c, c), c);
+    ASSERT_THROW(proof.serialize(outside), std::invalid_argument);
+}
+
+TEST_F(ProofCertificateTest, BuilderRejectsIllFormedSteps) {
+    CertificateBuilder proof;
+    runtime::FormulaStore &f = proof.formulas();
+    auto a = proof.hypothesis(f.var(0));
+    auto b = proof.hypothesis(f.var(1));
+    ASSERT_THROW(proof.modus_ponens(a, b), std::invalid_argument);
+    ASSERT_THROW(proof.and_elim_left(a), std::invalid_argument);
+    ASSERT_THROW(proof.principle_of_explosion(a, f.var(1)), std::invalid_argument);
+    ASSERT_THROW(proof.not_intro(a, b), std::invalid_argument);
+    ASSERT_THROW(proof.equiv_elim_left(a), std::invalid_argument);
+    ASSERT_THROW(proof.implies_intro(proof.and_intro(a, b), a), std::invalid_argument);
+    ASSERT_THROW(proof.serialize(100), std::invalid_argument);
+}
+
+TEST_F(ProofCertificateTest, RejectsTamperedCertificates) {
+    CertificateBuilder proof;
+    std::string bytes = proof.serialize(syllogism(proof));
+    ASSERT_TRUE(runtime::verify_certificate(bytes).valid);
+
+    ASSERT_FALSE(runtime::verify_certificate(bytes.substr(0, bytes.size() - 4)).valid);
+    ASSERT_FALSE(runtime::verify_certificate("CPPX").valid);
+
+    // 逐个翻转每个字的低位, 结果要么被拒绝, 要么仍是一个正确的证明
+    for (std::size_t i = 4; i < bytes.size(); i += 4) {
+        std::string tampered = bytes;
+        tampered[i] ^= 1;
+        runtime::CertificateCheck check = runtime::verify_certificate(tampered);
+        if (check.valid) {
+            ASSERT_TRUE(runtime::check_tautology(check.theorem_formula()).tautology);
+        }
+    }
+
+    // 重复的公式节点
+    std::string duplicate(runtime::kCertificateMagic, 4);
+    for (std::uint32_t word : {runtime::kCertificateVersion, 2u, 1u, 0u,
+                               0u, 0u, 0u, 0u, 0u, 0u,   // x0, x0
+                               0u, 0u, 0u, 0u, 0u}) {     // 假设 x0
+        duplicate.append(reinterpret_cast<const char *>(&word), 4);
+    }
+    ASSERT_EQ(runtime::verify_certificate(duplicate).error, "duplicate formula node 1");
+}
+
+TEST_F(ProofCertificateTest, SharedConclusionsStayLinear) {
+    // x0 → (s40), s0 = x0, s(k+1) = sk ∧ sk: 展开成树有 2^41 个节点
+    CertificateBuilder proof;
+    auto hyp = proof.hypothesis(proof.formulas().var(0));
+    auto step = hyp;
+    for (int i = 0; i < 40; ++i) {
+        step = proof.and_intro(step, step);
+    }
+    std::string bytes = proof.serialize(proof.implies_intro(hyp, step));
+    ASSERT_LT(bytes.size(), 2000u);
+
+    runtime::CertificateCheck check = runtime::verify_certificate(bytes);
+    ASSERT_TRUE(check.valid) << check.error;
+    ASSERT_EQ(check.store.reachable(check.theorem).size(), 42u);
+    ASSERT_EQ(check.store.tree_size(check.theorem), (std::uint64_t{1} << 41) + 1);
+    ASSERT_TRUE(check.store.eval(check.theorem, 0));
+    ASSERT_TRUE(check.store.eval(check.theorem, 1));
+}
+
+TEST_F(ProofCertificateTest, VerifiesMappedFile) {
+    CertificateBuilder proof;
+    std::string bytes = proof.serialize(de_morgan_2(proof));
+    std::string path = ::testing::TempDir() + "proof_certificate_test.cert";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+    runtime::MappedFile file(path);
+    runtime::CertificateCheck check = runtime::verify_certificate(file.bytes());
+    ASSERT_TRUE(check.valid) << check.error;
+    ASSERT_EQ(check.theorem_formula().num_vars(), 2u);
+    std::remove(path.c_str());
+}
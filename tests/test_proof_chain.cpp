@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+#include "../proof_chain.h"
+#include "../inplace_implies.h"
+
+#include <string>
+#include <type_traits>
+
+// Test Fixture for fused implication chains
+class ProofChainTest : public ::testing::Test {};
+
+TEST_F(ProofChainTest, ComposesInOrder) {
+    auto inc = [](int x) { return x + 1; };
+    auto twice = [](int x) { return x * 2; };
+    auto show = [](int x) { return std::to_string(x); };
+    auto chain = static_proof::compose_chain<int>(inc, twice, inc, show);
+    ASSERT_EQ(chain(3), "9");
+    // 无捕获且类型互不相同的步骤不占空间
+    static_assert(std::is_empty_v<decltype(static_proof::compose_chain<int>(inc, twice))>);
+
+    constexpr auto sum = static_proof::compose_chain<int>(inc, inc, twice);
+    static_assert(sum(0) == 4);
+}
+
+TEST_F(ProofChainTest, NormalizesNestedSyllogisms) {
+    auto inc = [](int x) { return x + 1; };
+    auto twice = [](int x) { return x * 2; };
+    auto nested = static_proof::syllogism<int, int, int>(
+        static_proof::syllogism<int, int, int>(inc, twice),
+        static_proof::prove_syllogism_curried<int, int, int>()(inc)(twice));
+    auto flat = static_proof::normalize_chain<int>(nested);
+    using Flat = static_proof::detail::Chain<int, decltype(inc), decltype(twice),
+                                             decltype(inc), decltype(twice)>;
+    static_assert(std::is_same_v<decltype(flat), Flat>);
+    ASSERT_EQ(flat(1), nested(1));
+
+    // 链作为参数时同样展开
+    auto longer = static_proof::compose_chain<int>(flat, inc, flat);
+    static_assert(decltype(longer)::size == 9);
+    ASSERT_EQ(longer(0), 34);
+}
+
+TEST_F(ProofChainTest, ErasedChainIsErasedOnce) {
+    Implies<int, int> inc = [](int x) { return x + 1; };
+    Implies<int, std::string> show = [](int x) { return std::to_string(x); };
+    Implies<int, std::string> chain = compose_chain<int>(inc, inc, show);
+    ASSERT_EQ(chain(0), "2");
+
+    // 已被擦除的 syllogism 结果作为一个整体的步骤
+    Implies<int, int> two = syllogism<int, int, int>(inc, inc);
+    ASSERT_EQ(compose_chain<int>(two, two, show)(1), "5");
+
+    using Inplace = InplacePolicy<64>;
+    auto inplace = compose_chain<int, Inplace>([](int x) { return x + 1; },
+                                               [](int x) { return x * 3; });
+    static_assert(std::is_same_v<decltype(inplace), ImpliesWith<int, int, Inplace>>);
+    ASSERT_EQ(inplace(1), 6);
+}
@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+#include "../formula_io.h"
+#include "../proof_search.h"
+#include "../truth_table.h"
+
+#include <chrono>
+#include <random>
+#include <string>
+
+using namespace cpp_prop;
+using runtime::Formula;
+using runtime::NodeId;
+
+// Test Fixture for intuitionistic proof search
+class ProofSearchTest : public ::testing::Test {};
+
+namespace {
+
+Formula parse(const std::string &text) {
+    runtime::TextFormulaParser parser;
+    Formula f = Formula::constant(true);
+    EXPECT_TRUE(parser.parse(text, f)) << parser.error();
+    return f;
+}
+
+// 可证时证书必须通过独立的校验, 且定理就是输入公式
+bool provable(const std::string &text) {
+    Formula formula = parse(text);
+    runtime::ProofSearchResult result = runtime::prove_intuitionistic(formula);
+    if (result.provable) {
+        runtime::CertificateCheck check = runtime::verify_certificate(result.certificate);
+        EXPECT_TRUE(check.valid) << text << ": " << check.error;
+        runtime::FormulaStore store;
+        EXPECT_EQ(store.intern(check.theorem_formula()), store.intern(formula)) << text;
+    }
+    return result.provable;
+}
+
+// size 个节点的随机公式, 变量取自 x0 .. x5
+Formula random_formula(std::mt19937 &rng, unsigned size) {
+    if (size <= 1) {
+        return Formula::var(rng() % 6);
+    }
+    if (rng() % 4 == 0) {
+        return runtime::Not(random_formula(rng, size - 1));
+    }
+    unsigned left = 1 + rng() % (size > 2 ? size - 2 : 1);
+    Formula a = random_formula(rng, left);
+    Formula b = random_formula(rng, size - 1 - left);
+    switch (rng() % 3) {
+    case 0:
+        return runtime::And(std::move(a), std::move(b));
+    case 1:
+        return runtime::Or(std::move(a), std::move(b));
+    default:
+        return runtime::Implies(std::move(a), std::move(b));
+    }
+}
+
+} // namespace
+
+TEST_F(ProofSearchTest, ProvesConstructiveLibraryTheorems) {
+    ASSERT_TRUE(provable("p -> p"));
+    ASSERT_TRUE(provable("(p -> q) & (q -> r) -> p -> r"));          // prove_syllogism
+    ASSERT_TRUE(provable("(p -> q) -> ~q -> ~p"));                   // contraposition
+    ASSERT_TRUE(provable("(p -> q -> r) -> q -> p -> r"));           // permute
+    ASSERT_TRUE(provable("~(p | q) <-> ~p & ~q"));                   // de_morgan_1 / 2
+    ASSERT_TRUE(provable("(p & q -> r) <-> (p -> q -> r)"));         // exportation / importation
+    ASSERT_TRUE(provable("(p -> q) & (p -> ~q) -> ~p"));             // reductio_ad_absurdum
+    ASSERT_TRUE(provable("p -> ~~p"));                               // double_negation_intro
+    ASSERT_TRUE(provable("false -> p"));                             // principle_of_explosion
+    ASSERT_TRUE(provable("(p | q) & (p -> r) & (q -> r) -> r"));     // or_elim
+    ASSERT_TRUE(provable("~~(p | ~p)"));
+    ASSERT_TRUE(provable("~~~p -> ~p"));
+    ASSERT_TRUE(provable("((p -> q) -> r) -> (q -> r)"));
+    ASSERT_TRUE(provable("(p <-> q) -> (q <-> r) -> (p <-> r)"));
+    ASSERT_TRUE(provable("((p <-> q) -> r) -> (p -> q) -> (q -> p) -> r"));
+    ASSERT_TRUE(provable("(true -> p) -> p"));
+}
+
+TEST_F(ProofSearchTest, RejectsClassicalTautologies) {
+    // 这些都是经典重言式, 但没有构造性证明
+    const char *classical[] = {
+        "p | ~p",                      // 排中律
+        "~~p -> p",                    // 双重否定消去
+        "((p -> q) -> p) -> p",        // 皮尔士定律
+        "(~q -> ~p) -> p -> q",        // 逆否命题的逆
+        "~(p & q) -> ~p | ~q",         // 德摩根律的经典方向
+        "(p -> q) | (q -> p)",
+        "(p -> q) -> ~p | q",
+    };
+    for (const char *text : classical) {
+        ASSERT_TRUE(runtime::check_tautology(parse(text)).tautology) << text;
+        ASSERT_FALSE(provable(text)) << text;
+    }
+    ASSERT_FALSE(provable("p -> q"));
+    ASSERT_FALSE(provable("p & q -> p & r"));
+}
+
+TEST_F(ProofSearchTest, LargeFormulasDecideQuickly) {
+    const unsigned n = 150;
+    // (p0 → p1) ∧ ... ∧ (p{n-1} → pn) → p0 → pn, 顺序打乱
+    std::string chain;
+    for (unsigned i = 0; i < n; ++i) {
+        unsigned k = (i * 7) % n;
+        chain += (i ? " & " : "") + std::string("(p") + std::to_string(k) + " -> p" +
+                 std::to_string(k + 1) + ")";
+    }
+    // ¬¬(p0 ∨ ¬p0) ∧ ... : 每个析取都要在否定之下构造
+    std::string lem;
+    for (unsigned i = 0; i < 40; ++i) {
+        lem += (i ? " & " : "") + std::string("~~(q") + std::to_string(i) + " | ~q" +
+               std::to_string(i) + ")";
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(provable(chain + " -> p0 -> p" + std::to_string(n)));
+    ASSERT_FALSE(provable(chain + " -> p" + std::to_string(n) + " -> p0"));
+    ASSERT_TRUE(provable(lem));
+    ASSERT_FALSE(provable("(" + chain + ") & (p" + std::to_string(n) + " -> ~~(r | ~r)) -> p0 -> r | ~r"
+                          " | s"));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    ASSERT_LT(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count(), 1000);
+}
+
+TEST_F(ProofSearchTest, RandomFormulasDecideQuickly) {
+    // 随机公式不像上面的公式族那样友好。Glivenko 定理: ¬¬F 可构造性地证明
+    // 当且仅当 F 是经典重言式, 用它独立地核对判定结果
+    std::mt19937 rng(2024);
+    unsigned provable_count = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 100; ++i) {
+        Formula formula = random_formula(rng, 150);
+        bool tautology = runtime::check_tautology(formula).tautology;
+        runtime::ProofSearchResult direct = runtime::prove_intuitionistic(formula);
+        runtime::ProofSearchResult negated =
+            runtime::prove_intuitionistic(runtime::Not(runtime::Not(formula)));
+        ASSERT_EQ(negated.provable, tautology) << i;
+        ASSERT_TRUE(!direct.provable || tautology) << i;
+        if (direct.provable) {
+            ++provable_count;
+            ASSERT_TRUE(runtime::verify_certificate(direct.certificate).valid) << i;
+        }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    ASSERT_GT(provable_count, 0u);
+    ASSERT_LT(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count(), 1000);
+}
+
+TEST_F(ProofSearchTest, MemoizesSharedSequents) {
+    runtime::CertificateBuilder builder;
+    runtime::FormulaStore &f = builder.formulas();
+    // pi ∨ (pi ∧ pi) 的两个分支饱和后相同, or_elim 的分支会反复遇到同样的相继式
+    NodeId premises = f.constant(true);
+    NodeId all = f.constant(true);
+    for (unsigned i = 1; i <= 8; ++i) {
+        premises = f.And(premises, f.Or(f.var(i), f.And(f.var(i), f.var(i))));
+        all = f.And(all, f.var(i));
+    }
+    runtime::ProofSearch search(builder);
+    NodeId goal = f.Implies(premises, f.Or(f.var(0), all));
+    ASSERT_TRUE(search.provable(goal));
+    ASSERT_GT(search.stats().memo_hits, 0u);
+    ASSERT_GT(search.stats().sequents, 0u);
+    runtime::CertificateBuilder::Step root;
+    ASSERT_TRUE(search.prove(goal, root));
+    ASSERT_TRUE(runtime::verify_certificate(builder.serialize(root)).valid);
+}
+
+TEST_F(ProofSearchTest, ClassicalCountermodelsPruneSearch) {
+    runtime::CertificateBuilder builder;
+    runtime::FormulaStore &f = builder.formulas();
+    // ((pi → p0) → pi) ⇒ p0: p0 为假、其余为真时前提全真, 不需要尝试左规则
+    NodeId premises = f.constant(true);
+    for (unsigned i = 1; i <= 8; ++i) {
+        premises = f.And(premises, f.Implies(f.Implies(f.var(i), f.var(0)), f.var(i)));
+    }
+    runtime::ProofSearch search(builder);
+    ASSERT_FALSE(search.provable(f.Implies(premises, f.var(0))));
+    ASSERT_GT(search.stats().countermodels, 0u);
+    ASSERT_EQ(search.stats().sequents, 0u);
+}
+
+TEST_F(ProofSearchTest, ParallelSearchAgreesWithSequential) {
+    runtime::ProofSearchOptions options;
+    options.threads = 4;
+    const char *formulas[] = {
+        "~(p | q) <-> ~p & ~q",
+        "((p -> q) -> p) -> p",
+        "~~(p | ~p) & ~~(q | ~q) & ~~(r | ~r)",
+        "((p <-> q) -> r) & ((q <-> r) -> p) & ((r <-> p) -> q) -> p & q & r",
+        "(((p -> q) -> r) -> s) & (((q -> r) -> s) -> p) -> (s -> p) | (p -> s)",
+        "(~~p -> p) -> p | ~p",
+    };
+    for (const char *text : formulas) {
+        Formula formula = parse(text);
+        runtime::ProofSearchResult sequential = runtime::prove_intuitionistic(formula);
+        runtime::ProofSearchResult parallel = runtime::prove_intuitionistic(formula, options);
+        ASSERT_EQ(parallel.provable, sequential.provable) << text;
+        if (parallel.provable) {
+            runtime::CertificateCheck check = runtime::verify_certificate(parallel.certificate);
+            ASSERT_TRUE(check.valid) << text << ": " << check.error;
+        }
+    }
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "../sat.h"
+#include "../truth_table.h"
+
+#include <random>
+
+using namespace cpp_prop;
+using runtime::Formula;
+
+// Test Fixture for the CDCL SAT backend
+class SatTest : public ::testing::Test {};
+
+namespace {
+
+Formula v(unsigned i) { return Formula::var(i); }
+
+Formula random_formula(std::mt19937 &rng, unsigned num_vars, int depth) {
+    if (depth == 0 || rng() % 4 == 0) {
+        return v(rng() % num_vars);
+    }
+    switch (rng() % 5) {
+    case 0:
+        return runtime::Not(random_formula(rng, num_vars, depth - 1));
+    case 1:
+        return runtime::And(random_formula(rng, num_vars, depth - 1), random_formula(rng, num_vars, depth - 1));
+    case 2:
+        return runtime::Or(random_formula(rng, num_vars, depth - 1), random_formula(rng, num_vars, depth - 1));
+    case 3:
+        return runtime::Implies(random_formula(rng, num_vars, depth - 1), random_formula(rng, num_vars, depth - 1));
+    default:
+        return runtime::Equiv(random_formula(rng, num_vars, depth - 1), random_formula(rng, num_vars, depth - 1));
+    }
+}
+
+// 鸽巢原理: n + 1 只鸽子放不进 n 个巢; 变量 p[i][j] 表示鸽子 i 在巢 j
+Formula pigeonhole(unsigned n) {
+    auto p = [n](unsigned i, unsigned j) { return v(i * n + j); };
+    Formula every_pigeon_placed = Formula::constant(true);
+    for (unsigned i = 0; i <= n; ++i) {
+        Formula somewhere = Formula::constant(false);
+        for (unsigned j = 0; j < n; ++j) {
+            somewhere = runtime::Or(std::move(somewhere), p(i, j));
+        }
+        every_pigeon_placed = runtime::And(std::move(every_pigeon_placed), std::move(somewhere));
+    }
+    Formula some_hole_shared = Formula::constant(false);
+    for (unsigned j = 0; j < n; ++j) {
+        for (unsigned a = 0; a <= n; ++a) {
+            for (unsigned b = a + 1; b <= n; ++b) {
+                some_hole_shared = runtime::Or(std::move(some_hole_shared), runtime::And(p(a, j), p(b, j)));
+            }
+        }
+    }
+    return runtime::Implies(std::move(every_pigeon_placed), std::move(some_hole_shared));
+}
+
+} // namespace
+
+TEST_F(SatTest, TemplateFormulas) {
+    ASSERT_TRUE(runtime::check_validity(runtime::lower<Syllogism, 3>()).valid);
+    runtime::TautologyResult result = runtime::check_tautology_sat(runtime::lower<Implies, 2>());
+    ASSERT_FALSE(result.tautology);
+    // A → B 只有一个反例: A = True, B = False
+    ASSERT_EQ(result.counterexample, 1u);
+    ASSERT_TRUE(runtime::check_validity(Formula::constant(true)).valid);
+    ASSERT_FALSE(runtime::check_validity(Formula::constant(false)).valid);
+}
+
+TEST_F(SatTest, AgreesWithTruthTable) {
+    std::mt19937 rng(12345);
+    for (int i = 0; i < 300; ++i) {
+        Formula f = random_formula(rng, 6, 6);
+        runtime::ValidityResult sat = runtime::check_validity(f);
+        ASSERT_EQ(sat.valid, runtime::check_tautology(f, 6).tautology) << "formula " << i;
+        if (!sat.valid) {
+            ASSERT_FALSE(f.eval(sat.counterexample)) << "formula " << i;
+        }
+    }
+}
+
+TEST_F(SatTest, PigeonholeNeedsLearning) {
+    runtime::ValidityResult result = runtime::check_validity(pigeonhole(6));
+    ASSERT_TRUE(result.valid);
+    ASSERT_GT(result.stats.conflicts, 0u);
+    ASSERT_GT(result.stats.learnt_clauses, 0u);
+}
+
+TEST_F(SatTest, ThousandsOfVariables) {
+    // x0 → x1, x1 → x2, ..., x[n-1] → x[n] ⊢ x0 → x[n]
+    const unsigned n = 5000;
+    Formula chain = Formula::constant(true);
+    for (unsigned i = 0; i < n; ++i) {
+        chain = runtime::And(std::move(chain), runtime::Implies(v(i), v(i + 1)));
+    }
+    ASSERT_TRUE(runtime::check_validity(runtime::Implies(chain, runtime::Implies(v(0), v(n)))).valid);
+
+    // 反方向不成立, 反例在 5001 个变量上
+    runtime::ValidityResult result =
+        runtime::check_validity(runtime::Implies(chain, runtime::Implies(v(n), v(0))));
+    ASSERT_FALSE(result.valid);
+    ASSERT_EQ(result.counterexample.size(), n + 1);
+    ASSERT_TRUE(result.counterexample[n]);
+    ASSERT_FALSE(result.counterexample[0]);
+}
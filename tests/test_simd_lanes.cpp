@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include "../simd_lanes.h"
+#include "../truth_table.h"
+
+#include <random>
+#include <tuple>
+
+using namespace cpp_prop::runtime;
+
+namespace {
+
+// 对 simd::Available 中的每个指令集调用 f(L{})
+template <typename F, typename... Ls> void for_each_lanes(std::tuple<Ls...> *, F f) {
+    (f(Ls{}), ...);
+}
+template <typename F> void for_each_lanes(F f) {
+    for_each_lanes(static_cast<simd::Available *>(nullptr), f);
+}
+
+Block random_block(std::mt19937_64 &rng) {
+    Block b;
+    for (std::uint64_t &x : b.w) {
+        x = rng();
+    }
+    return b;
+}
+
+} // namespace
+
+// Test Fixture for the shared SIMD primitives
+class SimdLanesTest : public ::testing::Test {};
+
+TEST_F(SimdLanesTest, NativeIsTheWidestAvailable) {
+    constexpr std::size_t count = std::tuple_size_v<simd::Available>;
+    using Widest = std::tuple_element_t<count - 1, simd::Available>;
+    ASSERT_TRUE((std::is_same_v<simd::Native, Widest>));
+    ASSERT_EQ(Block::words % simd::Native::words, 0u);
+}
+
+TEST_F(SimdLanesTest, PrimitivesMatchWordOperations) {
+    std::mt19937_64 rng(7);
+    for_each_lanes([&](auto tag) {
+        using L = decltype(tag);
+        SCOPED_TRACE(L::name);
+        std::uint64_t x[L::words], y[L::words], out[L::words];
+        for (int round = 0; round < 16; ++round) {
+            for (std::size_t i = 0; i < L::words; ++i) {
+                x[i] = rng();
+                y[i] = rng();
+            }
+            auto check = [&](typename L::Lane lane, auto expected) {
+                L::store(out, lane);
+                for (std::size_t i = 0; i < L::words; ++i) {
+                    ASSERT_EQ(out[i], expected(x[i], y[i]));
+                }
+            };
+            typename L::Lane a = L::load(x);
+            typename L::Lane b = L::load(y);
+            check(a, [](std::uint64_t p, std::uint64_t) { return p; });
+            check(L::splat(y[0]), [&](std::uint64_t, std::uint64_t) { return y[0]; });
+            check(L::bit_and(a, b), [](std::uint64_t p, std::uint64_t q) { return p & q; });
+            check(L::bit_or(a, b), [](std::uint64_t p, std::uint64_t q) { return p | q; });
+            check(L::bit_xor(a, b), [](std::uint64_t p, std::uint64_t q) { return p ^ q; });
+            check(L::andnot(a, b), [](std::uint64_t p, std::uint64_t q) { return ~p & q; });
+            check(L::bit_not(a), [](std::uint64_t p, std::uint64_t) { return ~p; });
+            check(simd::ImpliesOp::lane<L>(a, b), simd::ImpliesOp::word);
+            check(simd::EquivOp::lane<L>(a, b), simd::EquivOp::word);
+        }
+    });
+}
+
+TEST_F(SimdLanesTest, BlockOperationsAgreeAcrossLanes) {
+    std::mt19937_64 rng(11);
+    for (int round = 0; round < 16; ++round) {
+        const Block x = random_block(rng);
+        const Block y = random_block(rng);
+        for_each_lanes([&](auto tag) {
+            using L = decltype(tag);
+            SCOPED_TRACE(L::name);
+            Block a = x, o = x, i = x, e = x, n = x;
+            detail::block_and<L>(a, y);
+            detail::block_or<L>(o, y);
+            detail::block_implies<L>(i, y);
+            detail::block_equiv<L>(e, y);
+            detail::block_not<L>(n);
+            for (std::size_t k = 0; k < Block::words; ++k) {
+                ASSERT_EQ(a.w[k], x.w[k] & y.w[k]);
+                ASSERT_EQ(o.w[k], x.w[k] | y.w[k]);
+                ASSERT_EQ(i.w[k], ~x.w[k] | y.w[k]);
+                ASSERT_EQ(e.w[k], ~(x.w[k] ^ y.w[k]));
+                ASSERT_EQ(n.w[k], ~x.w[k]);
+            }
+        });
+    }
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include "../static_logic.h"
+
+// Test Fixture for static (non type-erased) proof terms
+class StaticLogicTest : public ::testing::Test {};
+
+TEST_F(StaticLogicTest, ModusPonens) {
+    auto always_true = [](True) { return True{}; };
+    True result = static_proof::modus_ponens(True{}, always_true);
+    (void)result;
+    ASSERT_TRUE((static_proof::is_implication_v<decltype(always_true), True, True>));
+    ASSERT_FALSE((static_proof::is_implication_v<decltype(always_true), False, True>));
+}
+
+TEST_F(StaticLogicTest, ProofsAreNotTypeErased) {
+    auto and_i = static_proof::and_intro<int, char>();
+    auto partial = and_i(1);
+    ASSERT_FALSE((std::is_same_v<decltype(partial), Implies<char, And<int, char>>>));
+    And<int, char> both = partial('x');
+    ASSERT_EQ(both.a, 1);
+    ASSERT_EQ(both.b, 'x');
+}
+
+TEST_F(StaticLogicTest, SyllogismChain) {
+    auto inc = [](int x) { return x + 1; };
+    auto twice = [](int x) { return x * 2; };
+    auto proof = static_proof::syllogism<int, int, int>(inc, twice);
+    ASSERT_EQ(proof(3), 8);
+
+    auto curried = static_proof::prove_syllogism_curried<int, int, int>();
+    ASSERT_EQ(curried(twice)(inc)(3), 7);
+}
+
+TEST_F(StaticLogicTest, OrElim) {
+    auto elim = static_proof::or_elim<int, char, int>();
+    auto from_int = [](int x) { return x; };
+    auto from_char = [](char) { return -1; };
+    ASSERT_EQ(elim(Or<int, char>{std::in_place_index<0>, 5})(from_int)(from_char), 5);
+    ASSERT_EQ(elim(Or<int, char>{std::in_place_index<1>, 'c'})(from_int)(from_char), -1);
+}
+
+TEST_F(StaticLogicTest, ExportationImportationPermute) {
+    auto add = [](And<int, int> p) { return p.a - p.b; };
+    auto exported = static_proof::exportation<int, int, int>(add);
+    ASSERT_EQ(exported(5)(3), 2);
+    auto imported = static_proof::importation<int, int, int>(exported);
+    ASSERT_EQ(imported(And<int, int>{5, 3}), 2);
+    auto permuted = static_proof::permute<int, int, int>(exported);
+    ASSERT_EQ(permuted(5)(3), -2);
+}
+
+TEST_F(StaticLogicTest, DeMorganAndReductio) {
+    bool reached = false;
+    auto not_or = [&reached](Or<True, True>) { reached = true; return False{}; };
+    auto dm1 = static_proof::de_morgan_1<True, True>()(not_or);
+    dm1.a(True{});
+    ASSERT_TRUE(reached);
+
+    auto not_true = [](True) { return False{}; };
+    auto dm2 = static_proof::de_morgan_2<True, True>()(And<decltype(not_true), decltype(not_true)>{not_true, not_true});
+    False f = dm2(Or<True, True>{std::in_place_index<1>, True{}});
+    (void)f;
+
+    auto raa = static_proof::reductio_ad_absurdum<True, True>();
+    auto a_implies_b = [](True) { return True{}; };
+    auto a_implies_not_b = [not_true](True) { return not_true; };
+    False g = raa(a_implies_b)(a_implies_not_b)(True{});
+    (void)g;
+}
+
+TEST_F(StaticLogicTest, EraseAtApiBoundary) {
+    auto cp = static_proof::contraposition<True, True>()([](True) { return True{}; });
+    Not<True> erased = static_proof::erase<Not<True>, Not<True>>(cp)([](True) { return False{}; });
+    False f = erased(True{});
+    (void)f;
+}
+
+namespace {
+
+// 编译期求值用的前提: 命题用 int 表示, 证明携带一个整数
+constexpr auto inc = [](int x) { return x + 1; };
+constexpr auto twice = [](int x) { return x * 2; };
+constexpr auto refute = [](int) { return False{}; };
+
+} // namespace
+
+TEST_F(StaticLogicTest, ProofsEvaluateAtCompileTime) {
+    static_assert(static_proof::modus_ponens(1, inc) == 2);
+    static_assert(static_proof::syllogism<int, int, int>(inc, twice)(3) == 8);
+    static_assert(static_proof::prove_syllogism_curried<int, int, int>()(twice)(inc)(3) == 7);
+
+    constexpr And<int, char> both = static_proof::and_intro<int, char>()(1)('x');
+    static_assert(static_proof::and_elim_left<int, char>()(both) == 1);
+    static_assert(static_proof::and_elim_right<int, char>()(both) == 'x');
+
+    constexpr auto elim = static_proof::or_elim<int, int, int>();
+    static_assert(elim(static_proof::or_intro_left<int, int>()(5))(inc)(twice) == 6);
+    static_assert(elim(static_proof::or_intro_right<int, int>()(5))(inc)(twice) == 10);
+
+    constexpr auto minus = [](And<int, int> p) { return p.a - p.b; };
+    constexpr auto exported = static_proof::exportation<int, int, int>(minus);
+    static_assert(exported(5)(3) == 2);
+    static_assert(static_proof::importation<int, int, int>(exported)(And<int, int>{5, 3}) == 2);
+    static_assert(static_proof::permute<int, int, int>(exported)(5)(3) == -2);
+
+    // 结论为 False 的证明同样在编译期走完 (constexpr 变量要求常量求值)
+    constexpr False g = static_proof::contraposition<int, int>()(inc)(refute)(1);
+    constexpr False h = static_proof::de_morgan_2<int, int>()(
+        And<decltype(refute), decltype(refute)>{refute, refute})(
+        Or<int, int>{std::in_place_index<1>, 1});
+    constexpr False k = static_proof::double_negation_intro<int>()(4)(refute);
+    (void)g;
+    (void)h;
+    (void)k;
+}
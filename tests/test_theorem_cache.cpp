@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include "../batch_check.h"
+#include "../theorem_cache.h"
+
+#include <atomic>
+#include <cstdio>
+#include <sstream>
+#include <thread>
+
+using namespace cpp_prop;
+using runtime::CachedVerdict;
+using runtime::Formula;
+using runtime::TheoremCache;
+
+// Test Fixture for the verified-theorem cache
+class TheoremCacheTest : public ::testing::Test {};
+
+namespace {
+
+Formula parse(const char *text) {
+    runtime::TextFormulaParser parser;
+    Formula f = Formula::constant(true);
+    EXPECT_TRUE(parser.parse(text, f)) << parser.error();
+    return f;
+}
+
+// p_i → p_{i+1} 的链, 变量编号从 offset 开始
+Formula chain(unsigned length, unsigned offset) {
+    Formula f = runtime::Implies(Formula::var(offset), Formula::var(offset + 1));
+    for (unsigned i = 1; i < length; ++i) {
+        f = runtime::And(std::move(f),
+                         runtime::Implies(Formula::var(offset + i), Formula::var(offset + i + 1)));
+    }
+    return f;
+}
+
+} // namespace
+
+TEST_F(TheoremCacheTest, CanonicalKeyIgnoresNamesAndOperandOrder) {
+    auto key = [](const char *text) { return runtime::canonicalize(parse(text)).key; };
+    ASSERT_EQ(key("(p & q) -> p"), key("(b & a) -> a"));
+    ASSERT_EQ(key("~(p | q) <-> ~p & ~q"), key("~q & ~p <-> ~(q | p)"));
+    ASSERT_EQ(key("(p -> q) & (q -> r) -> p -> r"), key("(y -> z) & (x -> y) -> x -> z"));
+    ASSERT_EQ(runtime::canonicalize(chain(5, 0)).key, runtime::canonicalize(chain(5, 7)).key);
+
+    ASSERT_FALSE(key("(p & q) -> p") == key("(p & q) -> r"));
+    ASSERT_FALSE(key("p -> q -> p") == key("p -> q -> q"));
+    ASSERT_FALSE(key("p -> q") == key("p & q"));
+    ASSERT_FALSE(key("(p -> q) -> p") == key("p -> (q -> p)"));
+}
+
+TEST_F(TheoremCacheTest, CounterexamplesMapBackToOriginalVariables) {
+    TheoremCache cache;
+    Formula ab = parse("p -> q");
+    ASSERT_FALSE(cache.lookup(ab));
+    cache.insert(ab, false, {true, false});
+
+    // q 的编号为 0, p 为 1: 反例是 q=0, p=1
+    Formula ba = runtime::Implies(Formula::var(1), Formula::var(0));
+    CachedVerdict verdict;
+    ASSERT_TRUE(cache.lookup(ba, &verdict));
+    ASSERT_FALSE(verdict.valid);
+    ASSERT_EQ(verdict.counterexample, (std::vector<bool>{false, true}));
+    ASSERT_FALSE(ba.eval(verdict.counterexample));
+
+    cache.insert(parse("p | ~p"), true, {}, "certificate bytes");
+    ASSERT_TRUE(cache.lookup(parse("~x | x"), &verdict));
+    ASSERT_TRUE(verdict.valid);
+    ASSERT_EQ(verdict.certificate, "certificate bytes");
+    ASSERT_EQ(cache.size(), 2u);
+    ASSERT_EQ(cache.stats().hits, 2u);
+}
+
+TEST_F(TheoremCacheTest, PersistsAcrossRunsAndInvalidatesOnVersion) {
+    std::string path = ::testing::TempDir() + "theorem_cache_test.cache";
+    {
+        TheoremCache cache;
+        for (unsigned n = 1; n <= 200; ++n) {
+            cache.insert(runtime::Implies(chain(n, 0), runtime::Implies(Formula::var(0), Formula::var(n))), true);
+        }
+        cache.insert(parse("p -> q"), false, {true, false});
+        cache.save(path);
+    }
+    {
+        TheoremCache cache;
+        ASSERT_TRUE(cache.load(path));
+        ASSERT_EQ(cache.size(), 201u);
+        CachedVerdict verdict;
+        ASSERT_TRUE(cache.lookup(runtime::Implies(chain(100, 3), runtime::Implies(Formula::var(3), Formula::var(103))), &verdict));
+        ASSERT_TRUE(verdict.valid);
+        ASSERT_TRUE(cache.lookup(parse("a -> b"), &verdict));
+        ASSERT_EQ(verdict.counterexample, (std::vector<bool>{true, false}));
+    }
+    {
+        TheoremCache newer(runtime::kCheckerVersion + 1);
+        ASSERT_FALSE(newer.load(path));
+        ASSERT_EQ(newer.size(), 0u);
+    }
+    TheoremCache missing;
+    ASSERT_FALSE(missing.load(path + ".missing"));
+    std::remove(path.c_str());
+}
+
+TEST_F(TheoremCacheTest, ConcurrentReadersDuringInserts) {
+    TheoremCache cache;
+    std::atomic<bool> done{false};
+    std::atomic<std::size_t> wrong{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 3; ++t) {
+        readers.emplace_back([&] {
+            CachedVerdict verdict;
+            while (!done.load()) {
+                for (unsigned n = 1; n <= 300; n += 7) {
+                    if (cache.lookup(chain(n, 0), &verdict) && verdict.valid) {
+                        ++wrong;
+                    }
+                }
+            }
+        });
+    }
+    // 插入足够多的条目, 触发多次扩容
+    for (unsigned n = 1; n <= 300; ++n) {
+        std::vector<bool> counterexample(n + 1, false);
+        counterexample[0] = true;
+        cache.insert(chain(n, 0), false, counterexample);
+    }
+    done.store(true);
+    for (std::thread &reader : readers) {
+        reader.join();
+    }
+    ASSERT_EQ(wrong.load(), 0u);
+    ASSERT_EQ(cache.size(), 300u);
+    for (unsigned n = 1; n <= 300; ++n) {
+        ASSERT_TRUE(cache.lookup(chain(n, 0)));
+    }
+}
+
+TEST_F(TheoremCacheTest, BatchCheckSkipsKnownResults) {
+    std::string input = "(p -> q) & (q -> r) -> p -> r\np -> q\n(a -> b) & (b -> c) -> a -> c\n";
+    TheoremCache cache;
+    runtime::BatchOptions options;
+    options.cache = &cache;
+    options.cache_min_vars = 0;
+    std::ostringstream first;
+    runtime::run_batch_check(input, runtime::InputFormat::Text, first, options);
+    ASSERT_EQ(first.str().substr(0, 16), "1\tvalid\ttruth-ta");
+
+    std::ostringstream second;
+    runtime::BatchSummary summary =
+        runtime::run_batch_check("b -> a\n", runtime::InputFormat::Text, second, options);
+    ASSERT_EQ(summary.invalid, 1u);
+    ASSERT_EQ(second.str(), "1\tinvalid\tcache\tb=1 a=0\n");
+    ASSERT_EQ(cache.size(), 2u);
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include "../truth_table.h"
+
+using namespace cpp_prop;
+using runtime::Formula;
+
+// Test Fixture for the bit-parallel truth-table engine
+class TruthTableTest : public ::testing::Test {};
+
+namespace {
+
+Formula v(unsigned i) { return Formula::var(i); }
+
+// 跨越多个 Block 的公式: (x0 ∧ x7) ∨ (x10 ↔ ¬x3) → (x11 ∨ x0)
+Formula mixed() {
+    return runtime::Implies(
+        runtime::Or(runtime::And(v(0), v(7)), runtime::Equiv(v(10), runtime::Not(v(3)))),
+        runtime::Or(v(11), v(0)));
+}
+
+// 内部读取 ::type 的公式: A ∨ ¬A 与 ¬A → False (即 A)
+template <typename A> using NestedExcludedMiddle = Or<A, typename Not<A>::type>;
+template <typename A> using NotAImpliesFalse = Implies<typename Not<A>::type, FalseType>;
+// ¬A ∨ B (即 A → B) 与 Syllogism 的写法: 按 ::type 逐层求值
+template <typename A, typename B> using NestedImplies = Or<typename Not<A>::type, B>;
+
+} // namespace
+
+TEST_F(TruthTableTest, MatchesScalarEvaluation) {
+    Formula f = mixed();
+    std::vector<std::uint64_t> table = runtime::truth_table(f, 12);
+    ASSERT_EQ(table.size(), 64u);
+    for (std::uint64_t a = 0; a < (1u << 12); ++a) {
+        ASSERT_EQ(((table[a / 64] >> (a % 64)) & 1u) != 0, f.eval(a)) << "assignment " << a;
+    }
+}
+
+TEST_F(TruthTableTest, FirstCounterexample) {
+    Formula f = mixed();
+    runtime::TautologyResult result = runtime::check_tautology(f);
+    ASSERT_FALSE(result.tautology);
+    ASSERT_FALSE(f.eval(result.counterexample));
+    for (std::uint64_t a = 0; a < result.counterexample; ++a) {
+        ASSERT_TRUE(f.eval(a));
+    }
+}
+
+TEST_F(TruthTableTest, SmallFormulasIgnorePaddingBits) {
+    // 只有 2 个变量时, Block 中 4 位以外的位不参与检查
+    runtime::TautologyResult result =
+        runtime::check_tautology(runtime::Or(v(1), runtime::Not(v(1))));
+    ASSERT_TRUE(result.tautology);
+    result = runtime::check_tautology(runtime::Implies(v(0), v(1)));
+    ASSERT_FALSE(result.tautology);
+    ASSERT_EQ(result.counterexample, 1u);
+    ASSERT_TRUE(runtime::check_tautology(Formula::constant(true), 0).tautology);
+    ASSERT_EQ(runtime::truth_table(runtime::And(v(0), v(1)), 2)[0], 0b1000u);
+}
+
+TEST_F(TruthTableTest, LowersTemplateFormulas) {
+    Formula syllogism = runtime::lower<Syllogism, 3>();
+    ASSERT_EQ(syllogism.num_vars(), 3u);
+    ASSERT_TRUE(runtime::check_tautology(syllogism).tautology);
+
+    runtime::TautologyResult result = runtime::check_tautology(runtime::lower<Implies, 2>());
+    ASSERT_FALSE(result.tautology);
+    ASSERT_EQ(result.counterexample, (IsTautology<Implies, 2>::first_falsifying));
+
+    // 用户公式继承联结词也可以降级
+    struct Contraposition : Equiv<Implies<Var<0>, Var<1>>, Implies<Not<Var<1>>, Not<Var<0>>>> {};
+    ASSERT_TRUE(runtime::check_tautology(runtime::lower<Contraposition>()).tautology);
+}
+
+TEST_F(TruthTableTest, LowersNestedTypeFormulas) {
+    ASSERT_TRUE((runtime::check_tautology(runtime::lower<NestedExcludedMiddle, 1>()).tautology));
+    runtime::TautologyResult result =
+        runtime::check_tautology(runtime::lower<NotAImpliesFalse, 1>());
+    ASSERT_FALSE(result.tautology);
+    ASSERT_EQ(result.counterexample, 0u);
+    ASSERT_EQ((runtime::truth_table(runtime::lower<NestedImplies, 2>(), 2)),
+              (runtime::truth_table(runtime::lower<Implies, 2>(), 2)));
+}
+
+TEST_F(TruthTableTest, ManyVariables) {
+    // 20 个变量的合取 → 最后一个变量: 2^20 个赋值, 2048 个 Block
+    Formula conj = v(0);
+    for (unsigned i = 1; i < 20; ++i) {
+        conj = runtime::And(std::move(conj), v(i));
+    }
+    ASSERT_TRUE(runtime::check_tautology(runtime::Implies(conj, v(19))).tautology);
+    runtime::TautologyResult result = runtime::check_tautology(runtime::Or(v(19), v(13)));
+    ASSERT_FALSE(result.tautology);
+    ASSERT_EQ(result.counterexample, 0u);
+    result = runtime::check_tautology(runtime::Or(runtime::Not(v(19)), v(13)));
+    ASSERT_EQ(result.counterexample, std::uint64_t{1} << 19);
+}
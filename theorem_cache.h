@@ -0,0 +1,490 @@
+#ifndef THEOREM_CACHE_H
+#define THEOREM_CACHE_H
+
+#include "formula_io.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+// --- Theorem Cache ---
+// 已判定公式的缓存, 可以保存到磁盘并在下次运行时加载。键是公式的规范哈希:
+// 变量按规范顺序重新编号, 可交换联结词 (∧ ∨ ↔) 的两个操作数按哈希排序,
+// 所以 (p ∧ q) → p 与 (b ∧ a) → a 共用一个条目。
+// 查找不加锁: 条目先写好再用 release 发布状态字, 读者 acquire 读状态后才读内容;
+// 插入由互斥量串行化, 表满时建新表并原子地替换指针, 旧表保留到缓存析构。
+// 缓存文件记录写入它的检查器版本, 版本不同的文件在加载时整体作废。
+
+namespace cpp_prop::runtime {
+
+// 检查引擎的判定逻辑改变时递增, 使旧的缓存文件失效
+inline constexpr std::uint64_t kCheckerVersion = 1;
+
+struct CanonicalKey {
+  std::uint64_t hi;
+  std::uint64_t lo;
+
+  bool operator==(const CanonicalKey &other) const {
+    return hi == other.hi && lo == other.lo;
+  }
+};
+
+struct CanonicalForm {
+  CanonicalKey key;
+  // 规范编号 i 对应的原变量编号; 只包含公式中出现的变量
+  std::vector<std::uint32_t> variables;
+};
+
+namespace detail {
+
+inline std::uint64_t mix64(std::uint64_t x) {
+  x ^= x >> 30;
+  x *= 0xBF58476D1CE4E5B9ull;
+  x ^= x >> 27;
+  x *= 0x94D049BB133111EBull;
+  return x ^ (x >> 31);
+}
+
+inline std::uint64_t hash_node(std::uint64_t seed, Opcode op, std::uint64_t a,
+                               std::uint64_t b) {
+  return mix64(seed ^ mix64(static_cast<std::uint64_t>(op) + 1) ^
+               mix64(a + 0x9E3779B97F4A7C15ull) * 3 ^ mix64(b) * 7);
+}
+
+inline bool is_commutative(Opcode op) {
+  return op == Opcode::And || op == Opcode::Or || op == Opcode::Equiv;
+}
+
+} // namespace detail
+
+// 规范化分两轮:
+//  1. 形状哈希: 变量只按出现的位置区分, 与名字无关; 可交换操作数按它排序,
+//     再先序遍历, 按首次出现的顺序给变量重新编号。
+//  2. 用新编号计算两条独立的 64 位哈希作为键, 可交换操作数按哈希排序。
+// 形状哈希相同的可交换操作数保持原顺序, 这时等价的公式可能得到不同的键;
+// 这只影响命中率, 不影响正确性。
+inline CanonicalForm canonicalize(const Formula &formula) {
+  const std::vector<Instruction> &code = formula.code();
+  const std::size_t n = code.size();
+  // 后缀序列中每个二元节点的左子节点 (右子节点总是 i - 1)
+  std::vector<std::uint32_t> left(n, 0);
+  {
+    std::vector<std::uint32_t> stack;
+    for (std::uint32_t i = 0; i < n; ++i) {
+      Opcode op = code[i].op;
+      if (op == Opcode::Not) {
+        stack.back() = i;
+      } else if (op == Opcode::Var || op == Opcode::True || op == Opcode::False) {
+        stack.push_back(i);
+      } else {
+        stack.pop_back();
+        left[i] = stack.back();
+        stack.back() = i;
+      }
+    }
+  }
+
+  // 变量的颜色: 它的各次出现在公式中的位置 (从根到该处的路径, 可交换联结词
+  // 不区分左右) 的哈希之和, 与变量名和可交换操作数的顺序无关
+  std::vector<std::uint64_t> context(n);
+  std::vector<std::uint64_t> color(formula.num_vars(), 0);
+  if (n != 0) {
+    context[n - 1] = 0x9E3779B97F4A7C15ull;
+  }
+  for (std::uint32_t i = static_cast<std::uint32_t>(n); i-- > 0;) {
+    Opcode op = code[i].op;
+    if (op == Opcode::Var) {
+      color[code[i].var] += detail::mix64(context[i]);
+    } else if (op == Opcode::Not) {
+      context[i - 1] = detail::hash_node(0, op, context[i], 0);
+    } else if (op != Opcode::True && op != Opcode::False) {
+      bool commutative = detail::is_commutative(op);
+      context[left[i]] = detail::hash_node(0, op, context[i], commutative ? 0 : 1);
+      context[i - 1] = detail::hash_node(0, op, context[i], commutative ? 0 : 2);
+    }
+  }
+
+  // 第一轮: 形状哈希
+  std::vector<std::uint64_t> shape(n);
+  for (std::uint32_t i = 0; i < n; ++i) {
+    Opcode op = code[i].op;
+    if (op == Opcode::Var) {
+      shape[i] = detail::hash_node(0, op, color[code[i].var], 0);
+    } else if (op == Opcode::True || op == Opcode::False) {
+      shape[i] = detail::hash_node(0, op, 0, 0);
+    } else if (op == Opcode::Not) {
+      shape[i] = detail::hash_node(0, op, shape[i - 1], 0);
+    } else {
+      std::uint64_t a = shape[left[i]];
+      std::uint64_t b = shape[i - 1];
+      if (detail::is_commutative(op) && b < a) {
+        std::swap(a, b);
+      }
+      shape[i] = detail::hash_node(0, op, a, b);
+    }
+  }
+
+  // 先序遍历, 可交换操作数按形状哈希的顺序访问
+  CanonicalForm form;
+  std::vector<std::uint32_t> rename(formula.num_vars(), ~0u);
+  {
+    std::vector<std::uint32_t> stack;
+    if (n != 0) {
+      stack.push_back(static_cast<std::uint32_t>(n - 1));
+    }
+    while (!stack.empty()) {
+      std::uint32_t i = stack.back();
+      stack.pop_back();
+      Opcode op = code[i].op;
+      if (op == Opcode::Var) {
+        if (rename[code[i].var] == ~0u) {
+          rename[code[i].var] = static_cast<std::uint32_t>(form.variables.size());
+          form.variables.push_back(code[i].var);
+        }
+      } else if (op == Opcode::Not) {
+        stack.push_back(i - 1);
+      } else if (op != Opcode::True && op != Opcode::False) {
+        std::uint32_t first = left[i];
+        std::uint32_t second = i - 1;
+        if (detail::is_commutative(op) && shape[second] < shape[first]) {
+          std::swap(first, second);
+        }
+        stack.push_back(second);
+        stack.push_back(first);
+      }
+    }
+  }
+
+  // 第二轮: 两条独立的哈希
+  std::vector<std::uint64_t> hi(n);
+  std::vector<std::uint64_t> lo(n);
+  const std::uint64_t seed_hi = 0x243F6A8885A308D3ull;
+  const std::uint64_t seed_lo = 0x13198A2E03707344ull;
+  for (std::uint32_t i = 0; i < n; ++i) {
+    Opcode op = code[i].op;
+    if (op == Opcode::Var) {
+      hi[i] = detail::hash_node(seed_hi, op, rename[code[i].var], 0);
+      lo[i] = detail::hash_node(seed_lo, op, rename[code[i].var], 0);
+    } else if (op == Opcode::True || op == Opcode::False) {
+      hi[i] = detail::hash_node(seed_hi, op, 0, 0);
+      lo[i] = detail::hash_node(seed_lo, op, 0, 0);
+    } else if (op == Opcode::Not) {
+      hi[i] = detail::hash_node(seed_hi, op, hi[i - 1], 0);
+      lo[i] = detail::hash_node(seed_lo, op, lo[i - 1], 0);
+    } else {
+      std::uint32_t a = left[i];
+      std::uint32_t b = i - 1;
+      if (detail::is_commutative(op) &&
+          (hi[b] < hi[a] || (hi[b] == hi[a] && lo[b] < lo[a]))) {
+        std::swap(a, b);
+      }
+      hi[i] = detail::hash_node(seed_hi, op, hi[a], hi[b]);
+      lo[i] = detail::hash_node(seed_lo, op, lo[a], lo[b]);
+    }
+  }
+  form.key = n == 0 ? CanonicalKey{0, 0}
+                    : CanonicalKey{detail::mix64(hi[n - 1] ^ n),
+                                   detail::mix64(lo[n - 1] + form.variables.size())};
+  return form;
+}
+
+struct CachedVerdict {
+  bool valid = false;
+  std::vector<bool> counterexample; // 按原公式的变量编号; 有效时为空
+  std::string certificate;          // 插入时附带的证书, 可以为空
+};
+
+class TheoremCache {
+public:
+  struct Stats {
+    std::size_t lookups = 0;
+    std::size_t hits = 0;
+  };
+
+  explicit TheoremCache(std::uint64_t checker_version = kCheckerVersion)
+      : checker_version_(checker_version) {
+    tables_.push_back(std::make_unique<Table>(64));
+    table_.store(tables_.back().get(), std::memory_order_release);
+  }
+
+  TheoremCache(const TheoremCache &) = delete;
+  TheoremCache &operator=(const TheoremCache &) = delete;
+
+  std::uint64_t checker_version() const { return checker_version_; }
+  std::size_t size() const { return size_.load(std::memory_order_relaxed); }
+  Stats stats() const {
+    return {lookups_.load(std::memory_order_relaxed),
+            hits_.load(std::memory_order_relaxed)};
+  }
+
+  // 不加锁, 可以与其他查找和插入并发
+  bool lookup(const Formula &formula, CachedVerdict *out = nullptr) const {
+    return lookup(canonicalize(formula), formula.num_vars(), out);
+  }
+  bool lookup(const CanonicalForm &form, unsigned num_vars,
+              CachedVerdict *out = nullptr) const {
+    lookups_.fetch_add(1, std::memory_order_relaxed);
+    const Entry *entry = find(form.key);
+    if (entry == nullptr) {
+      return false;
+    }
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    if (out != nullptr) {
+      out->valid = entry->valid;
+      out->counterexample.clear();
+      if (!entry->valid) {
+        // 反例按规范编号存储, 映射回原编号
+        out->counterexample.assign(num_vars, false);
+        for (std::size_t i = 0; i < form.variables.size() && i < entry->num_vars; ++i) {
+          out->counterexample[form.variables[i]] =
+              ((static_cast<unsigned char>(entry->payload[i / 8]) >> (i % 8)) & 1u) != 0;
+        }
+      }
+      out->certificate.assign(entry->payload + bitmap_bytes(entry->num_vars),
+                              entry->certificate_size);
+    }
+    return true;
+  }
+
+  // counterexample 按原公式的变量编号; 已存在的键保持不变
+  void insert(const Formula &formula, bool valid,
+              const std::vector<bool> &counterexample = {},
+              std::string_view certificate = {}) {
+    insert(canonicalize(formula), valid, counterexample, certificate);
+  }
+  void insert(const CanonicalForm &form, bool valid,
+              const std::vector<bool> &counterexample = {},
+              std::string_view certificate = {}) {
+    const std::uint32_t num_vars = static_cast<std::uint32_t>(form.variables.size());
+    std::unique_ptr<char[]> payload(
+        new char[bitmap_bytes(num_vars) + certificate.size()]());
+    if (!valid) {
+      for (std::uint32_t i = 0; i < num_vars; ++i) {
+        if (form.variables[i] < counterexample.size() &&
+            counterexample[form.variables[i]]) {
+          payload[i / 8] = static_cast<char>(payload[i / 8] | (1 << (i % 8)));
+        }
+      }
+    }
+    if (!certificate.empty()) {
+      std::memcpy(payload.get() + bitmap_bytes(num_vars), certificate.data(),
+                  certificate.size());
+    }
+    publish(form.key, valid, num_vars, std::move(payload),
+            static_cast<std::uint32_t>(certificate.size()));
+  }
+
+  // 加载缓存文件并合并到当前缓存。文件不存在或由其他检查器版本写入时返回 false;
+  // 文件损坏时抛出 std::runtime_error
+  bool load(const std::string &path) {
+    std::unique_ptr<MappedFile> file;
+    try {
+      file = std::make_unique<MappedFile>(path);
+    } catch (const std::system_error &) {
+      return false;
+    }
+    std::string_view bytes = file->bytes();
+    if (bytes.size() < kHeaderSize ||
+        bytes.substr(0, 4) != std::string_view(kMagic, 4)) {
+      throw std::runtime_error("not a theorem cache file");
+    }
+    if (load_u32(bytes.data() + 4) != kFormatVersion ||
+        load_u64(bytes.data() + 8) != checker_version_) {
+      return false;
+    }
+    std::uint64_t count = load_u64(bytes.data() + 16);
+    std::size_t pos = kHeaderSize;
+    for (std::uint64_t e = 0; e < count; ++e) {
+      if (bytes.size() - pos < kEntryHeaderSize) {
+        throw std::runtime_error("truncated theorem cache file");
+      }
+      const char *p = bytes.data() + pos;
+      CanonicalKey key{load_u64(p), load_u64(p + 8)};
+      bool valid = load_u32(p + 16) != 0;
+      std::uint32_t num_vars = load_u32(p + 20);
+      std::uint32_t certificate_size = load_u32(p + 24);
+      std::size_t size = bitmap_bytes(num_vars) + std::size_t{certificate_size};
+      pos += kEntryHeaderSize;
+      if (bytes.size() - pos < size) {
+        throw std::runtime_error("truncated theorem cache file");
+      }
+      std::unique_ptr<char[]> payload(new char[size]);
+      std::memcpy(payload.get(), bytes.data() + pos, size);
+      pos += size;
+      publish(key, valid, num_vars, std::move(payload), certificate_size);
+    }
+    return true;
+  }
+
+  // 先写临时文件再重命名, 读者不会看到写了一半的文件
+  void save(const std::string &path) const {
+    std::string bytes(kMagic, 4);
+    append_u32(bytes, kFormatVersion);
+    append_u64(bytes, checker_version_);
+    std::size_t count_offset = bytes.size();
+    append_u64(bytes, 0);
+    std::uint64_t count = 0;
+    {
+      std::lock_guard<std::mutex> lock(write_mutex_);
+      const Table &table = *table_.load(std::memory_order_acquire);
+      for (const Entry &entry : table.entries) {
+        if (entry.state.load(std::memory_order_acquire) != kReady) {
+          continue;
+        }
+        append_u64(bytes, entry.key.hi);
+        append_u64(bytes, entry.key.lo);
+        append_u32(bytes, entry.valid ? 1 : 0);
+        append_u32(bytes, entry.num_vars);
+        append_u32(bytes, entry.certificate_size);
+        append_u32(bytes, 0);
+        bytes.append(entry.payload,
+                     bitmap_bytes(entry.num_vars) + entry.certificate_size);
+        ++count;
+      }
+    }
+    std::string counted;
+    append_u64(counted, count);
+    bytes.replace(count_offset, 8, counted);
+
+    std::string temporary = path + ".tmp";
+    {
+      std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+      out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+      if (!out) {
+        throw std::runtime_error("cannot write " + temporary);
+      }
+    }
+    if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+      throw std::system_error(errno, std::generic_category(), path);
+    }
+  }
+
+private:
+  // 文件格式 (小端): "CPPT"、u32 格式版本、u64 检查器版本、u64 条目数, 之后每个条目
+  // 是 u64 键高位、u64 键低位、u32 是否有效、u32 变量数、u32 证书长度、u32 保留,
+  // 后接反例位图 ((变量数 + 7) / 8 字节) 与证书
+  static constexpr char kMagic[4] = {'C', 'P', 'P', 'T'};
+  static constexpr std::uint32_t kFormatVersion = 1;
+  static constexpr std::size_t kHeaderSize = 24;
+  static constexpr std::size_t kEntryHeaderSize = 32;
+  static constexpr std::uint32_t kEmpty = 0;
+  static constexpr std::uint32_t kReady = 1;
+
+  struct Entry {
+    std::atomic<std::uint32_t> state{kEmpty};
+    // 以下字段在 state 发布为 kReady 之前写好, 之后不再改变
+    CanonicalKey key{0, 0};
+    bool valid = false;
+    std::uint32_t num_vars = 0;
+    std::uint32_t certificate_size = 0;
+    // 反例位图 (按规范编号) 后接证书; 内存由 payloads_ 持有, 新旧表的条目共享
+    const char *payload = nullptr;
+  };
+
+  struct Table {
+    explicit Table(std::size_t capacity) : entries(capacity) {}
+    std::vector<Entry> entries;
+  };
+
+  static std::size_t bitmap_bytes(std::uint32_t num_vars) {
+    return (std::size_t{num_vars} + 7) / 8;
+  }
+
+  static std::size_t slot_of(const CanonicalKey &key, std::size_t capacity) {
+    return static_cast<std::size_t>(key.lo) & (capacity - 1);
+  }
+
+  const Entry *find(const CanonicalKey &key) const {
+    const Table &table = *table_.load(std::memory_order_acquire);
+    const std::size_t mask = table.entries.size() - 1;
+    for (std::size_t slot = slot_of(key, table.entries.size());;
+         slot = (slot + 1) & mask) {
+      const Entry &entry = table.entries[slot];
+      if (entry.state.load(std::memory_order_acquire) != kReady) {
+        return nullptr;
+      }
+      if (entry.key == key) {
+        return &entry;
+      }
+    }
+  }
+
+  void publish(const CanonicalKey &key, bool valid, std::uint32_t num_vars,
+               std::unique_ptr<char[]> payload, std::uint32_t certificate_size) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    if (find(key) != nullptr) {
+      return;
+    }
+    // 装载因子不超过 1/2, 保证探测总能遇到空位
+    Table *table = table_.load(std::memory_order_relaxed);
+    if ((size_.load(std::memory_order_relaxed) + 1) * 2 > table->entries.size()) {
+      auto grown = std::make_unique<Table>(table->entries.size() * 2);
+      for (const Entry &entry : table->entries) {
+        if (entry.state.load(std::memory_order_relaxed) == kReady) {
+          place(*grown, entry.key, entry.valid, entry.num_vars,
+                entry.payload, entry.certificate_size);
+        }
+      }
+      tables_.push_back(std::move(grown));
+      table = tables_.back().get();
+      table_.store(table, std::memory_order_release);
+    }
+    payloads_.push_back(std::move(payload));
+    place(*table, key, valid, num_vars, payloads_.back().get(), certificate_size);
+    size_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  static void place(Table &table, const CanonicalKey &key, bool valid,
+                    std::uint32_t num_vars, const char *payload,
+                    std::uint32_t certificate_size) {
+    const std::size_t mask = table.entries.size() - 1;
+    std::size_t slot = slot_of(key, table.entries.size());
+    while (table.entries[slot].state.load(std::memory_order_relaxed) == kReady) {
+      slot = (slot + 1) & mask;
+    }
+    Entry &entry = table.entries[slot];
+    entry.key = key;
+    entry.valid = valid;
+    entry.num_vars = num_vars;
+    entry.certificate_size = certificate_size;
+    entry.payload = payload;
+    entry.state.store(kReady, std::memory_order_release);
+  }
+
+  static std::uint32_t load_u32(const char *p) { return detail::load_u32(p); }
+  static std::uint64_t load_u64(const char *p) {
+    return std::uint64_t{detail::load_u32(p)} |
+           std::uint64_t{detail::load_u32(p + 4)} << 32;
+  }
+  static void append_u32(std::string &out, std::uint32_t x) {
+    detail::append_u32(out, x);
+  }
+  static void append_u64(std::string &out, std::uint64_t x) {
+    detail::append_u32(out, static_cast<std::uint32_t>(x));
+    detail::append_u32(out, static_cast<std::uint32_t>(x >> 32));
+  }
+
+  std::uint64_t checker_version_;
+  std::atomic<Table *> table_{nullptr};
+  std::atomic<std::size_t> size_{0};
+  mutable std::atomic<std::size_t> lookups_{0};
+  mutable std::atomic<std::size_t> hits_{0};
+
+  mutable std::mutex write_mutex_;
+  std::vector<std::unique_ptr<Table>> tables_;     // 当前表与被替换的旧表
+  std::vector<std::unique_ptr<char[]>> payloads_;
+};
+
+} // namespace cpp_prop::runtime
+
+#endif // THEOREM_CACHE_H
@@ -0,0 +1,248 @@
+#ifndef TRUTH_TABLE_H
+#define TRUTH_TABLE_H
+
+#include "runtime_formula.h"
+#include "simd_lanes.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+// --- Bit-Parallel Truth Tables ---
+// 每个变量的真值表按位打包: 一个 64 位字保存 64 个赋值下的值, 联结词就是一条
+// 按位指令。引擎一次处理 512 个赋值 (一个 Block, 8 个字), 在 AVX-512 下是一条
+// 向量指令, AVX2 下两条, NEON 下四条, 其他平台退化为 8 个字的循环
+// (向量运算见 simd_lanes.h)。
+// 赋值编号 a 的第 i 位是变量 i 的值, 与 template.h 的 Var<i> 一致。
+
+namespace cpp_prop::runtime {
+
+struct alignas(64) Block {
+  static constexpr std::size_t words = 8;
+  static constexpr std::size_t bits = words * 64;
+  static constexpr unsigned log2_bits = 9;
+
+  std::uint64_t w[words];
+
+  static Block filled(std::uint64_t word) {
+    Block b;
+    for (std::uint64_t &x : b.w) {
+      x = word;
+    }
+    return b;
+  }
+};
+
+namespace detail {
+
+// 变量 0..5 在每个字内的固定模式: 第 j 位为 (j >> i) & 1
+inline constexpr std::uint64_t kWordPattern[6] = {
+    0xAAAAAAAAAAAAAAAAull, 0xCCCCCCCCCCCCCCCCull, 0xF0F0F0F0F0F0F0F0ull,
+    0xFF00FF00FF00FF00ull, 0xFFFF0000FFFF0000ull, 0xFFFFFFFF00000000ull};
+
+// a = Op(a, b), 每次处理 Lanes 的一个向量
+template <typename Op, typename Lanes>
+inline void block_apply(Block &a, const Block &b) {
+  for (std::size_t i = 0; i < Block::words; i += Lanes::words) {
+    Lanes::store(a.w + i, Op::template lane<Lanes>(Lanes::load(a.w + i),
+                                                   Lanes::load(b.w + i)));
+  }
+}
+
+template <typename Lanes = simd::Native>
+inline void block_and(Block &a, const Block &b) {
+  block_apply<simd::AndOp, Lanes>(a, b);
+}
+template <typename Lanes = simd::Native>
+inline void block_or(Block &a, const Block &b) {
+  block_apply<simd::OrOp, Lanes>(a, b);
+}
+template <typename Lanes = simd::Native>
+inline void block_implies(Block &a, const Block &b) {
+  block_apply<simd::ImpliesOp, Lanes>(a, b);
+}
+template <typename Lanes = simd::Native>
+inline void block_equiv(Block &a, const Block &b) {
+  block_apply<simd::EquivOp, Lanes>(a, b);
+}
+template <typename Lanes = simd::Native> inline void block_not(Block &a) {
+  for (std::size_t i = 0; i < Block::words; i += Lanes::words) {
+    Lanes::store(a.w + i, Lanes::bit_not(Lanes::load(a.w + i)));
+  }
+}
+
+} // namespace detail
+
+// 变量 var 在第 block 个 Block (赋值 block * 512 .. block * 512 + 511) 上的真值表
+inline Block variable_block(unsigned var, std::uint64_t block) {
+  if (var < 6) {
+    return Block::filled(detail::kWordPattern[var]);
+  }
+  Block b;
+  if (var < Block::log2_bits) {
+    // 变量 6..8 在 Block 内逐字变化
+    for (std::size_t i = 0; i < Block::words; ++i) {
+      b.w[i] = ((i >> (var - 6)) & 1u) != 0 ? ~0ull : 0ull;
+    }
+    return b;
+  }
+  // 更高的变量在整个 Block 内不变
+  return Block::filled(((block >> (var - Block::log2_bits)) & 1u) != 0 ? ~0ull
+                                                                       : 0ull);
+}
+
+namespace detail {
+
+// 变量少于 9 个时只有一个不完整的 Block: 第 word 个字中有意义的位
+inline std::uint64_t valid_mask(unsigned num_vars, std::size_t word) {
+  if (num_vars >= Block::log2_bits) {
+    return ~0ull;
+  }
+  std::uint64_t total = std::uint64_t{1} << num_vars;
+  std::uint64_t begin = word * 64;
+  if (begin >= total) {
+    return 0;
+  }
+  return total - begin >= 64 ? ~0ull : (std::uint64_t{1} << (total - begin)) - 1;
+}
+
+// [first, last) 个 Block 中第一个使 evaluate(block) 为假的赋值; 没有则返回 false
+template <typename Evaluate>
+bool first_falsifying(unsigned num_vars, std::uint64_t first, std::uint64_t last,
+                      Evaluate &&evaluate, std::uint64_t &assignment) {
+  for (std::uint64_t block = first; block < last; ++block) {
+    const Block &value = evaluate(block);
+    for (std::size_t i = 0; i < Block::words; ++i) {
+      std::uint64_t falsified = ~value.w[i] & valid_mask(num_vars, i);
+      if (falsified != 0) {
+        assignment = block * Block::bits + i * 64 +
+                     static_cast<std::uint64_t>(__builtin_ctzll(falsified));
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// 赋值空间 2^num_vars 划分成的 Block 数
+inline std::uint64_t num_blocks(unsigned num_vars) {
+  return num_vars <= Block::log2_bits
+             ? 1
+             : std::uint64_t{1} << (num_vars - Block::log2_bits);
+}
+
+} // namespace detail
+
+// --- Truth Table Evaluator ---
+// 对一个运行时公式按 Block 求值。求值器持有自己的值栈, 可以重复使用,
+// 不同线程应各用一个。
+class TruthTableEvaluator {
+public:
+  // formula 必须比求值器活得久
+  explicit TruthTableEvaluator(const Formula &formula, unsigned num_vars)
+      : formula_(formula), num_vars_(num_vars), stack_(formula.stack_depth()) {
+    if (num_vars >= Formula::max_vars) {
+      throw std::invalid_argument("TruthTableEvaluator: too many variables");
+    }
+    if (formula.num_vars() > num_vars) {
+      throw std::invalid_argument(
+          "TruthTableEvaluator: formula uses more variables than num_vars");
+    }
+  }
+
+  unsigned num_vars() const { return num_vars_; }
+
+  // 赋值空间 2^num_vars 划分成的 Block 数
+  std::uint64_t num_blocks() const { return detail::num_blocks(num_vars_); }
+
+  // 第 block 个 Block 上的公式值; 超出 2^num_vars 的位没有意义
+  const Block &evaluate(std::uint64_t block) {
+    std::size_t top = 0;
+    for (const Instruction &ins : formula_.code()) {
+      switch (ins.op) {
+      case Opcode::Var:
+        stack_[top++] = variable_block(ins.var, block);
+        break;
+      case Opcode::True:
+      case Opcode::False:
+        stack_[top++] = Block::filled(ins.op == Opcode::True ? ~0ull : 0ull);
+        break;
+      case Opcode::Not:
+        detail::block_not(stack_[top - 1]);
+        break;
+      case Opcode::And:
+        --top;
+        detail::block_and(stack_[top - 1], stack_[top]);
+        break;
+      case Opcode::Or:
+        --top;
+        detail::block_or(stack_[top - 1], stack_[top]);
+        break;
+      case Opcode::Implies:
+        --top;
+        detail::block_implies(stack_[top - 1], stack_[top]);
+        break;
+      case Opcode::Equiv:
+        --top;
+        detail::block_equiv(stack_[top - 1], stack_[top]);
+        break;
+      }
+    }
+    return stack_[0];
+  }
+
+  // [first, last) 个 Block 中第一个使公式为假的赋值; 没有则返回 false
+  bool first_falsifying(std::uint64_t first, std::uint64_t last,
+                        std::uint64_t &assignment) {
+    return detail::first_falsifying(
+        num_vars_, first, last,
+        [this](std::uint64_t block) -> const Block & { return evaluate(block); },
+        assignment);
+  }
+
+private:
+  const Formula &formula_;
+  unsigned num_vars_;
+  std::vector<Block> stack_;
+};
+
+// 按编号从小到大检查全部 2^num_vars 个赋值
+inline TautologyResult check_tautology(const Formula &formula,
+                                       unsigned num_vars) {
+  TruthTableEvaluator evaluator(formula, num_vars);
+  std::uint64_t assignment = 0;
+  if (evaluator.first_falsifying(0, evaluator.num_blocks(), assignment)) {
+    return {false, assignment};
+  }
+  return {true, 0};
+}
+
+inline TautologyResult check_tautology(const Formula &formula) {
+  return check_tautology(formula, formula.num_vars());
+}
+
+// 完整的真值表: 第 a 位是赋值 a 下的值, 共 2^num_vars 位
+inline std::vector<std::uint64_t> truth_table(const Formula &formula,
+                                              unsigned num_vars) {
+  TruthTableEvaluator evaluator(formula, num_vars);
+  std::uint64_t total_bits = std::uint64_t{1} << num_vars;
+  std::vector<std::uint64_t> table((total_bits + 63) / 64);
+  for (std::uint64_t block = 0; block < evaluator.num_blocks(); ++block) {
+    const Block &value = evaluator.evaluate(block);
+    for (std::size_t i = 0; i < Block::words; ++i) {
+      std::size_t index = block * Block::words + i;
+      if (index < table.size()) {
+        table[index] = value.w[i];
+      }
+    }
+  }
+  if (total_bits < 64) {
+    table[0] &= (std::uint64_t{1} << total_bits) - 1;
+  }
+  return table;
+}
+
+} // namespace cpp_prop::runtime
+
+#endif // TRUTH_TABLE_H